@@ -0,0 +1,99 @@
+/*
+ * AnalyticModel.h
+ *
+ * Description: This header file defines the AnalyticModel class, which answers a scenario with queueing
+ *              formulas instead of a simulation when the scenario belongs to a family with a closed-form or
+ *              well-approximated steady-state wait. The model is fitted to the customers: the arrival rate,
+ *              the squared coefficient of variation (SCV) of the interarrival times, the mean and SCV of the
+ *              transaction lengths. Then the first family that fits is chosen:
+ *              - M/M/c: both SCVs are consistent with exponential times (SCV 1). The mean wait in line is
+ *                given exactly by the Erlang C formula.
+ *              - M/G/1: one teller and interarrival times consistent with Poisson arrivals. The mean wait is
+ *                given exactly by the Pollaczek-Khinchine formula.
+ *              - G/G/c: anything else that is stationary. The mean wait is approximated by the Allen-Cunneen
+ *                formula, the M/M/c wait scaled by (SCV of interarrivals + SCV of services) / 2.
+ *              An SCV is consistent with 1 if it lies within three standard errors of 1 (for exponential
+ *              samples the standard error of the SCV is about sqrt(8 / n)), or within 0.05 of 1, which allows
+ *              for times rounded to whole units.
+ *
+ *              No formula applies, and the scenario has to be simulated, if there are too few customers to
+ *              fit, if the tellers cannot keep up (utilization of 1 or more), or if the arrival rate is not
+ *              stationary: the day is cut into ten windows of equal length, and the arrivals per window are
+ *              tested for more dispersion than a renewal process with the fitted SCV would show.
+ *
+ *              The formulas give steady-state waits; a finite day that starts empty waits a little less.
+ *
+ * Class Invariant:
+ * - If getFamily() is not Family::NONE, the utilization is below 1 and the wait statistics are valid.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef ANALYTICMODEL_H
+#define ANALYTICMODEL_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Event.h"
+
+class AnalyticModel {
+
+public:
+    // Scoped enum for the family of queues a scenario was recognized as
+    enum class Family { MMC, MG1, GGC, NONE };
+
+    // Fewest customers the model is fitted to
+    static constexpr std::size_t MIN_CUSTOMERS = 100;
+
+private:
+    int tellers;
+    std::size_t customers;
+    double arrivalRate;
+    double interarrivalScv;
+    double meanService;
+    double serviceScv;
+    Family family;
+    std::string reason;                 // Why no formula applies, if family is NONE
+
+    double utilization;
+    double probabilityOfWait;           // Probability that a customer waits at all (M/M/c value for G/G/c)
+    double meanWait;                    // Mean wait in line
+    double meanLineLength;              // Mean number of customers in line (Little's law)
+
+    // Utility methods
+    void fit(const std::vector<Event>& arrivals);
+    bool isStationary(const std::vector<Event>& arrivals) const;
+    void solve();
+
+public:
+    // Constructor
+    // - Fits the model to arrivals (sorted by time) served by the given number of tellers, and solves it if
+    //   a formula applies.
+    AnalyticModel(const std::vector<Event>& arrivals, int tellers);
+
+    // Description: Returns the probability that a customer of an M/M/c queue with offered load a (arrival
+    //              rate times mean service time) waits, by the Erlang C formula.
+    // Precondition: a < c.
+    // Time Efficiency: O(c)
+    static double erlangC(int c, double a);
+
+    // Description: Returns the name of family, such as "M/M/c".
+    static const char* familyName(Family family);
+
+    // Getters
+    Family getFamily() const;
+    const std::string& getReason() const;
+    std::size_t getCustomerCount() const;
+    double getArrivalRate() const;
+    double getInterarrivalScv() const;
+    double getMeanService() const;
+    double getServiceScv() const;
+    double getUtilization() const;
+    double getProbabilityOfWait() const;
+    double getMeanWait() const;
+    double getMeanLineLength() const;
+};
+
+#endif
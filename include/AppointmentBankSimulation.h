@@ -0,0 +1,99 @@
+/*
+ * AppointmentBankSimulation.h
+ *
+ * Description: This header file defines the AppointmentBankSimulation class, a bank simulation with two
+ *              arrival streams: walk-ins and customers who booked an appointment (see ArrivalStreams.h).
+ *              The streams are merged lazily: the simulation only ever looks at the next customer of each
+ *              stream, and the event priority queue only holds the pending departures, so the day is never
+ *              materialized in memory.
+ *
+ *              Waiting customers are kept in two FIFO lines, and a free teller serves the priority line
+ *              first. Which customers enter the priority line depends on the rule:
+ *              - STRICT: customers with an appointment, unless they arrive more than the grace period after
+ *                their appointment time; such late customers queue with the walk-ins.
+ *              - FIFO: nobody; all customers are served in order of arrival.
+ *              Services are never interrupted: a walk-in who is being served finishes first.
+ *
+ *              Simultaneous events are processed arrivals first (appointments before walk-ins), then
+ *              departures. With no appointments the statistics of the walk-ins are exactly those of
+ *              BankSim --stream-arrivals.
+ *
+ * Class Invariant:
+ * - tellersBusy is the number of customers being served; each has one pending departure.
+ * - A customer waits in a line only while every teller is busy.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef APPOINTMENTBANKSIMULATION_H
+#define APPOINTMENTBANKSIMULATION_H
+
+#include "ArrivalStreams.h"
+#include "Event.h"
+#include "PriorityQueue.h"
+#include "Queue.h"
+
+class AppointmentBankSimulation {
+
+public:
+    // Scoped enum for the rule deciding who enters the priority line (see the file description)
+    enum class PriorityRule { STRICT, FIFO };
+
+    // Structure: TypeStatistics
+    // Purpose: The statistics of the customers of one arrival type.
+    struct TypeStatistics {
+        int customerCount;              // Customers who arrived
+        long long cumulativeWaitTime;   // Sum of the waits from arrival to service start
+        int longestWait;                // Longest of those waits
+        float averageWaitTime() const;
+    };
+
+private:
+    WalkInStream* walkIns;              // Walk-in arrivals (not owned)
+    AppointmentStream* appointments;    // Arrivals with an appointment (not owned)
+    int tellers;                        // Number of tellers on duty
+    PriorityRule rule;                  // Who enters the priority line
+    int lateGrace;                      // Lateness up to which appointments keep priority (negative = any)
+
+    PriorityQueue<Event> departures;    // Pending departures
+    Queue<Arrival> priorityLine;        // Customers served first
+    Queue<Arrival> regularLine;         // Everyone else
+    int tellersBusy;                    // Tellers serving a customer
+
+    int simulationTime;
+    unsigned long long eventsProcessed;
+    TypeStatistics walkInStatistics;
+    TypeStatistics appointmentStatistics;
+    int lateAppointments;               // Appointments that lost priority by arriving late
+    int onTimeServices;                 // Appointments served no later than their appointment time
+    long long cumulativeDelay;          // Sum of the time appointments started after their appointment time
+
+    // Utility methods
+    void processArrival(Arrival customer);
+    void processDeparture();
+    void startService(const Arrival& customer);
+
+public:
+    // Constructor
+    // - Creates a simulation of the two streams, which must outlive it.
+    AppointmentBankSimulation(WalkInStream& walkIns, AppointmentStream& appointments, int tellers,
+                              PriorityRule rule, int lateGrace);
+
+    // Description: Processes all events until both streams are exhausted and every customer has departed.
+    void run();
+
+    // Getters
+    // - The customer count and average wait cover both arrival types.
+    int getSimulationTime() const;
+    unsigned long long getEventsProcessed() const;
+    int getCustomerCount() const;
+    float getAverageWaitTime() const;
+    const TypeStatistics& getWalkInStatistics() const;
+    const TypeStatistics& getAppointmentStatistics() const;
+    int getLateAppointments() const;
+    int getOnTimeServices() const;
+    long long getCumulativeDelay() const;
+};
+
+#endif
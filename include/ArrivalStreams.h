@@ -0,0 +1,123 @@
+/*
+ * ArrivalStreams.h
+ *
+ * Description: This header file defines the arrival streams of the appointment simulation, which read their
+ *              customers lazily, one at a time, instead of materializing the whole day:
+ *              - WalkInStream reads "arrival length" lines (the usual BankSim input) from a stream that is
+ *                sorted by arrival time.
+ *              - AppointmentStream reads "scheduled length" lines (a booking sheet sorted by appointment
+ *                time). Each booked customer either does not show up, with a given probability, or arrives
+ *                at the appointment time plus a random deviation in [earliest, latest] (negative values are
+ *                early arrivals). Deviations reorder the customers, so the stream keeps a small priority
+ *                queue of customers who have been read but have not arrived yet. A customer leaves it only
+ *                once no unread booking can arrive earlier: every unread booking is scheduled at or after
+ *                the next line's time, so it arrives at earliest + that time or later. The queue therefore
+ *                only holds the bookings within one deviation window.
+ *
+ *              Both streams deliver Arrival records, which carry the customer's type and appointment time
+ *              in addition to the arrival time and transaction length of an Event.
+ *
+ * Class Invariant:
+ * - A stream delivers its arrivals in order of time, and of reading for equal times.
+ * - If a stream finds its input out of order, it reports it (isOutOfOrder) and delivers nothing more.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef ARRIVALSTREAMS_H
+#define ARRIVALSTREAMS_H
+
+#include <istream>
+#include <random>
+#include "PriorityQueue.h"
+
+// Structure: Arrival
+// Purpose: A customer arriving at the bank. Arrivals are ordered by time, then by the order they were read in.
+struct Arrival {
+    int time;                       // Time the customer arrives
+    int length;                     // Transaction length
+    int scheduled;                  // Appointment time (the arrival time for walk-ins)
+    bool appointment;               // Whether the customer booked an appointment
+    unsigned long long sequence;    // Position in the customer's input stream
+
+    bool operator<(const Arrival& rhs) const;
+    bool operator>(const Arrival& rhs) const;
+};
+
+class WalkInStream {
+
+private:
+    std::istream* input;            // Remaining walk-in lines (not owned)
+    Arrival next;                   // The next walk-in, if available
+    bool available;                 // Whether next holds a walk-in
+    bool outOfOrder;                // Whether a walk-in arrived before the previous one
+    unsigned long long count;       // Walk-ins read so far
+
+public:
+    // Constructor
+    // - Reads the first walk-in from input, which must outlive the stream.
+    explicit WalkInStream(std::istream& input);
+
+    // Description: Returns true if a walk-in is left.
+    bool hasNext() const;
+
+    // Description: Returns the next walk-in.
+    // Precondition: hasNext() is true.
+    const Arrival& peek() const;
+
+    // Description: Moves on to the following walk-in.
+    // Precondition: hasNext() is true.
+    void advance();
+
+    // Description: Returns true if the input was found not to be sorted by arrival time.
+    bool isOutOfOrder() const;
+};
+
+class AppointmentStream {
+
+private:
+    std::istream* input;                            // Remaining booking lines (not owned)
+    int earliest;                                   // Smallest deviation from the appointment time
+    int latest;                                     // Largest deviation from the appointment time
+    double noShowProbability;                       // Probability that a booked customer does not come
+    std::mt19937_64 generator;                      // Deviations and no-shows
+
+    PriorityQueue<Arrival> pending;                 // Customers read but not yet delivered
+    Arrival lookahead;                              // The next unread booking, if readAhead
+    bool readAhead;                                 // Whether lookahead holds a booking
+    unsigned long long booked;                      // Bookings read so far
+    unsigned long long noShows;                     // Booked customers who did not come
+    bool outOfOrder;                                // Whether a booking was scheduled before the previous one
+
+    // Utility methods
+    void readBooking();
+    void refill();
+
+public:
+    // Constructor
+    // - Reads bookings from input, which must outlive the stream. Deviations are drawn uniformly from
+    //   [earliest, latest]; the generator is seeded with seed, so a run is reproducible.
+    AppointmentStream(std::istream& input, int earliest, int latest, double noShowProbability, unsigned long long seed);
+
+    // Description: Returns true if a customer with an appointment is still to arrive.
+    bool hasNext() const;
+
+    // Description: Returns the next customer with an appointment to arrive.
+    // Precondition: hasNext() is true.
+    const Arrival& peek() const;
+
+    // Description: Moves on to the following customer.
+    // Precondition: hasNext() is true.
+    // Time Efficiency: O(log2 w) for w bookings within one deviation window
+    void advance();
+
+    // Description: Returns the number of bookings read so far, and how many of them did not show up.
+    unsigned long long getBookedCount() const;
+    unsigned long long getNoShowCount() const;
+
+    // Description: Returns true if the booking sheet was found not to be sorted by appointment time.
+    bool isOutOfOrder() const;
+};
+
+#endif
@@ -0,0 +1,298 @@
+/*
+ * BankSimulation.h
+ *
+ * Description: This header file defines the BasicBankSimulation class template, which holds the complete state of one
+ *              bank simulation run: the event priority queue, the bank line, the tellers, the simulation
+ *              clock and the statistics accumulators. Keeping the state together in one copyable object
+ *              allows a run to be paused, copied (snapshotted) and resumed later, which the what-if
+ *              analysis uses to re-simulate only the part of the day that a scenario changes.
+ *
+ *              The simulation is driven one event at a time with step(), or to completion with run().
+ *              Customers are served by a number of tellers; a staffing schedule can change the number
+ *              of tellers on duty at given times (e.g. "a second teller opens at time 840").
+ *
+ *              The class is parameterized on the container types of the event set and the bank line:
+ *              - BankSimulation uses the dynamically sized PriorityQueue<Event> and Queue<Event>.
+ *              - FixedBankSimulation<Events, Line> uses FixedPriorityQueue and FixedQueue, whose capacities
+ *                are compile-time constants. Such a simulation allocates no memory at all (the arrival
+ *                events are referenced, not copied), so small simulations can live on the stack. If a
+ *                scenario exceeds a capacity, a FullDataCollectionException is thrown.
+ *              - LoserTreeBankSimulation replaces the global event heap by a LoserTree with one slot per
+ *                teller. With ArrivalMode::STREAM the arrival stream is the only other event source, so
+ *                the next event is found by the tree's matches plus one final match against the stream.
+ *
+ *              Arrivals can be handled in two ways:
+ *              - ArrivalMode::PRELOAD (default): every arrival event is enqueued in the event priority
+ *                queue up front, exactly like the original simulation, so the output is unchanged.
+ *              - ArrivalMode::STREAM: the arrivals (sorted by time) are read one at a time from the
+ *                input, and the event priority queue only holds the pending departures. Simultaneous
+ *                events are then processed in a fixed order: arrivals before departures, and arrivals
+ *                in input order. The state stays small, which makes snapshots cheap.
+ *
+ *              With batching enabled (setBatchEvents), all events sharing the next timestamp are taken out
+ *              of the event set in one operation and processed as a group: first the arrivals, then the
+ *              departures. In ArrivalMode::STREAM this is exactly the order step() uses; in
+ *              ArrivalMode::PRELOAD simultaneous arrivals are processed in the order the heap yields them.
+ *
+ *              Events are dispatched through a table of handlers indexed by the event type's ID: arrivals and
+ *              departures are processed by the simulation itself, and further event types registered with
+ *              the EventTypeRegistry by the handlers given with setEventHandler (see EventTypeRegistry for
+ *              the registration steps). Events of registered types are kept apart from the event set,
+ *              ordered by time and type ID (and in scheduling order for equal ones), and one is processed
+ *              only once no arrival or departure of its time or earlier is left, in every arrival mode and
+ *              with batching. The event sets order by time only and a LoserTree holds departures only, so
+ *              neither could keep that order. A fixed-capacity simulation allocates for them only if such
+ *              events are scheduled.
+ *
+ *              An IntervalStatistics object can be attached to collect per-interval statistics during the
+ *              run (setIntervalStatistics); every event then also updates its counters. Likewise, a
+ *              CustomerRecords object can keep one record per served customer for analysis after the run
+ *              (setCustomerRecords), and a TraceWriter can write every event, service start and staffing
+ *              change to an indexed trace file (setTraceWriter).
+ *
+ * Class Invariant:
+ * - tellersBusy is the number of customers currently being served; each has one pending departure.
+ * - A customer waits in the bank line only while no teller on duty is free.
+ * - The arrival events referenced by the simulation outlive it and are not modified while it runs.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef BANKSIMULATION_H
+#define BANKSIMULATION_H
+
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+#include "CustomerRecords.h"
+#include "Event.h"
+#include "EventLogWriter.h"
+#include "EventTypeRegistry.h"
+#include "FixedPriorityQueue.h"
+#include "FixedQueue.h"
+#include "FullDataCollectionException.h"
+#include "IntervalStatistics.h"
+#include "LoserTree.h"
+#include "PriorityQueue.h"
+#include "Queue.h"
+#include "TraceWriter.h"
+
+// Structure: StaffingChange
+// Purpose: From time onwards, the number of tellers on duty is tellers.
+struct StaffingChange {
+    int time;     // The time at which the change takes effect
+    int tellers;  // The number of tellers on duty from that time on
+};
+
+// Class: BankSimulationBase
+// Purpose: Declarations shared by every BasicBankSimulation, whatever its container types.
+class BankSimulationBase {
+
+public:
+    // Scoped enum for the way arrival events enter the simulation (see the file description)
+    enum class ArrivalMode { PRELOAD, STREAM };
+
+    // Structure: SavedState
+    // Purpose: The state of an ArrivalMode::STREAM simulation as plain data, so that another process can
+    //          continue the run with further arrivals (see TraceCheckpoint). Only departures are pending in
+    //          that mode, so the event set is kept as their times.
+    struct SavedState {
+        int simulationTime = 0;
+        int tellersOnDuty = 1;
+        int tellersBusy = 0;
+        int customerCount = 0;
+        long long cumulativeWaitTime = 0;
+        unsigned long long eventsProcessed = 0;
+        std::size_t nextStaffingChange = 0;
+        std::vector<int> departureTimes;                // Pending departures, earliest first
+        std::vector<Event> bankLine;                    // Waiting customers, front first
+    };
+};
+
+template <typename EventSet, typename Line>
+class BasicBankSimulation : public BankSimulationBase {
+
+public:
+    // Handler of an event type: processes event in simulation, with the context given to setEventHandler
+    typedef void (*EventHandler)(BasicBankSimulation& simulation, Event& event, void* context);
+
+private:
+    // Structure: HandlerEntry
+    // Purpose: The handler of an event type and its context.
+    struct HandlerEntry {
+        EventHandler handler;
+        void* context;
+    };
+
+    const std::vector<Event>* arrivals;                 // The customers' arrival events (not owned)
+    const std::vector<StaffingChange>* staffing;        // Staffing schedule sorted by time, or nullptr (not owned)
+    ArrivalMode arrivalMode;                            // How arrivals enter the simulation
+
+    EventSet eventPriorityQueue;                        // Pending events, ordered by time
+    Line bankLine;                                      // Customers waiting for a teller
+    std::size_t nextArrival;                            // Index of the next arrival not yet in the simulation
+    std::size_t nextStaffingChange;                     // Index of the next staffing change not yet applied
+
+    unsigned int lineLength;                            // Number of customers in the bank line
+    int tellersOnDuty;                                  // Number of tellers currently working
+    int tellersBusy;                                    // Number of tellers currently serving a customer
+    int simulationTime;                                 // Time of the event processed last
+    int customerCount;                                  // Number of customers who have arrived
+    long long cumulativeWaitTime;                       // Sum of the wait times of all served customers
+    unsigned long long eventsProcessed;                 // Number of events processed so far
+
+    bool logEvents;                                     // Whether each processed event is printed
+    EventLogWriter* asyncLog;                           // Asynchronous log writer, or nullptr (not owned)
+
+    bool batchEvents;                                   // Whether run() processes simultaneous events as a group
+    std::vector<Event> batch;                           // Events of the current group, reused between groups
+
+    IntervalStatistics* intervals;                      // Per-interval statistics, or nullptr (not owned)
+    CustomerRecords* records;                           // Per-customer records, or nullptr (not owned)
+    TraceWriter* trace;                                 // Trace file writer, or nullptr (not owned)
+
+    HandlerEntry handlers[EventTypeRegistry::MAX_TYPES];  // By event type ID
+
+    // Pending events of registered types by (time, type ID); equal keys keep the order they were scheduled
+    std::multimap<std::pair<int, int>, Event> registeredEvents;
+
+    // Utility methods
+    static EventSet makeEventSet(unsigned int capacity);
+    void processEvent(Event& newEvent);
+    void processArrival(Event& newEvent);
+    void processDeparture(Event& newEvent);
+    static void handleArrival(BasicBankSimulation& simulation, Event& event, void* context);
+    static void handleDeparture(BasicBankSimulation& simulation, Event& event, void* context);
+    static void handleUnknown(BasicBankSimulation& simulation, Event& event, void* context);
+    void startService(const Event& customer, int startTime);
+    void applyStaffingChanges(int upToTime);
+    bool hasEvents() const;
+    bool nextArrivalIsDue() const;
+    bool registeredEventIsDue() const;
+
+public:
+    // Constructor
+    // - Creates a simulation of the given arrival events with the given number of tellers.
+    // - In ArrivalMode::STREAM the arrivals must be sorted by time (see sortArrivals).
+    // - Throws FullDataCollectionException if a fixed-capacity event set cannot hold the preloaded arrivals.
+    BasicBankSimulation(const std::vector<Event>& arrivals, int tellers = 1, ArrivalMode mode = ArrivalMode::PRELOAD);
+
+    // Description: Sorts arrival events by time, keeping simultaneous arrivals in input order.
+    // Postcondition: arrivals is sorted and suitable for ArrivalMode::STREAM.
+    static void sortArrivals(std::vector<Event>& arrivals);
+
+    // Description: Sets the staffing schedule (sorted by time). The schedule must outlive the simulation.
+    //              Passing nullptr keeps the initial number of tellers all day.
+    void setStaffingSchedule(const std::vector<StaffingChange>* schedule);
+
+    // Description: Enables or disables the per-event log. If asyncLog is not nullptr, log lines
+    //              are queued on that writer instead of being printed directly.
+    void setEventLog(bool logEvents, EventLogWriter* asyncLog = nullptr);
+
+    // Description: Enables or disables batching: if enabled, run() processes the events with equal
+    //              timestamps as a group (see stepBatch). The group buffer is the only memory a
+    //              fixed-capacity simulation allocates.
+    void setBatchEvents(bool batchEvents);
+
+    // Description: Attaches per-interval statistics (nullptr detaches them). The statistics must outlive
+    //              the run; call their finish() once the simulation is complete.
+    void setIntervalStatistics(IntervalStatistics* intervals);
+
+    // Description: Attaches per-customer records (nullptr detaches them): every service started from now on
+    //              appends a record. The records must outlive the run.
+    void setCustomerRecords(CustomerRecords* records);
+
+    // Description: Attaches a trace writer (nullptr detaches it): every event, service start and staffing
+    //              change from now on is recorded. The writer must outlive the run; call its finish() once the
+    //              simulation is complete.
+    void setTraceWriter(TraceWriter* trace);
+
+    // Description: Makes handler process the events of a registered type, passing it context (which must
+    //              outlive the simulation and its copies). Events of a type without a handler throw
+    //              std::logic_error when processed.
+    // Precondition: type is registered and is neither ARRIVAL nor DEPARTURE.
+    void setEventHandler(Event::EventType type, EventHandler handler, void* context = nullptr);
+
+    // Description: Schedules an event of a registered type. It is processed after every arrival and departure
+    //              of its time, and after the pending events of its time with smaller type IDs or scheduled
+    //              earlier. An event scheduled by a handler must not be earlier than the simulation time.
+    // Precondition: The event's type is registered and is neither ARRIVAL nor DEPARTURE.
+    // Time Efficiency: O(log2 r) for r pending events of registered types
+    void scheduleEvent(const Event& event);
+
+    // Description: Returns true if at least one event is still to be processed, or customers are waiting
+    //              for a staffing change that has not been applied yet.
+    // Postcondition: The simulation is unchanged by this operation.
+    bool hasPendingEvents() const;
+
+    // Description: Returns the time of the next event to be processed (or of the next staffing change,
+    //              if only waiting customers and staffing changes are left).
+    // Precondition: hasPendingEvents() is true.
+    // Postcondition: The simulation is unchanged by this operation.
+    int getNextEventTime() const;
+
+    // Description: Processes the next event (applying any staffing change due before it). If no event is
+    //              left but customers are waiting, only the next staffing change is applied.
+    //              Returns false if there was nothing left to process.
+    // Exceptions: Throws FullDataCollectionException if a fixed-capacity container overflows.
+    bool step();
+
+    // Description: Processes all events at the time of the next event (applying any staffing change
+    //              due before them): arrivals first, then departures. Events created by the group at the
+    //              same time (zero-length services) form the next group.
+    //              Returns false if there was no event left to process.
+    // Exceptions: Throws FullDataCollectionException if a fixed-capacity container overflows.
+    bool stepBatch();
+
+    // Description: Processes all remaining events.
+    void run();
+
+    // Description: Returns the state of the simulation: clock, pending departures, bank line, tellers,
+    //              statistics and position in the staffing schedule.
+    // Precondition: ArrivalMode::STREAM, and no event of a registered type is pending (those are not saved).
+    // Time Efficiency: O(p log2 p + w) for p pending departures and w waiting customers
+    SavedState saveState() const;
+
+    // Description: Continues the saved run with the arrivals of this simulation, which must not arrive before
+    //              the last arrival of the saved run. The staffing schedule must be the saved run's.
+    // Precondition: ArrivalMode::STREAM and no event has been processed yet.
+    // Time Efficiency: O(p log2 p + w)
+    void restoreState(const SavedState& state);
+
+    // Getters
+
+    // Description: Returns the time of the event processed last.
+    int getSimulationTime() const;
+
+    // Description: Returns the number of customers who have arrived so far.
+    int getCustomerCount() const;
+
+    // Description: Returns the sum of the wait times of all customers served so far.
+    long long getCumulativeWaitTime() const;
+
+    // Description: Returns the average wait time over all customers who have arrived so far.
+    float getAverageWaitTime() const;
+
+    // Description: Returns the number of events processed so far.
+    unsigned long long getEventsProcessed() const;
+
+    // Description: Returns the number of arrivals that have entered the simulation.
+    std::size_t getArrivalsStarted() const;
+};
+
+// The simulation with dynamically sized containers, used by default
+typedef BasicBankSimulation<PriorityQueue<Event>, Queue<Event>> BankSimulation;
+
+// A simulation whose pending departures are merged by a loser tree over the tellers
+typedef BasicBankSimulation<LoserTree<Event>, Queue<Event>> LoserTreeBankSimulation;
+
+// An allocation-free simulation with room for Events pending events and Line waiting customers
+template <unsigned int Events, unsigned int Line>
+using FixedBankSimulation = BasicBankSimulation<FixedPriorityQueue<Event, Events>, FixedQueue<Event, Line>>;
+
+// Include the implementation file (BankSimulation.cpp) after the class definition
+#include "../src/BankSimulation.cpp"
+
+#endif
@@ -13,6 +13,13 @@
  *              when the number of elements exceeds the current capacity. Utility methods such as `reHeapUp` 
  *              and `reHeapDown` are used to restore the heap order after modifications.
  *
+ *              Only the slots holding heap elements are constructed; the rest of the array is raw memory.
+ *              Growing the array therefore never default-constructs elements: trivially copyable elements
+ *              are moved with realloc (which can extend large arrays in place), other elements are
+ *              move-constructed into the new array. When the heap drains to a small fraction of its
+ *              capacity, the array shrinks again (see setShrinkPolicy), so the memory taken by a burst
+ *              of elements is given back once the burst has been processed.
+ *
  *              The class provides an O(1) method for retrieving the number of elements in the heap, 
  *              and insertion and removal operations have a logarithmic time complexity O(log n). 
  *              The class is fully templated, allowing it to work with any data type that supports 
@@ -23,11 +30,12 @@
  *   its child nodes (min-heap).
  * - The root element is always the smallest element in the heap.
  * - The dynamic array used to store heap elements can expand as needed to accommodate more elements.
+ * - Exactly the first elementCount slots of the array hold constructed elements.
  * - If the heap is empty, attempts to retrieve or remove an element will throw an 
  *   EmptyDataCollectionException.
  *
  * Author: Kunpeng (Andy) Zhang
- * Last Modified: Sep. 2024
+ * Last Modified: Oct. 2026
  */
 
 #ifndef BINARYHEAP_H
@@ -35,23 +43,49 @@
 
 #include "EmptyDataCollectionException.h"
 #include <algorithm>  // For std::swap and std::copy
+#include <cstddef>    // For std::size_t and std::max_align_t
+#include <vector>     // For the groups returned by removeMinimumGroup
 
 template<typename ElementType>
 class BinaryHeap {
+    static_assert(alignof(ElementType) <= alignof(std::max_align_t), "BinaryHeap elements must not be over-aligned");
+
     private:
         ElementType* elements;  // Pointer to the dynamic array that stores heap elements
         unsigned int capacity;  // The current capacity of the array
         unsigned int elementCount;  // The number of elements currently in the heap
+        std::vector<unsigned int> groupIndices;  // Scratch space of removeMinimumGroup, reused between calls
 
         // Utility methods to maintain the heap property
         void reHeapUp(unsigned int indexOfChild);
         void reHeapDown(unsigned int indexOfRoot);
         void expandHeap();  // Method to expand the dynamic array when capacity is reached
+        void shrinkHeap();  // Method to shrink the dynamic array when the heap has drained
+
+        // Array allocation, with the optional advice for large arrays (see setLargeArrayAdvice)
+        static void (*largeArrayAdvice)(void*, std::size_t);
+        static std::size_t largeArrayThreshold;
+        static std::size_t largeArrayAlignment;
+        static bool isLargeArray(std::size_t bytes);
+        static ElementType* allocateArray(unsigned int count);
+        static ElementType* resizeArray(ElementType* array, unsigned int elementCount, unsigned int newCount);
+        static void releaseArray(ElementType* array, unsigned int elementCount);
+
+        // Shrink-on-drain policy shared by all heaps of this element type (see setShrinkPolicy)
+        static unsigned int shrinkFactor;
+        static unsigned int shrinkMinimumCapacity;
 
     public:
         // Constructor
         BinaryHeap(unsigned int capacity = 10);  // Default initial capacity
 
+        // Copy constructor
+        // - Creates an independent copy of rhs (used to snapshot simulation state).
+        BinaryHeap(const BinaryHeap& rhs);
+
+        // Copy assignment operator
+        BinaryHeap& operator=(const BinaryHeap& rhs);
+
         // Destructor
         ~BinaryHeap();
 
@@ -77,6 +111,33 @@ class BinaryHeap {
         // Exceptions: Throws EmptyDataCollectionException if this Binary Heap is empty.
         // Time Efficiency: O(log2 n)
         void remove();
+
+        // Description: Removes all elements equal to the minimum element (neither smaller nor greater
+        //              than it) in one operation and appends them to group, in no particular order.
+        // Precondition: This Binary Heap is not empty.
+        // Exceptions: Throws EmptyDataCollectionException if this Binary Heap is empty.
+        // Time Efficiency: O(k log2 n) for k removed elements, but most of the holes left by the
+        //                  group are deep in the heap, where restoring the heap order is cheap.
+        void removeMinimumGroup(std::vector<ElementType>& group);
+
+        // Description: Registers advice, a function called with the address and size of every element
+        //              array of at least thresholdBytes bytes, before its elements are constructed
+        //              (e.g. to request transparent huge pages). Such arrays start at a multiple of alignment
+        //              (a power of two) and are rounded up to a multiple of it, so that the advice can cover
+        //              them in whole aligned units. Passing nullptr removes the advice.
+        // Precondition: No Binary Heap of this element type is being resized concurrently.
+        static void setLargeArrayAdvice(void (*advice)(void*, std::size_t), std::size_t thresholdBytes,
+                                        std::size_t alignment);
+
+        // Description: Sets when the element array shrinks as the heap drains: once at most
+        //              1/factor of the capacity is used, the capacity is reduced to twice the element
+        //              count, but not below minimumCapacity. A factor of 0 never shrinks the array.
+        //              Because a shrunk array is half full, it only grows again once the element count
+        //              has doubled, so alternating inserts and removals cannot make it resize repeatedly.
+        //              The default is a factor of 4 and a minimum capacity of 1024 elements.
+        // Precondition: factor is 0 or at least 3. No Binary Heap of this element type is being used
+        //               concurrently.
+        static void setShrinkPolicy(unsigned int factor, unsigned int minimumCapacity);
 };
 
 #include "../src/BinaryHeap.cpp"
@@ -0,0 +1,104 @@
+/*
+ * BranchPool.h
+ *
+ * Description: This header file defines the BranchPool class, which simulates thousands of small,
+ *              independent bank branches in one process. Running BankSim once per branch spends most of
+ *              the time on process start-up and on setting up a heap and a linked-list queue for a few
+ *              hundred customers; the pool instead keeps the state of every branch in a handful of shared
+ *              arrays (a struct of arrays), one element or one slice per branch:
+ *              - The customers of all branches are stored branch by branch in two arrays (arrival time
+ *                and service length), each branch's slice sorted by time in input order.
+ *              - The bank line of a branch needs no storage at all: customers are served in arrival
+ *                order, so the line is the slice between the next customer to be served (lineHead) and
+ *                the next customer to arrive (nextArrival).
+ *              - The pending departures of a branch (at most one per teller) are a small binary heap in
+ *                that branch's slice of one shared departure-time array.
+ *
+ *              The branches are advanced in sweeps: each sweep moves every branch that still has events
+ *              forward to the same time horizon, visiting the branches in memory order, then drops the
+ *              finished branches from the list of active branches. Every branch processes simultaneous
+ *              events like BankSimulation::ArrivalMode::STREAM (arrivals first, in input order), so the
+ *              statistics of a branch are exactly those of BankSim --stream-arrivals on its customers.
+ *
+ * Class Invariant:
+ * - For branch b: arrivalBegin[b] <= lineHead[b] <= nextArrival[b] <= arrivalBegin[b + 1].
+ * - tellersBusy[b] departures are pending in departureTime[b * tellers, b * tellers + tellersBusy[b]),
+ *   which is a min-heap.
+ * - A customer waits in the bank line only while every teller of the branch is busy.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef BRANCHPOOL_H
+#define BRANCHPOOL_H
+
+#include <cstddef>
+#include <vector>
+#include "Event.h"
+
+class BranchPool {
+
+public:
+    // Structure: BranchStatistics
+    // Purpose: The final statistics of one branch.
+    struct BranchStatistics {
+        int branch;                          // Branch number from the input
+        int customerCount;                   // Customers who arrived
+        long long cumulativeWaitTime;        // Sum of the wait times of all customers
+        float averageWaitTime;               // Average wait time per customer
+        unsigned long long eventsProcessed;  // Arrival and departure events processed
+        int lastEventTime;                   // Time of the branch's last event
+    };
+
+private:
+    int tellers;                             // Tellers on duty at every branch
+    std::vector<int> branchNumbers;          // Branch number of each branch, in increasing order
+
+    // Customers of all branches, branch by branch
+    std::vector<int> arrivalTime;
+    std::vector<int> serviceLength;
+    std::vector<std::size_t> arrivalBegin;   // First customer of each branch (one extra entry at the end)
+
+    // State of each branch
+    std::vector<std::size_t> nextArrival;    // Next customer to arrive
+    std::vector<std::size_t> lineHead;       // Next customer to be served
+    std::vector<int> tellersBusy;            // Pending departures
+    std::vector<int> departureTime;          // tellers slots per branch, each slice a min-heap
+    std::vector<int> simulationTime;
+    std::vector<int> customerCount;
+    std::vector<long long> cumulativeWaitTime;
+    std::vector<unsigned long long> eventsProcessed;
+
+    std::vector<std::size_t> active;         // Branches that still have events, in memory order
+    unsigned int sweepCount;                 // Sweeps performed so far
+
+    // Utility methods
+    bool hasEvents(std::size_t branch) const;
+    int nextEventTime(std::size_t branch) const;
+    void advance(std::size_t branch, long long horizon);
+    void serveNext(std::size_t branch, int startTime);
+    void pushDeparture(std::size_t branch, int time);
+    void popDeparture(std::size_t branch);
+
+public:
+    // Constructor
+    // - Customer i belongs to branch branches[i] and is described by the arrival event arrivals[i].
+    // - Every branch has the given number of tellers on duty all day.
+    BranchPool(const std::vector<int>& branches, const std::vector<Event>& arrivals, int tellers = 1);
+
+    // Description: Processes all remaining events of every branch in sweeps of sweepLength time units.
+    // Postcondition: Every branch has completed its day.
+    void run(int sweepLength);
+
+    // Description: Returns the number of branches.
+    std::size_t getBranchCount() const;
+
+    // Description: Returns the number of sweeps performed by run().
+    unsigned int getSweepCount() const;
+
+    // Description: Returns the statistics of every branch, in increasing order of branch number.
+    std::vector<BranchStatistics> getStatistics() const;
+};
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * ColumnStatistics.h
+ *
+ * Description: This header file declares the reduction kernels that summarize a column of integers (for
+ *              example the waits of CustomerRecords) after a run. One call computes every statistic in a
+ *              single pass over the column: count, sum, variance, minimum, maximum, the number of values
+ *              above a threshold and a histogram. Fusing the statistics means each value is loaded from
+ *              memory once, so large columns are limited by memory bandwidth rather than by one loop per
+ *              statistic.
+ *
+ *              The histogram is computed without scattered increments: for every bin boundary the kernel
+ *              counts the values at or above it (a compare and an add per boundary, which vectorize), and
+ *              the bins are the differences of neighbouring counts.
+ *
+ *              Three kernels are available: scalar, AVX2 (8 values per instruction) and AVX-512 (16 values
+ *              per instruction). The vector kernels are compiled for their instruction set regardless of
+ *              the compiler flags and chosen at run time according to what the CPU supports. All kernels
+ *              produce the same counts, sums and extremes; the variance may differ in the last bits,
+ *              because the kernels add the squares in a different order.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef COLUMNSTATISTICS_H
+#define COLUMNSTATISTICS_H
+
+#include <cstddef>
+
+// Largest number of histogram bins a summary can have
+const unsigned int MAX_HISTOGRAM_BINS = 16;
+
+// Scoped enum for the reduction kernel (instruction set) used by summarizeColumn
+enum class StatisticsKernel { SCALAR, AVX2, AVX512 };
+
+// Structure: ColumnSummary
+// Purpose: The statistics of one column.
+struct ColumnSummary {
+    unsigned long long count = 0;                           // Number of values
+    long long sum = 0;                                      // Sum of the values
+    double shift = 0;                                       // First value, the origin of the deviations
+    double squaredDeviations = 0;                           // Sum of (value - shift)^2
+    int minimum = 0;                                        // Smallest value (0 if there is none)
+    int maximum = 0;                                        // Largest value (0 if there is none)
+    unsigned long long aboveThreshold = 0;                  // Values greater than the threshold
+    unsigned long long histogram[MAX_HISTOGRAM_BINS] = {};  // Values per bin (see summarizeColumn)
+    unsigned int binCount = 0;                              // Number of bins used
+
+    // Description: Returns the mean of the values (0 if there is none).
+    double mean() const;
+
+    // Description: Returns the sample variance of the values (0 if there are fewer than two).
+    double variance() const;
+};
+
+// Function: isKernelSupported
+// Purpose: Returns true if kernel can run on this CPU (the scalar kernel always can).
+bool isKernelSupported(StatisticsKernel kernel);
+
+// Function: bestKernel
+// Purpose: Returns the widest kernel this CPU supports.
+StatisticsKernel bestKernel();
+
+// Function: kernelName
+// Purpose: Returns the name of kernel ("scalar", "avx2" or "avx512").
+const char* kernelName(StatisticsKernel kernel);
+
+// Function: summarizeColumn
+// Purpose: Computes the statistics of values[0, count) in one pass with the given kernel (which must be
+//          supported). Bin i of the histogram holds the values v with i * binWidth <= v < (i + 1) * binWidth;
+//          values below 0 count in the first bin and values beyond the last bin in the last one.
+// Precondition: binWidth >= 1 and 1 <= binCount <= MAX_HISTOGRAM_BINS.
+// Time Efficiency: O(count * binCount / w) for w values per instruction
+ColumnSummary summarizeColumn(const int* values, std::size_t count, int threshold, int binWidth,
+                              unsigned int binCount, StatisticsKernel kernel);
+
+#endif
@@ -0,0 +1,31 @@
+/*
+ * ConfidenceInterval.h
+ *
+ * Description: This header file declares meanWithConfidence(), which summarizes independent observations
+ *              of a quantity (for example one value per independent run) by their mean, their sample
+ *              variance and the half-width of a 95% confidence interval for the mean based on Student's t
+ *              distribution.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef CONFIDENCEINTERVAL_H
+#define CONFIDENCEINTERVAL_H
+
+#include <vector>
+
+// Structure: MeanWithConfidence
+// Purpose: The mean of some observations with the spread needed to judge it.
+struct MeanWithConfidence {
+    double mean;
+    double variance;        // Sample variance of the observations (0 for fewer than two)
+    double halfWidth;       // Half-width of the 95% confidence interval for the mean (0 for fewer than two)
+};
+
+// Description: Returns the mean, sample variance and 95% confidence half-width of values.
+// Precondition: values is not empty.
+// Time Efficiency: O(n)
+MeanWithConfidence meanWithConfidence(const std::vector<double>& values);
+
+#endif
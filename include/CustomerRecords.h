@@ -0,0 +1,53 @@
+/*
+ * CustomerRecords.h
+ *
+ * Description: This header file defines the CustomerRecords class, which keeps one record per served
+ *              customer (arrival time, service start, departure time and wait) for analysis after the
+ *              run. The records are stored as a struct of arrays: one contiguous column per field, so a
+ *              statistic over one field (see ColumnStatistics.h) streams through exactly the bytes it
+ *              needs, in order, and can be computed with SIMD instructions.
+ *
+ *              Records are appended in the order in which services start.
+ *
+ * Class Invariant:
+ * - All four columns have the same length.
+ * - For every record: wait == start - arrival and departure >= start.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef CUSTOMERRECORDS_H
+#define CUSTOMERRECORDS_H
+
+#include <cstddef>
+#include <vector>
+
+class CustomerRecords {
+
+private:
+    std::vector<int> arrivals;      // Arrival time of each customer
+    std::vector<int> starts;        // Time each customer's service started
+    std::vector<int> departures;    // Time each customer departed
+    std::vector<int> waits;         // Time each customer spent in the bank line
+
+public:
+    // Description: Reserves room for count records, so that appending them does not reallocate.
+    void reserve(std::size_t count);
+
+    // Description: Appends the record of a customer who arrived at arrival and was served from start
+    //              to departure.
+    // Time Efficiency: O(1) amortized
+    void append(int arrival, int start, int departure);
+
+    // Description: Returns the number of records.
+    std::size_t size() const;
+
+    // Columns (each holds size() values)
+    const std::vector<int>& getArrivals() const;
+    const std::vector<int>& getStarts() const;
+    const std::vector<int>& getDepartures() const;
+    const std::vector<int>& getWaits() const;
+};
+
+#endif
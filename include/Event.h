@@ -8,12 +8,15 @@
  *              provides constructors, accessors, mutators, and comparison operators necessary for
  *              managing and processing events within the simulation.
  *
+ *              Further event types can be registered at run time (see EventTypeRegistry); their values
+ *              follow DEPARTURE.
+ *
  * Class Invariant: 
  * - Arrival events have a type of EventType::ARRIVAL.
- * - Departure events have a type of EventType::DEPARTURE.
+ * - Departure events have a type of EventType::DEPARTURE and a length of 0.
  * 
  * Author: Andy Zhang
- * Last Modified: Sep. 2024
+ * Last Modified: Oct. 2026
  */
 
 #ifndef EVENT_H
@@ -27,12 +30,13 @@ public:
     // Scoped enum for event types
     // - ARRIVAL: Represents an event where a customer arrives at the bank.
     // - DEPARTURE: Represents an event where a customer completes their transaction and leaves.
+    // - The values are dense IDs; registered types take the values after DEPARTURE.
     enum class EventType { ARRIVAL, DEPARTURE };
 
 private:
     EventType type;  // The type of the event (ARRIVAL or DEPARTURE)
     int time = 0;    // The time at which the event occurs
-    int length = 0;  // The transaction length, relevant only for arrival events
+    int length = 0;  // The transaction length of an arrival (the payload of a registered type)
 
 public:
     // Constructors
@@ -77,9 +81,9 @@ public:
     // Postcondition: The event time is updated to the specified value.
     void setTime(int aTime);
 
-    // Description: Sets the transaction length for an arrival event.
-    // Precondition: The event type should be ARRIVAL. If the type is DEPARTURE, the length is set to 0.
-    // Postcondition: The event length is updated if the event is of type ARRIVAL.
+    // Description: Sets the transaction length for an arrival event (or the payload of a registered type).
+    // Precondition: The event type should not be DEPARTURE. If it is, the length is set to 0.
+    // Postcondition: The event length is updated unless the event is a DEPARTURE (then it is 0).
     void setLength(int aLength);
    
     // Description: Determines if the event is an arrival event.
@@ -90,8 +94,10 @@ public:
 
     // Description: Comparison operator to compare two events.
     // - Events are primarily compared by their time.
-    // - If two events occur at the same time, ARRIVAL events are considered less than DEPARTURE events.
-    // Postcondition: Returns true if this event occurs before or at the same time as the rhs event.
+    // - If two events occur at the same time, they are compared by type: ARRIVAL events are considered less
+    //   than DEPARTURE events, and those less than events of registered types.
+    // Postcondition: Returns true if this event occurs before the rhs event, or at the same time with a type ID
+    //                not greater than that of rhs (ARRIVAL, DEPARTURE, then registered types in order).
     bool operator<=(const Event& rhs) const;
 
     // For Testing Purposes
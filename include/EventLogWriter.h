@@ -0,0 +1,116 @@
+/*
+ * EventLogWriter.h
+ *
+ * Description: This header file defines the EventLogWriter class, an asynchronous writer for the
+ *              per-event simulation log ("Processing an arrival event at time: ..."). Formatting and
+ *              writing every log line on the simulation thread makes full-log runs far slower than
+ *              quiet runs, so the EventLogWriter moves that work to a dedicated writer thread.
+ *
+ *              The simulation thread (the producer) appends compact records holding only the event
+ *              type and time to a lock-free single-producer/single-consumer (SPSC) ring buffer. The
+ *              writer thread (the consumer) drains the ring, formats each record in the exact text
+ *              layout produced by outputEventProcessing, collects the text in a large block buffer
+ *              and writes the block to the output stream in one call. The record ring and the text
+ *              block form the two buffers between the simulation and the output stream.
+ *
+ *              When the ring is full the producer either blocks until the writer catches up
+ *              (OverflowPolicy::BLOCK, the default, which keeps the log complete) or drops the record
+ *              and counts it (OverflowPolicy::DROP, which never stalls the simulation).
+ *
+ * Class Invariant:
+ * - Exactly one thread calls append() and exactly one writer thread consumes records.
+ * - Records are written in the order in which they were appended.
+ * - After finish() returns, every record that was not dropped has been written and flushed.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef EVENTLOGWRITER_H
+#define EVENTLOGWRITER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Event.h"
+
+class EventLogWriter {
+
+public:
+    // Scoped enum for the back-pressure policy applied when the record ring is full
+    // - BLOCK: The simulation thread waits until the writer thread frees a slot.
+    // - DROP: The record is discarded and counted in the dropped-record counter.
+    enum class OverflowPolicy { BLOCK, DROP };
+
+private:
+    // Compact log record: everything needed to reproduce one line of the event log
+    struct Record {
+        int time;                // The time at which the event occurred
+        Event::EventType type;   // The type of the event, which selects the layout of its line
+    };
+
+    std::FILE* out;                   // Output stream the formatted log is written to
+    OverflowPolicy policy;            // Back-pressure policy used when the ring is full
+    std::vector<Record> ring;         // SPSC ring buffer of pending records
+    std::size_t mask;                 // ring.size() - 1, ring size is a power of two
+    std::vector<char> block;          // Text block filled by the writer thread before each write
+
+    // The producer and consumer indices are padded onto separate cache lines to avoid false sharing
+    char padBeforeHead[64];
+    std::atomic<std::size_t> head;   // Next slot to be consumed (owned by the writer)
+    char padBeforeTail[64];
+    std::atomic<std::size_t> tail;   // Next slot to be produced (owned by the simulation)
+    char padAfterTail[64];
+    std::atomic<bool> stopping;      // Set by finish() once no more records will arrive
+    unsigned long long droppedCount; // Records discarded under OverflowPolicy::DROP
+
+    std::thread writer;               // The writer thread
+    bool finished;                    // True once finish() has joined the writer thread
+
+    // Utility methods used by the writer thread
+    void run();
+    std::size_t formatRecord(const Record& record, char* buffer) const;
+    void writeBlock(std::size_t length);
+
+public:
+    // Constructor
+    // - Starts the writer thread. ringCapacity is rounded up to a power of two and blockSize is
+    //   the size in bytes of the text block handed to each write call.
+    EventLogWriter(std::FILE* out, OverflowPolicy policy = OverflowPolicy::BLOCK,
+                   std::size_t ringCapacity = 65536, std::size_t blockSize = 1 << 16);
+
+    // Destructor
+    // - Calls finish() if it has not been called yet.
+    ~EventLogWriter();
+
+    // Description: Appends the log record of event to the ring buffer.
+    //              Returns true if the record was queued, false if it was dropped.
+    // Precondition: finish() has not been called. Called from the simulation thread only.
+    // Time Efficiency: O(1) (may wait for the writer under OverflowPolicy::BLOCK)
+    bool append(const Event& event);
+
+    // Description: Waits until the writer thread has written all queued records, flushes the
+    //              output stream and stops the writer thread.
+    // Postcondition: Everything appended (and not dropped) has been written to the output stream.
+    void finish();
+
+    // Description: Returns the number of records dropped because the ring was full.
+    // Postcondition: The EventLogWriter is unchanged by this operation.
+    unsigned long long getDroppedCount() const;
+
+    // The writer owns a thread and a ring buffer, so it cannot be copied
+    EventLogWriter(const EventLogWriter&) = delete;
+    EventLogWriter& operator=(const EventLogWriter&) = delete;
+};
+
+// Function: outputEventProcessing
+// Purpose: Outputs a message indicating that an event is being processed, aligning the event times.
+//          The layout is the one registered for the event's type (see EventTypeRegistry).
+//          When an asynchronous writer is given, only a compact record is queued and the writer thread
+//          produces the same text.
+void outputEventProcessing(const Event& event, EventLogWriter* asyncLog);
+
+#endif
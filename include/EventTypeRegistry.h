@@ -0,0 +1,85 @@
+/*
+ * EventTypeRegistry.h
+ *
+ * Description: This header file defines the EventTypeRegistry class, the table of the event types known to
+ *              the simulations. Every type has a dense integer ID, the value of its Event::EventType:
+ *              ARRIVAL is 0, DEPARTURE is 1, and registered types follow in the order they were registered.
+ *              The simulations and the event log look a type up with one array index instead of comparing
+ *              names. The registry holds what all simulations share, the name of a type and the layout of
+ *              its event log line ("<prefix><time right-aligned in width characters>"); what a simulation
+ *              does with an event of the type is the handler it is given (BasicBankSimulation::
+ *              setEventHandler), kept in a table of the simulation indexed by the same ID.
+ *
+ *              Registering a new event type, without changing main() or the simulation:
+ *              1. At startup, before any simulation runs or EventLogWriter starts, call add() with the
+ *                 name and the log line layout, and keep the returned Event::EventType.
+ *              2. Give each simulation that will see such events a handler for the type with
+ *                 setEventHandler. A handler receives the simulation, the event and a context pointer;
+ *                 it can read the simulation's getters and schedule further events with scheduleEvent.
+ *              3. Schedule events of the type with scheduleEvent. Like arrivals, a registered event can
+ *                 carry a length (the payload of its handler).
+ *              Simultaneous events are ordered by their IDs, so registered events come after the arrivals
+ *              and departures of their time. They are logged like the built-in types but are not written
+ *              to trace files.
+ *
+ * Class Invariant:
+ * - Types 0 to getCount() - 1 are registered, with distinct names; ARRIVAL and DEPARTURE are always
+ *   registered, with the layout of the original event log.
+ * - Entries never change once registered, so reading them needs no lock.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef EVENTTYPEREGISTRY_H
+#define EVENTTYPEREGISTRY_H
+
+#include <cstddef>
+#include "Event.h"
+
+class EventTypeRegistry {
+
+public:
+    // Most event types, built-in ones included; simulations size their handler tables by it
+    static const unsigned int MAX_TYPES = 16;
+
+    // Longest name, log line prefix and time field width of a type
+    static const std::size_t MAX_NAME_LENGTH = 31;
+    static const std::size_t MAX_PREFIX_LENGTH = 63;
+    static const int MAX_TIME_WIDTH = 16;
+
+    // Longest log line: the prefix, the time field (which a sign and ten digits also fit) and the newline
+    static const std::size_t MAX_LINE_LENGTH = MAX_PREFIX_LENGTH + MAX_TIME_WIDTH + 1;
+
+    // Structure: Entry
+    // Purpose: A registered type: its name and the layout of its log line.
+    struct Entry {
+        char name[MAX_NAME_LENGTH + 1];
+        char prefix[MAX_PREFIX_LENGTH + 1];     // Text before the time
+        std::size_t prefixLength;
+        int timeWidth;                          // Minimum width of the right-aligned time
+    };
+
+    // Description: Registers an event type and returns its ID, the next unused one.
+    // Precondition: No simulation or event log writer is running.
+    // Exceptions: Throws std::invalid_argument if the name is empty or taken, or the name, prefix or width
+    //             is longer than allowed; FullDataCollectionException if MAX_TYPES types are registered.
+    // Time Efficiency: O(t) for t registered types
+    static Event::EventType add(const char* name, const char* logPrefix, int timeWidth);
+
+    // Description: Finds the type registered under name.
+    // Returns: true and sets type if there is one.
+    // Time Efficiency: O(t)
+    static bool find(const char* name, Event::EventType& type);
+
+    // Getters
+
+    // Description: Returns the number of registered types; their IDs are 0 to getCount() - 1.
+    static unsigned int getCount();
+
+    // Description: Returns the entry of a registered type.
+    // Time Efficiency: O(1)
+    static const Entry& getEntry(Event::EventType type);
+};
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * FixedBinaryHeap.h
+ *
+ * Description: This header file defines the FixedBinaryHeap class, a templated min-heap whose capacity is
+ *              a compile-time constant. It provides the same operations as BinaryHeap, but its elements
+ *              are stored inline in a std::array instead of a dynamically allocated array, so a
+ *              FixedBinaryHeap never allocates memory and never needs to expand. It is meant for
+ *              scenarios with a known upper bound on the number of pending elements, e.g. a bank
+ *              simulation with streamed arrivals, which never has more than one pending departure per
+ *              teller plus the next arrival.
+ *
+ *              All operations but removeMinimumGroup are constexpr, so for element types that are literal
+ *              types a heap can be built, filled and emptied during constant evaluation (FixedPriorityQueue.cpp
+ *              checks this with a static_assert).
+ *
+ *              Instead of expanding, insert() returns false when the heap is full, as allowed by the
+ *              BinaryHeap interface.
+ *
+ * Class Invariant:
+ * - The binary heap maintains the heap property, where each parent node is less than or equal to
+ *   its child nodes (min-heap).
+ * - The root element is always the smallest element in the heap.
+ * - The heap never holds more than Capacity elements.
+ * - If the heap is empty, attempts to retrieve or remove an element will throw an
+ *   EmptyDataCollectionException.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef FIXEDBINARYHEAP_H
+#define FIXEDBINARYHEAP_H
+
+#include <array>
+#include <vector>
+#include "EmptyDataCollectionException.h"
+
+template<typename ElementType, unsigned int Capacity>
+class FixedBinaryHeap {
+    static_assert(Capacity > 0, "FixedBinaryHeap needs room for at least one element");
+
+    private:
+        std::array<ElementType, Capacity> elements;  // Inline storage for the heap elements
+        unsigned int elementCount;  // The number of elements currently in the heap
+
+        // Utility methods to maintain the heap property
+        constexpr void reHeapUp(unsigned int indexOfChild);
+        constexpr void reHeapDown(unsigned int indexOfRoot);
+
+    public:
+        // Constructor
+        constexpr FixedBinaryHeap();
+
+        // Description: Returns the number of elements in the Binary Heap.
+        // Postcondition: The Binary Heap is unchanged by this operation.
+        // Time Efficiency: O(1)
+        constexpr unsigned int getElementCount() const;
+
+        // Description: Returns the maximum number of elements the Binary Heap can hold.
+        // Time Efficiency: O(1)
+        static constexpr unsigned int getCapacity();
+
+        // Description: Inserts newElement into the Binary Heap.
+        //              Returns true if successful, or false if the heap is full.
+        // Time Efficiency: O(log2 n)
+        constexpr bool insert(const ElementType& newElement);
+
+        // Description: Retrieves (but does not remove) the necessary element.
+        // Precondition: This Binary Heap is not empty.
+        // Postcondition: This Binary Heap is unchanged.
+        // Exceptions: Throws EmptyDataCollectionException if this Binary Heap is empty.
+        // Time Efficiency: O(1)
+        constexpr const ElementType& retrieve() const;
+
+        // Description: Removes (but does not return) the necessary element.
+        // Precondition: This Binary Heap is not empty.
+        // Exceptions: Throws EmptyDataCollectionException if this Binary Heap is empty.
+        // Time Efficiency: O(log2 n)
+        constexpr void remove();
+
+        // Description: Removes all elements equal to the minimum element in one operation and appends
+        //              them to group, in no particular order (see BinaryHeap::removeMinimumGroup).
+        // Precondition: This Binary Heap is not empty.
+        // Exceptions: Throws EmptyDataCollectionException if this Binary Heap is empty.
+        // Time Efficiency: O(k log2 n) for k removed elements
+        void removeMinimumGroup(std::vector<ElementType>& group);
+};
+
+#include "../src/FixedBinaryHeap.cpp"
+
+#endif  // FIXEDBINARYHEAP_H
@@ -0,0 +1,80 @@
+/*
+ * FixedPriorityQueue.h
+ *
+ * Description: This header file defines the FixedPriorityQueue class, the fixed-capacity counterpart of
+ *              PriorityQueue. It offers the same operations (isEmpty, enqueue, dequeue, peek) on top of a
+ *              FixedBinaryHeap, so its elements are stored inside the object and it never allocates memory.
+ *              enqueue() returns false when the queue already holds Capacity elements.
+ *
+ *              All operations but dequeueGroup are constexpr, so the queue can be used in constant
+ *              expressions for literal element types, as a static_assert in FixedPriorityQueue.cpp checks.
+ *
+ * Class Invariant:
+ * - The element with the highest priority is always at the root of the heap.
+ * - The queue never holds more than Capacity elements.
+ * - If the priority queue is empty, attempting to dequeue or peek throws an
+ *   EmptyDataCollectionException.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef FIXEDPRIORITYQUEUE_H
+#define FIXEDPRIORITYQUEUE_H
+
+#include "EmptyDataCollectionException.h"
+#include "FixedBinaryHeap.h"
+
+template <typename ElementType, unsigned int Capacity>
+class FixedPriorityQueue {
+
+	private:
+		FixedBinaryHeap<ElementType, Capacity> minheap;  // The underlying fixed-capacity minimum binary heap
+
+	public:
+
+	// Constructor
+	constexpr FixedPriorityQueue();
+
+	// Description: Returns true if this Priority Queue is empty, otherwise false.
+	// Postcondition: This Priority Queue is unchanged by this operation.
+	// Time Efficiency: O(1)
+	constexpr bool isEmpty() const;
+
+	// Description: Returns the number of elements in this Priority Queue.
+	// Time Efficiency: O(1)
+	constexpr unsigned int getElementCount() const;
+
+	// Description: Inserts newElement in this Priority Queue and
+	//              returns true if successful, or false if the queue is full.
+	// Time Efficiency: O(log2 n)
+	constexpr bool enqueue(const ElementType& newElement);
+
+	// Description: Removes (but does not return) the element with the next
+	//              "highest" priority value from the Priority Queue.
+	// Precondition: This Priority Queue is not empty.
+	// Exception: Throws EmptyDataCollectionException if Priority Queue is empty.
+	// Time Efficiency: O(log2 n)
+	constexpr void dequeue();
+
+	// Description: Removes all elements with the next "highest" priority value in one operation and
+	//              appends them to group, in no particular order.
+	// Precondition: This Priority Queue is not empty.
+	// Exception: Throws EmptyDataCollectionException if Priority Queue is empty.
+	// Time Efficiency: O(k log2 n) for k removed elements
+	void dequeueGroup(std::vector<ElementType>& group);
+
+	// Description: Returns (but does not remove) the element with the next
+	//              "highest" priority value from the Priority Queue.
+	// Precondition: This Priority Queue is not empty.
+	// Postcondition: This Priority Queue is unchanged by this operation.
+	// Exception: Throws EmptyDataCollectionException if this Priority Queue is empty.
+	// Time Efficiency: O(1)
+	constexpr const ElementType& peek() const;
+
+ };
+
+// Include the implementation file (FixedPriorityQueue.cpp) after the class definition
+#include "../src/FixedPriorityQueue.cpp"
+
+#endif
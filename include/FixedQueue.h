@@ -0,0 +1,77 @@
+/*
+ * FixedQueue.h
+ *
+ * Description: This header file defines the FixedQueue class, the fixed-capacity counterpart of Queue.
+ *              It is a First-In-First-Out (FIFO) data structure stored as a circular buffer in a
+ *              std::array inside the object, so it never allocates memory: a FixedQueue can live on the
+ *              stack or inside another object, and copying it copies a contiguous block.
+ *
+ *              The operations are those of Queue (isEmpty, enqueue, dequeue, peek), all in constant
+ *              time. enqueue() returns false when the queue already holds Capacity elements. All
+ *              operations are constexpr, so the queue can be used in constant expressions for literal
+ *              element types, as a static_assert in FixedQueue.cpp checks.
+ *
+ * Class Invariant:
+ * - The queue is maintained in FIFO order, where the first element inserted is the first to be removed.
+ * - The front element is stored at index front; the queue's elements occupy the size slots that follow
+ *   it, wrapping around at the end of the array.
+ * - The queue never holds more than Capacity elements.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Date: Oct. 2026
+ */
+
+#ifndef FIXEDQUEUE_H
+#define FIXEDQUEUE_H
+
+#include <array>
+#include "EmptyDataCollectionException.h"
+
+template <typename ElementType, unsigned int Capacity>
+class FixedQueue {
+    static_assert(Capacity > 0, "FixedQueue needs room for at least one element");
+
+    private:
+
+    	std::array<ElementType, Capacity> elements;  // Circular buffer holding the queue's elements
+    	unsigned int front;  // Index of the front element
+    	unsigned int size;  // Number of elements in the queue
+
+    public:
+
+        // Description: Constructor that initializes an empty queue.
+        constexpr FixedQueue();
+
+	    // Description: Returns true if this Queue is empty, otherwise false.
+	    // Postcondition: This Queue is unchanged by this operation.
+	    // Time Efficiency: O(1)
+	    constexpr bool isEmpty() const;
+
+	    // Description: Returns the number of elements in this Queue.
+	    // Time Efficiency: O(1)
+	    constexpr unsigned int getElementCount() const;
+
+	    // Description: Inserts newElement at the back of this Queue.
+	    //              Returns true if successful, or false if the queue is full.
+	    // Time Efficiency: O(1)
+	    constexpr bool enqueue(const ElementType & newElement);
+
+	    // Description: Removes the element at the front of this Queue.
+	    // Precondition: This Queue is not empty.
+	    // Exception: Throws EmptyDataCollectionException if this Queue is empty.
+	    // Time Efficiency: O(1)
+	    constexpr void dequeue();
+
+	    // Description: Returns (but does not remove) the element at the front of this Queue.
+	    // Precondition: This Queue is not empty.
+	    // Postcondition: This Queue is unchanged by this operation.
+	    // Exception: Throws EmptyDataCollectionException if this Queue is empty.
+	    // Time Efficiency: O(1)
+	    constexpr const ElementType & peek() const;
+
+};
+
+// Include the implementation file (FixedQueue.cpp) after the class definition
+#include "../src/FixedQueue.cpp"
+
+#endif
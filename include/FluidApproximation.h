@@ -0,0 +1,144 @@
+/*
+ * FluidApproximation.h
+ *
+ * Description: This header file defines the FluidApproximation class, an approximate engine for volumes far
+ *              beyond what event-by-event simulation can handle. Customers are not simulated one by one:
+ *              the arrivals are counted into bins of equal width, giving a piecewise constant arrival rate
+ *              lambda(t), and the transaction lengths are summarized by their mean S (service rate mu = 1/S)
+ *              and squared coefficient of variation (SCV). The number of customers in the bank, x(t), then
+ *              follows the ordinary differential equation
+ *
+ *                  dx/dt = lambda(t) - mu * c(t) * rho(x)
+ *
+ *              where c(t) is the number of tellers on duty and rho(x) the teller utilization. A pure fluid
+ *              model would take rho(x) = min(x / c, 1), which has no line at all until the tellers are
+ *              overloaded. Instead rho(x) is the utilization at which a stationary queue holds x customers
+ *              on average (the pointwise stationary fluid flow approximation): the M/M/c queue by the Erlang
+ *              C formula, with the line scaled by (1 + SCV) / 2 as in the Allen-Cunneen approximation. This
+ *              keeps the random line of an underloaded bank and becomes the pure fluid model in overload.
+ *              The line holds x - c * rho(x) customers.
+ *
+ *              The equation is integrated piece by piece between the bin boundaries and staffing changes,
+ *              where lambda and c jump, with the Dormand-Prince 5(4) Runge-Kutta pair and step size control:
+ *              a step whose error estimate exceeds the tolerance is rejected and retried with a smaller
+ *              step, and the next step is sized from the error. After the last bin the bank drains with no
+ *              arrivals. The area under the line length is integrated along, and by Little's law it is the
+ *              total wait of all customers.
+ *
+ *              With a scale K the arrival rates and the tellers are multiplied by K, which models K
+ *              branches like the one of the trace at the cost of one. The integration cost depends on the
+ *              horizon (bins and steps), not on the number of customers; reading the trace is the only
+ *              per-customer work, and it keeps no customer in memory.
+ *
+ *              Transactions of (almost) zero length would make mu, and the equation's stiffness, unbounded;
+ *              below INSTANT_SERVICE bin widths the tellers on duty serve every customer on arrival instead.
+ *
+ *              The rho(x) of every teller count is tabulated once (O(c) per table entry for the Erlang C
+ *              recursion) and inverted by binary search and linear interpolation; beyond the table, where the
+ *              tellers are almost always busy, the line is taken to be (1 + SCV) / 2 * rho / (1 - rho).
+ *
+ * Class Invariant:
+ * - counts[k] is the number of arrivals (unscaled) in [k * binWidth, (k + 1) * binWidth).
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef FLUIDAPPROXIMATION_H
+#define FLUIDAPPROXIMATION_H
+
+#include <map>
+#include <vector>
+#include "BankSimulation.h"
+
+class FluidApproximation {
+
+public:
+    // Structure: Options
+    // Purpose: How the trace is binned and scaled and how precisely the equation is integrated.
+    struct Options {
+        int binWidth = 60;                      // Time units per arrival rate bin
+        int scale = 1;                          // Branches like the one of the trace
+        double tolerance = 1e-6;                // Relative error allowed per step
+    };
+
+    // Structure: Sample
+    // Purpose: The state of the bank at the end of a bin.
+    struct Sample {
+        double time;
+        double arrivalRate;                     // Over the bin that ends at time
+        int tellers;
+        double inBank;                          // x
+        double lineLength;                      // x - c * rho(x)
+        double wait;                            // Line length over throughput: the wait of an arrival
+    };
+
+    // Structure: Result
+    // Purpose: The outcome of an integration.
+    struct Result {
+        double customers;                       // Arrivals, scaled
+        double averageWait;                     // Total wait (area under the line length) over customers
+        double averageLineLength;               // Over [0, drainedAt]
+        double peakLineLength;
+        double peakTime;
+        double drainedAt;                       // Time the bank held less than DRAINED customers
+        unsigned long acceptedSteps;
+        unsigned long rejectedSteps;
+        std::vector<Sample> trajectory;         // One sample per bin width until drained
+    };
+
+    // Customers left in the bank when it counts as drained
+    static constexpr double DRAINED = 1e-3;
+
+    // Mean transaction length, as a fraction of the bin width, below which service counts as instantaneous:
+    // tellers on duty serve every customer on arrival and the equation, far too stiff to integrate, is skipped
+    static constexpr double INSTANT_SERVICE = 1e-3;
+
+private:
+    // Structure: Table
+    // Purpose: The customers in the bank, x, at utilizations rho[i] of a teller count.
+    struct Table {
+        std::vector<double> rho;
+        std::vector<double> inBank;
+    };
+
+    int tellers;
+    std::vector<StaffingChange> staffing;
+    Options options;
+
+    std::vector<double> counts;                 // Arrivals per bin
+    double customers;
+    double lengthSum;
+    double lengthSquares;
+
+    double serviceRate;                         // mu
+    bool instantService;                        // Whether the mean length is below INSTANT_SERVICE bins
+    double lineFactor;                          // (1 + SCV of the lengths) / 2
+    mutable std::map<int, Table> tables;        // By teller count
+
+    // Utility methods
+    const Table& tableFor(int c) const;
+    double utilization(double inBank, int c) const;
+    double inflow(double inBank, double arrivalRate, int c) const;
+    double lineLength(double inBank, int c) const;
+    void integrate(double& inBank, double& area, double& step, double from, double to, double arrivalRate, int c,
+                   Result& result) const;
+
+public:
+    // Constructor
+    // - Approximates a bank with the given tellers at the start of the day and staffing schedule (sorted by
+    //   time).
+    FluidApproximation(int tellers, const std::vector<StaffingChange>& staffing, const Options& options);
+
+    // Description: Adds a customer of the trace. Customers arriving before time 0 count in the first bin.
+    // Time Efficiency: O(1) amortized
+    void addCustomer(int arrival, int length);
+
+    // Description: Integrates the bank from time 0 until it has drained after the last bin.
+    // Precondition: At least one customer was added.
+    // Time Efficiency: O(b + s log2 m + t * m * c) for b bins, s steps, t teller counts with tables of m
+    //                  entries, and c tellers
+    Result run();
+};
+
+#endif
@@ -0,0 +1,27 @@
+/*
+ * FullDataCollectionException.h
+ *
+ * Class Description: Defines the exception that is thrown when an element cannot be added to a
+ *                    fixed-capacity data collection because the collection is full.
+ *
+ * Author: Inspired from our textbook's authors Frank M. Carrano and Tim Henry.
+ *         Copyright (c) 2013 __Pearson Education__. All rights reserved.
+ */
+ 
+#ifndef FULL_DATA_COLLECTION_EXCEPTION_H
+#define FULL_DATA_COLLECTION_EXCEPTION_H
+
+#include <stdexcept>
+#include <string>
+
+using std::string;
+using std::logic_error;
+
+class FullDataCollectionException : public logic_error {
+ 
+   public:
+      // Constructor
+      FullDataCollectionException(const string& message = "");
+   
+}; 
+#endif
@@ -0,0 +1,95 @@
+/*
+ * IndexedPriorityQueue.h
+ *
+ * Description: This header file defines the IndexedPriorityQueue class, a binary min-heap over a fixed range
+ *              of slots [0, slotCount) in which every slot holds at most one element. Besides the usual
+ *              peek and dequeue, an element can be addressed by its slot: update() inserts it or changes its
+ *              key and remove() takes it out, both in O(log2 n), because the heap keeps the position of every
+ *              slot in the heap array.
+ *
+ *              The interruptible simulation keeps one pending departure per teller in such a queue, so that
+ *              a departure cancelled by an interruption is removed from the event set immediately instead
+ *              of being left behind as a stale event.
+ *
+ *              Equal elements leave the queue in slot order.
+ *
+ * Class Invariant:
+ * - heap[0, elementCount) is a min-heap of slots ordered by (element, slot).
+ * - position[s] is the index of slot s in heap, or NOT_QUEUED if slot s holds no element.
+ * - If the queue is empty, attempting to dequeue or peek throws an EmptyDataCollectionException.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef INDEXEDPRIORITYQUEUE_H
+#define INDEXEDPRIORITYQUEUE_H
+
+#include <vector>
+#include "EmptyDataCollectionException.h"
+
+template <typename ElementType>
+class IndexedPriorityQueue {
+
+private:
+	static constexpr unsigned int NOT_QUEUED = ~0u;
+
+	unsigned int elementCount;                 // Number of occupied slots
+	std::vector<ElementType> elements;         // Element of each slot
+	std::vector<unsigned int> heap;            // Occupied slots in heap order
+	std::vector<unsigned int> position;        // Index of each slot in heap, or NOT_QUEUED
+
+	// Utility methods
+	bool precedes(unsigned int slot, unsigned int other) const;
+	void place(unsigned int index, unsigned int slot);
+	void reHeapUp(unsigned int index);
+	void reHeapDown(unsigned int index);
+
+public:
+	// Constructor
+	// - Creates an empty queue for the slots [0, slotCount).
+	explicit IndexedPriorityQueue(unsigned int slotCount = 0);
+
+	// Description: Returns true if this queue is empty, otherwise false.
+	// Time Efficiency: O(1)
+	bool isEmpty() const;
+
+	// Description: Returns the number of occupied slots.
+	// Time Efficiency: O(1)
+	unsigned int getElementCount() const;
+
+	// Description: Returns true if slot holds an element.
+	// Precondition: slot < slotCount.
+	// Time Efficiency: O(1)
+	bool contains(unsigned int slot) const;
+
+	// Description: Stores newElement in slot, replacing the slot's element if it has one.
+	// Precondition: slot < slotCount.
+	// Time Efficiency: O(log2 n)
+	void update(unsigned int slot, const ElementType& newElement);
+
+	// Description: Removes the element of slot, if it has one.
+	// Precondition: slot < slotCount.
+	// Time Efficiency: O(log2 n)
+	void remove(unsigned int slot);
+
+	// Description: Removes (but does not return) the smallest element.
+	// Exception: Throws EmptyDataCollectionException if this queue is empty.
+	// Time Efficiency: O(log2 n)
+	void dequeue();
+
+	// Description: Returns (but does not remove) the smallest element.
+	// Exception: Throws EmptyDataCollectionException if this queue is empty.
+	// Time Efficiency: O(1)
+	const ElementType& peek() const;
+
+	// Description: Returns the slot of the smallest element.
+	// Exception: Throws EmptyDataCollectionException if this queue is empty.
+	// Time Efficiency: O(1)
+	unsigned int peekSlot() const;
+};
+
+// Include the implementation file (IndexedPriorityQueue.cpp) after the class definition
+#include "../src/IndexedPriorityQueue.cpp"
+
+#endif
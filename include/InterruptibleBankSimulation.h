@@ -0,0 +1,155 @@
+/*
+ * InterruptibleBankSimulation.h
+ *
+ * Description: This header file defines the InterruptibleBankSimulation class, a bank simulation in which
+ *              tellers are not always available: they take scheduled breaks ("teller 2 is away from 720 for
+ *              30 time units") and fail at random (their terminal goes down after an exponentially
+ *              distributed up time and is repaired after an exponentially distributed repair time). Unlike
+ *              BankSimulation, whose tellers are interchangeable, every teller here has an identity: its
+ *              current customer, its pending departure and its own interruption schedule.
+ *
+ *              What happens to the customer of a teller that is interrupted depends on the policy:
+ *              - PREEMPT_RESUME: the customer goes back to the head of the bank line with the rest of the
+ *                transaction; the next free teller finishes it.
+ *              - PREEMPT_RESTART: the customer goes back to the head of the bank line and the transaction
+ *                starts over; the work done so far is lost.
+ *              - FINISH_CURRENT: the teller finishes the current customer first, and the interruption
+ *                starts (with its full duration) when that customer departs.
+ *
+ *              Every teller has at most one pending departure and at most one pending availability change
+ *              (the start or the end of an interruption), so each kind is kept in an IndexedPriorityQueue
+ *              with one slot per teller. A preempted departure is removed from its queue in O(log2 c) for
+ *              c tellers instead of being left in the event set as a stale event.
+ *
+ *              Arrivals are read from the (time-sorted) input like BankSimulation::ArrivalMode::STREAM, and
+ *              simultaneous events are processed arrivals first, then departures, then availability
+ *              changes. Without interruptions the statistics are exactly those of BankSim --stream-arrivals.
+ *              A customer's wait is all the time spent in the bank line, including the time after a
+ *              preemption.
+ *
+ * Class Invariant:
+ * - customer[t] is the customer served by teller t, or NO_CUSTOMER; departures holds slot t exactly if
+ *   customer[t] is not NO_CUSTOMER.
+ * - A teller that is down serves nobody, and transitions holds its return time.
+ * - idleCount is the number of tellers that are up and serve nobody; the bank line is empty if it is
+ *   not zero.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef INTERRUPTIBLEBANKSIMULATION_H
+#define INTERRUPTIBLEBANKSIMULATION_H
+
+#include <cstddef>
+#include <deque>
+#include <random>
+#include <vector>
+#include "Event.h"
+#include "IndexedPriorityQueue.h"
+
+class InterruptibleBankSimulation {
+
+public:
+    // Scoped enum for what happens to the customer of an interrupted teller (see the file description)
+    enum class Policy { PREEMPT_RESUME, PREEMPT_RESTART, FINISH_CURRENT };
+
+    // Structure: Interruption
+    // Purpose: A scheduled interruption: teller (numbered from 0) is unavailable from time for duration.
+    struct Interruption {
+        int time;
+        int duration;
+        int teller;
+    };
+
+private:
+    static constexpr std::size_t NO_CUSTOMER = ~static_cast<std::size_t>(0);
+
+    const std::vector<Event>* arrivals;          // The customers' arrival events, sorted by time (not owned)
+    int tellers;                                 // Number of tellers
+    Policy policy;                               // Handling of interrupted customers
+
+    // Interruption sources
+    std::vector<Interruption> schedule;          // Scheduled interruptions, sorted by teller and time
+    std::vector<std::size_t> scheduleEnd;        // End of each teller's slice of schedule
+    bool failures;                               // Whether tellers fail at random
+    double meanTimeBetweenFailures;
+    double meanTimeToRepair;
+    std::mt19937_64 generator;                   // Random up and repair times
+
+    // State of each customer
+    std::vector<int> remaining;                  // Transaction time still to be served
+    std::vector<int> enqueuedAt;                 // Time the customer last entered the bank line
+    std::vector<int> serviceStart;               // Time the customer's current service started
+    std::vector<long long> waitTime;             // Time spent in the bank line so far
+    std::deque<std::size_t> bankLine;            // Customers waiting for a teller
+    std::size_t nextArrival;                     // Index of the next arrival not yet in the simulation
+
+    // State of each teller
+    std::vector<std::size_t> customer;           // Customer being served, or NO_CUSTOMER
+    std::vector<unsigned char> down;             // Whether the teller is interrupted
+    std::vector<int> downSince;                  // Start of the current interruption
+    std::vector<int> pendingDuration;            // Interruption waiting for the current customer (FINISH_CURRENT)
+    std::vector<std::size_t> nextScheduled;      // Next scheduled interruption of the teller
+    std::vector<int> nextFailure;                // Time of the teller's next random failure
+    int idleCount;                               // Tellers that are up and serve nobody
+
+    IndexedPriorityQueue<int> departures;        // Departure time of each busy teller
+    IndexedPriorityQueue<int> transitions;       // Next interruption start or end of each teller
+
+    // Statistics
+    int simulationTime;
+    int customerCount;
+    long long cumulativeWaitTime;
+    long long longestWait;
+    unsigned long long eventsProcessed;
+    unsigned long long scheduledInterruptions;
+    unsigned long long randomInterruptions;
+    unsigned long long preemptions;
+    long long lostServiceTime;
+    long long unavailableTime;
+
+    // Utility methods
+    int draw(double mean);
+    void scheduleNextInterruption(int teller);
+    void processArrival();
+    void processDeparture();
+    void processTransition();
+    void interrupt(int teller, int time, int duration);
+    void goDown(int teller, int time, int duration);
+    void serveWaiting(int time);
+
+public:
+    // Constructor
+    // - Creates a simulation of the given arrival events (sorted by time) with the given number of tellers,
+    //   none of which is ever interrupted until setSchedule or setFailures is called.
+    InterruptibleBankSimulation(const std::vector<Event>& arrivals, int tellers, Policy policy);
+
+    // Description: Sets the scheduled interruptions. Overlapping interruptions of a teller merge into one.
+    // Precondition: Every teller number is in [0, tellers) and every duration is positive.
+    void setSchedule(const std::vector<Interruption>& interruptions);
+
+    // Description: Makes every teller fail at random: up times and repair times are exponentially
+    //              distributed with the given means (rounded up to whole time units, keeping the means),
+    //              drawn from a generator seeded with seed, so a run is reproducible.
+    void setFailures(double meanTimeBetweenFailures, double meanTimeToRepair, unsigned long long seed);
+
+    // Description: Processes all events until every customer has departed.
+    void run();
+
+    // Getters
+    // - getUnavailableTime is the teller time lost to interruptions until the last customer left.
+    int getSimulationTime() const;
+    int getCustomerCount() const;
+    long long getCumulativeWaitTime() const;
+    float getAverageWaitTime() const;
+    long long getLongestWait() const;
+    unsigned long long getEventsProcessed() const;
+    unsigned long long getScheduledInterruptions() const;
+    unsigned long long getRandomInterruptions() const;
+    unsigned long long getPreemptions() const;
+    long long getLostServiceTime() const;
+    long long getUnavailableTime() const;
+};
+
+#endif
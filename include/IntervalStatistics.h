@@ -0,0 +1,135 @@
+/*
+ * IntervalStatistics.h
+ *
+ * Description: This header file defines the IntervalStatistics class, which reports the behaviour of a
+ *              simulation during the day rather than only at the end. The day is divided into intervals
+ *              of a fixed length; for each interval one row is written with the number of arrivals,
+ *              departures and services started, the mean and maximum wait of the customers whose
+ *              service started in the interval, the time-weighted mean and the maximum length of the
+ *              bank line, and the teller utilization (busy teller time over on-duty teller time).
+ *
+ *              The simulation reports every change as it happens (advanceTo, recordArrival, ...). All
+ *              accumulators are plain counters and time integrals, so recording an event and starting a
+ *              new interval both take constant time. Rows are formatted into a block buffer that is
+ *              written to the output stream in one call when it fills up.
+ *
+ *              Rows are written as CSV text (with a header line) or as binary records of type Row in the
+ *              machine's byte order.
+ *
+ * Class Invariant:
+ * - Intervals are [intervalStart, intervalStart + intervalLength); intervalStart is a multiple of
+ *   intervalLength.
+ * - The time integrals cover the current interval from its start up to lastTime.
+ * - Every interval from the first event up to the last one produces exactly one row, even if empty.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef INTERVALSTATISTICS_H
+#define INTERVALSTATISTICS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+class IntervalStatistics {
+
+public:
+    // Scoped enum for the output format of the rows
+    // - CSV: One line of comma-separated text per interval, after a header line.
+    // - BINARY: One Row record per interval.
+    enum class Format { CSV, BINARY };
+
+    // Structure: Row
+    // Purpose: The statistics of one interval, also the record layout of the binary format (40 bytes).
+    struct Row {
+        std::int32_t start;          // First time of the interval
+        std::int32_t end;            // End of the interval (the last event time for the final interval)
+        std::uint32_t arrivals;      // Customers who arrived
+        std::uint32_t departures;    // Customers who departed
+        std::uint32_t served;        // Customers whose service started
+        std::int32_t maxWait;        // Longest wait of the customers served
+        std::uint32_t maxQueue;      // Longest bank line
+        float meanWait;              // Mean wait of the customers served (0 if none)
+        float meanQueue;             // Time-weighted mean length of the bank line
+        float utilization;           // Busy teller time divided by on-duty teller time (0 if none on duty)
+    };
+
+private:
+    std::FILE* out;                  // Output stream the rows are written to
+    Format format;                   // Output format of the rows
+    int intervalLength;              // Length of every interval in time units
+    std::vector<char> block;         // Rows formatted but not yet written
+    std::size_t used;                // Number of bytes of block in use
+    unsigned long long rowCount;     // Number of rows produced so far
+
+    bool started;                    // True once the first interval has been opened
+    bool finished;                   // True once finish() has written the last row
+    int intervalStart;               // Start time of the current interval
+    int lastTime;                    // Time up to which the integrals have been accumulated
+
+    // State of the simulation since lastTime
+    unsigned int queueLength;        // Customers in the bank line
+    int tellersBusy;                 // Tellers serving a customer
+    int tellersOnDuty;               // Tellers working
+
+    // Accumulators of the current interval
+    unsigned int arrivals;
+    unsigned int departures;
+    unsigned int served;
+    long long waitSum;
+    int maxWait;
+    unsigned int maxQueue;
+    long long queueArea;             // Integral of the bank line length over time
+    long long busyArea;              // Integral of the busy tellers over time
+    long long dutyArea;              // Integral of the tellers on duty over time
+
+    // Utility methods
+    void integrate(int time);
+    void closeInterval(int end);
+    void writeRow(const Row& row);
+    void writeBlock();
+
+public:
+    // Constructor
+    // - Rows of intervalLength time units are written to out (which is not closed by this object).
+    // - blockSize is the size in bytes of the buffer handed to each write call.
+    // - In Format::CSV the header line is written first.
+    IntervalStatistics(std::FILE* out, int intervalLength, Format format = Format::CSV, std::size_t blockSize = 1 << 16);
+
+    // Destructor
+    // - Calls finish() if it has not been called yet.
+    ~IntervalStatistics();
+
+    // Description: Advances the clock to time, writing a row for every interval that ends at or before it.
+    //              Must be called before the changes made at time are recorded.
+    // Time Efficiency: O(1) plus O(1) per interval closed
+    void advanceTo(int time);
+
+    // Description: Counts an arrival in the current interval.
+    void recordArrival();
+
+    // Description: Counts a departure in the current interval.
+    void recordDeparture();
+
+    // Description: Counts a customer whose service starts after waiting for wait time units.
+    void recordServiceStart(int wait);
+
+    // Description: Records the state of the simulation after the changes made at the current time.
+    void setState(unsigned int queueLength, int tellersBusy, int tellersOnDuty);
+
+    // Description: Writes the row of the last (partial) interval, which ends at the last time seen,
+    //              and flushes the output stream.
+    void finish();
+
+    // Description: Returns the number of rows produced so far.
+    unsigned long long getRowCount() const;
+
+    // The statistics own a write buffer that is flushed once, so they cannot be copied
+    IntervalStatistics(const IntervalStatistics&) = delete;
+    IntervalStatistics& operator=(const IntervalStatistics&) = delete;
+};
+
+#endif
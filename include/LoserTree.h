@@ -0,0 +1,106 @@
+/*
+ * LoserTree.h
+ *
+ * Description: This header file defines the LoserTree class, an event set made of independent sources merged
+ *              by a tournament tree. Each source (a slot, e.g. one teller) holds at most one element; the
+ *              sources are the leaves of a complete binary tree whose internal nodes record the result of
+ *              the match between their two subtrees: the winner (smaller element) moves up and the loser is
+ *              kept in the node. The overall winner is the next element to leave the set.
+ *
+ *              In the bank simulation every teller has at most one pending departure, and arrivals come
+ *              from an ordered stream, so the departures of c tellers only need a tree over c slots
+ *              instead of one global heap; the arrival stream plays the final match against the tree's
+ *              winner. The typical operation is "the winner departs and its teller starts serving the
+ *              next customer": dequeue() only vacates the winner's slot, and the enqueue() that follows
+ *              refills that slot and replays the matches on its path to the root against the stored
+ *              losers, one comparison per level. An element entering an idle slot (a teller that was not
+ *              the winner) replays its path against the winners of the sibling subtrees, again one
+ *              comparison per level.
+ *
+ *              The class offers the PriorityQueue operations (isEmpty, enqueue, dequeue, dequeueGroup,
+ *              peek), so it can be used as the event set of a BasicBankSimulation. When every slot is
+ *              busy the tree doubles its number of slots.
+ *
+ *              Simultaneous elements leave the set in slot order.
+ *
+ * Class Invariant:
+ * - The tree has leafCount >= 2 leaves (a power of two); slot s is leaf leafCount + s.
+ * - For every internal node n, winners[n] is the slot winning the matches of n's subtree and losers[n]
+ *   the slot that lost the match at n. Empty slots lose against occupied ones.
+ * - While pendingSlot is set, the tree still reflects the element that was removed from pendingSlot.
+ * - If the set is empty, attempting to dequeue or peek throws an EmptyDataCollectionException.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef LOSERTREE_H
+#define LOSERTREE_H
+
+#include <vector>
+#include "EmptyDataCollectionException.h"
+
+template <typename ElementType>
+class LoserTree {
+
+private:
+	static const unsigned int NO_SLOT = ~0u;
+
+	unsigned int leafCount;                            // Number of slots (a power of two, at least 2)
+	unsigned int elementCount;                         // Number of occupied slots
+	std::vector<ElementType> elements;                 // Element of each slot
+	std::vector<unsigned char> occupied;               // Whether each slot holds an element
+
+	// The tree is brought up to date lazily after a dequeue, so these change even in const operations
+	mutable std::vector<unsigned int> winners;         // Winning slot of each internal node (index 1 is the root)
+	mutable std::vector<unsigned int> losers;          // Losing slot of each internal node
+	mutable std::vector<unsigned int> freeSlots;       // Empty slots not reserved by pendingSlot
+	mutable unsigned int pendingSlot;                  // Slot vacated by the last dequeue, or NO_SLOT
+
+	// Utility methods
+	bool beats(unsigned int slot, unsigned int other) const;
+	unsigned int winnerOf(unsigned int node) const;
+	void replayWinner(unsigned int slot) const;
+	void replayPath(unsigned int slot) const;
+	void playMatch(unsigned int node) const;
+	void settle() const;
+	void grow();
+
+public:
+	// Constructor
+	// - Creates an empty set with room for capacity elements before it has to grow.
+	LoserTree(unsigned int capacity = 2);
+
+	// Description: Returns true if this set is empty, otherwise false.
+	// Time Efficiency: O(1)
+	bool isEmpty() const;
+
+	// Description: Returns the number of elements in this set.
+	// Time Efficiency: O(1)
+	unsigned int getElementCount() const;
+
+	// Description: Inserts newElement into a free slot and returns true. Right after a dequeue, the slot
+	//              vacated by it is reused.
+	// Time Efficiency: O(log2 c) for c slots (amortized when the tree has to grow)
+	bool enqueue(const ElementType& newElement);
+
+	// Description: Removes (but does not return) the smallest element.
+	// Exception: Throws EmptyDataCollectionException if this set is empty.
+	// Time Efficiency: O(1); the matches are replayed by the next operation
+	void dequeue();
+
+	// Description: Removes all elements equal to the smallest element and appends them to group, in slot order.
+	// Exception: Throws EmptyDataCollectionException if this set is empty.
+	// Time Efficiency: O(k log2 c) for k removed elements
+	void dequeueGroup(std::vector<ElementType>& group);
+
+	// Description: Returns (but does not remove) the smallest element.
+	// Exception: Throws EmptyDataCollectionException if this set is empty.
+	// Time Efficiency: O(1), or O(log2 c) right after a dequeue
+	const ElementType& peek() const;
+};
+
+// Include the implementation file (LoserTree.cpp) after the class definition
+#include "../src/LoserTree.cpp"
+
+#endif
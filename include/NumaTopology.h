@@ -0,0 +1,47 @@
+/*
+ * NumaTopology.h
+ *
+ * Description: This header file declares small helpers for running simulation workers on machines with
+ *              several NUMA nodes (e.g. dual-socket servers). Memory is placed on the node of the CPU that
+ *              first touches it, so a worker thread that is pinned to the CPUs of one node and allocates
+ *              its own data keeps all of its memory accesses local.
+ *
+ *              The node layout is read from /sys/devices/system/node on Linux and restricted to the CPUs
+ *              this process may run on. On other systems, or if the information is unavailable, all CPUs
+ *              are reported as a single node and pinning is a no-op, so callers need no special cases.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef NUMATOPOLOGY_H
+#define NUMATOPOLOGY_H
+
+#include <cstddef>
+#include <vector>
+
+// Structure: NumaNode
+// Purpose: One NUMA node and the CPUs of that node this process is allowed to use.
+struct NumaNode {
+    int id;                 // Node number as reported by the operating system
+    std::vector<int> cpus;  // Usable CPUs of the node, in increasing order
+};
+
+// Function: discoverNumaNodes
+// Purpose: Returns the NUMA nodes that have at least one usable CPU, in increasing node order.
+//          Always returns at least one node.
+std::vector<NumaNode> discoverNumaNodes();
+
+// Function: pinCurrentThread
+// Purpose: Restricts the calling thread to run on cpu.
+// Returns: true if the thread was pinned, otherwise false (unsupported or not permitted).
+bool pinCurrentThread(int cpu);
+
+// Function: adviseHugePages
+// Purpose: Asks the operating system to back the memory range [address, address + bytes) with transparent
+//          huge pages. Only the part of the range made of whole pages is affected, and a huge page only
+//          backs a huge-page-aligned part of it, so the range should be aligned to the huge page size; the
+//          advice has to be given before the memory is first touched to take effect immediately.
+void adviseHugePages(void* address, std::size_t bytes);
+
+#endif
@@ -50,6 +50,10 @@ class PriorityQueue {
 	
 	// Constructor
 	PriorityQueue();
+
+	// Constructor with the initial capacity of the underlying binary heap
+	// - Reserving the expected number of elements up front avoids repeated expansion.
+	explicit PriorityQueue(unsigned int capacity);
 	
 	// Destructor
 	~PriorityQueue();
@@ -72,6 +76,13 @@ class PriorityQueue {
 	// Time Efficiency: O(log2 n)
 	void dequeue();
 
+	// Description: Removes all elements with the next "highest" priority value (those equal to
+	//              the front element) in one operation and appends them to group, in no particular order.
+	// Precondition: This Priority Queue is not empty.
+	// Exception: Throws EmptyDataCollectionException if Priority Queue is empty.
+	// Time Efficiency: O(k log2 n) for k removed elements
+	void dequeueGroup(std::vector<ElementType>& group);
+
 	// Description: Returns (but does not remove) the element with the next 
 	//              "highest" priority value from the Priority Queue.
 	// Precondition: This Priority Queue is not empty.
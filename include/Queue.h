@@ -59,6 +59,12 @@ class Queue {
         // Description: Constructor that initializes an empty queue.
         Queue();
 	
+	    // Description: Copy constructor that creates an independent copy of rhs, in the same order.
+	    Queue(const Queue& rhs);
+
+	    // Description: Copy assignment operator that replaces this queue with a copy of rhs.
+	    Queue& operator=(const Queue& rhs);
+
 	    // Description: Destructor that frees all nodes in the queue.
 	    ~Queue();
 	 
@@ -0,0 +1,83 @@
+/*
+ * ReplicationRunner.h
+ *
+ * Description: This header file defines the ReplicationRunner class, which runs many independent
+ *              replications of a simulation scenario on several worker threads and reports the
+ *              throughput achieved on each NUMA node.
+ *
+ *              In NUMA-aware mode each worker thread is pinned to one CPU, with workers spread round-robin
+ *              over the NUMA nodes. After pinning, the worker makes its own copies of the arrival events and
+ *              the staffing schedule and constructs every replication's simulation (event priority queue
+ *              and bank line) itself, so by the first-touch policy all of the memory a worker uses lives on
+ *              its local node. Large
+ *              event priority queue arrays can additionally be aligned to and backed by transparent huge
+ *              pages.
+ *
+ *              Without NUMA-aware mode the workers are left to the scheduler and share the caller's arrival
+ *              events, which is the behaviour to compare against.
+ *
+ * Class Invariant:
+ * - The arrival events and staffing schedule passed to the constructor outlive the runner.
+ * - Replications are handed out dynamically, so every replication is run exactly once.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef REPLICATIONRUNNER_H
+#define REPLICATIONRUNNER_H
+
+#include <vector>
+#include "BankSimulation.h"
+#include "Event.h"
+
+class ReplicationRunner {
+
+public:
+    // Structure: Options
+    // Purpose: How the replications are executed.
+    struct Options {
+        unsigned int replications = 1;        // Number of replications to run
+        unsigned int threads = 1;             // Number of worker threads
+        bool numaAware = false;               // Pin workers and place their data on their local node
+        bool hugePages = false;               // Advise transparent huge pages for large heap arrays
+        BankSimulation::ArrivalMode arrivalMode = BankSimulation::ArrivalMode::PRELOAD;
+    };
+
+    // Structure: NodeReport
+    // Purpose: What the workers of one NUMA node achieved.
+    struct NodeReport {
+        int node;                             // NUMA node number
+        unsigned int threads;                 // Worker threads pinned to the node
+        unsigned int replications;            // Replications completed on the node
+        unsigned long long events;            // Events processed on the node
+        double busySeconds;                   // Sum of the workers' busy times on the node
+    };
+
+    // Structure: Report
+    // Purpose: The outcome of a set of replications.
+    struct Report {
+        std::vector<NodeReport> nodes;        // Per-node results (one entry without NUMA-aware mode)
+        double wallSeconds;                   // Wall-clock time of the whole run
+        unsigned long long events;            // Events processed by all replications
+        int customerCount;                    // Customers processed per replication
+        float averageWaitTime;                // Average wait time of the first replication
+        bool consistent;                      // True if every replication produced the same statistics
+    };
+
+private:
+    const std::vector<Event>& arrivals;                 // Arrival events of the scenario
+    int tellers;                                        // Tellers on duty at the start of the day
+    const std::vector<StaffingChange>& staffing;        // Staffing schedule of the scenario
+
+public:
+    // Constructor
+    // - In ArrivalMode::STREAM the arrivals must be sorted by time.
+    ReplicationRunner(const std::vector<Event>& arrivals, int tellers, const std::vector<StaffingChange>& staffing);
+
+    // Description: Runs options.replications replications on options.threads worker threads.
+    // Postcondition: Returns per-node throughput and the replications' statistics.
+    Report run(const Options& options) const;
+};
+
+#endif
@@ -0,0 +1,131 @@
+/*
+ * ResultCache.h
+ *
+ * Description: This header file defines the classes of the on-disk result cache, which lets a repeated run
+ *              (same engine, same options, same input) replay the output of the first one instead of
+ *              parsing and simulating again:
+ *              - ResultCache::KeyBuilder hashes everything a run's output depends on into a 128-bit key: the
+ *                bytes of the executable (so that a rebuilt engine never sees the results of an old one),
+ *                the options, standard input and the files the options name.
+ *              - ResultCache stores one entry file per key in a directory. An entry holds the standard
+ *                output and standard error of the run with a checksum; an entry that is truncated or
+ *                corrupt is treated as missing. Whether the event log is stored depends on the run: a
+ *                --quiet run stores the statistics only.
+ *              - OutputRecorder passes everything written to a stream on and keeps a copy of it.
+ *
+ *              Entries are written to a temporary file first and then renamed, which is atomic, so that
+ *              concurrent processes sharing the directory see either no entry or a whole one. After every
+ *              store the least recently used entries (by modification time, which a hit refreshes) are
+ *              deleted until the directory fits its capacity. A process that deletes an entry another one
+ *              is reading does no harm: the reader keeps the open file.
+ *
+ * Class Invariant:
+ * - An entry file is named after its key and holds the output of a run with that key.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <streambuf>
+#include <string>
+
+class ResultCache {
+
+public:
+    // Structure: Key
+    // Purpose: The 128-bit hash of everything a run's output depends on.
+    struct Key {
+        std::uint64_t high;
+        std::uint64_t low;
+    };
+
+    // Class: KeyBuilder
+    // Purpose: Hashes the parts of a key in order. Every part is hashed with its length, so that
+    //          ("ab", "c") and ("a", "bc") give different keys. The two halves of the key are independent
+    //          hash chains over 8-byte words.
+    class KeyBuilder {
+        std::uint64_t high;
+        std::uint64_t low;
+
+    public:
+        KeyBuilder();
+
+        // Description: Adds size bytes at data to the key.
+        // Time Efficiency: O(size)
+        void add(const void* data, std::size_t size);
+        void add(const std::string& text);
+
+        // Description: Adds the contents of the file at path, or a marker if it cannot be read.
+        // Returns: true if the file was read.
+        // Time Efficiency: O(size of the file)
+        bool addFile(const char* path);
+
+        Key finish() const;
+    };
+
+    // Structure: Entry
+    // Purpose: The output of a run.
+    struct Entry {
+        std::string output;                 // Standard output
+        std::string errors;                 // Standard error
+    };
+
+private:
+    std::string directory;
+    std::uint64_t capacity;                 // Bytes the entry files may use together
+
+    // Utility methods
+    std::string pathOf(const Key& key) const;
+    void evict() const;
+
+public:
+    // Constructor
+    // - Uses directory (created if missing) for entries of at most capacity bytes in total.
+    ResultCache(const std::string& directory, std::uint64_t capacity);
+
+    // Description: Reads the entry of key into entry and marks it as recently used.
+    // Returns: true on a hit, false if there is no valid entry.
+    // Time Efficiency: O(size of the entry)
+    bool lookup(const Key& key, Entry& entry) const;
+
+    // Description: Atomically writes the entry of key, replacing any old one, then evicts the least
+    //              recently used entries until the directory fits its capacity. An entry larger than the
+    //              whole capacity is not written, since it would only evict every other entry and itself.
+    // Returns: false if the entry could not be written (an entry too large for the cache is not an error).
+    // Time Efficiency: O(size of the entry + e log2 e) for e entries in the directory
+    bool store(const Key& key, const Entry& entry) const;
+};
+
+class OutputRecorder : public std::streambuf {
+    std::streambuf* target;
+    std::string recorded;
+    std::size_t limit;                      // Bytes to record at most
+    bool truncated;                         // Whether more than limit bytes were written
+    char buffer[4096];
+
+    // Description: Passes the buffered characters on to target and appends them to recorded, unless that
+    //              would exceed the limit: then the recording is dropped and the recorder is truncated.
+    bool flushBuffer();
+
+protected:
+    int_type overflow(int_type c) override;
+    int sync() override;
+
+public:
+    // Constructor
+    // - Records up to limit bytes of what is written through this buffer and passes all of it on to target.
+    OutputRecorder(std::streambuf* target, std::size_t limit);
+
+    // Description: Returns everything written so far, or nothing if the recorder is truncated.
+    const std::string& getRecorded();
+
+    // Description: Returns true if more than limit bytes were written, so that the recording is incomplete.
+    bool isTruncated();
+};
+
+#endif
@@ -0,0 +1,120 @@
+/*
+ * RetrialBankSimulation.h
+ *
+ * Description: This header file defines the RetrialBankSimulation class, a bank simulation whose line has a
+ *              finite capacity. A customer who finds every teller busy and the line full is blocked: they
+ *              leave, join the orbit of blocked customers, and try again later. A retrying customer is served
+ *              or queues like a new arrival if there is room, and otherwise goes back to the orbit.
+ *
+ *              Retrial delays are exponentially distributed with a given mean, so the orbit is simulated as
+ *              one aggregated process instead of one pending event per blocked customer: with n customers in
+ *              the orbit the next retrial of any of them comes after an exponential time with mean
+ *              mean / n, and by memorylessness it is a uniformly chosen orbit customer who retries. The orbit
+ *              is a plain array of customer indices (the retrying customer is swapped with the last one and
+ *              removed), and the time of the next retrial is a single number, redrawn whenever n changes.
+ *
+ *              The orbit runs on a continuous clock: a retrial at continuous time a takes effect at the whole
+ *              time unit ceil(a), like every other event, and before the arrivals and departures of that time
+ *              unit. The next retrial is drawn from a itself, so several retrials can fall in the same time
+ *              unit. The continuous clock is not capped: a retrial drawn past INT_MAX, the last time an event can
+ *              have, never takes effect, and customers still in the orbit when nothing else is left to happen
+ *              end the day unserved. Simultaneous arrivals and departures are processed arrivals first, as in
+ *              BankSim --stream-arrivals, whose statistics are reproduced exactly when nobody is blocked.
+ *
+ * Class Invariant:
+ * - A customer is in at most one of: the line, the orbit, service. The line holds at most capacity customers
+ *   and is empty while a teller is free.
+ * - nextRetrialAt is the continuous time of the next retrial if the orbit is not empty.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef RETRIALBANKSIMULATION_H
+#define RETRIALBANKSIMULATION_H
+
+#include <cstddef>
+#include <random>
+#include <vector>
+#include "Event.h"
+#include "PriorityQueue.h"
+#include "Queue.h"
+
+class RetrialBankSimulation {
+
+private:
+    const std::vector<Event>* arrivals;         // The customers' arrival events, sorted by time (not owned)
+    int tellers;                                // Number of tellers on duty
+    int capacity;                               // Most customers waiting in the line
+    double meanRetrialDelay;                    // Mean time a blocked customer stays away
+    std::mt19937_64 generator;                  // Retrial times and retrying customers
+
+    std::size_t nextArrival;                    // Next customer to arrive for the first time
+    PriorityQueue<Event> departures;            // Pending departures
+    Queue<std::size_t> line;                    // Customers waiting for a teller
+    int lineLength;
+    int tellersBusy;
+    std::vector<std::size_t> orbit;             // Blocked customers who will retry, in no particular order
+    double nextRetrialAt;                       // Continuous time of the next retrial
+
+    int simulationTime;
+    unsigned long long eventsProcessed;
+    int customerCount;                          // Customers served
+    long long cumulativeWaitTime;               // From first arrival to service start, orbit time included
+    int longestWait;
+    unsigned long long blockedArrivals;         // First attempts that found the line full
+    unsigned long long retrials;
+    unsigned long long blockedRetrials;
+    std::size_t largestOrbit;
+    double orbitArea;                           // Integral of the orbit size over time
+    int orbitAreaTime;                          // Time up to which orbitArea is accumulated
+
+    // Utility methods
+    bool admit(std::size_t customer, bool retrial, double from);
+    void processArrival();
+    void processRetrial();
+    void processDeparture();
+    void startService(std::size_t customer);
+    void joinOrbit(std::size_t customer, double from);
+    void drawNextRetrial(double from);
+    void accumulateOrbit(int time);
+    bool retrialPending() const;
+    int nextRetrialTime() const;
+
+public:
+    // Constructor
+    // - Creates a simulation of arrivals (sorted by time, must outlive the simulation) with the given tellers
+    //   and line capacity (0: a customer who cannot be served at once is blocked). Blocked customers retry
+    //   after exponential delays with mean meanRetrialDelay; the generator is seeded with seed.
+    RetrialBankSimulation(const std::vector<Event>& arrivals, int tellers, int capacity, double meanRetrialDelay,
+                          unsigned long long seed);
+
+    // Description: Processes all events until every customer has been served.
+    // Time Efficiency: O(e log2 c) for e events and c tellers
+    void run();
+
+    // Getters
+    // - Waits run from a customer's first arrival, so they include the time spent in the orbit.
+    int getSimulationTime() const;
+    unsigned long long getEventsProcessed() const;
+    int getCustomerCount() const;
+    float getAverageWaitTime() const;
+    int getLongestWait() const;
+    unsigned long long getBlockedArrivals() const;
+    unsigned long long getRetrials() const;
+    unsigned long long getBlockedRetrials() const;
+    std::size_t getLargestOrbit() const;
+
+    // Description: Returns the number of customers left in the orbit because their retrial would come after
+    //              INT_MAX (0 unless the day ends close to INT_MAX).
+    std::size_t getUnservedCustomers() const;
+
+    // Description: Returns the fraction of first arrivals that were blocked.
+    double getBlockingProbability() const;
+
+    // Description: Returns the time-average number of customers in the orbit, from the first arrival to the
+    //              end of the run.
+    double getAverageOrbitSize() const;
+};
+
+#endif
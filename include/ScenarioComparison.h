@@ -0,0 +1,131 @@
+/*
+ * ScenarioComparison.h
+ *
+ * Description: This header file defines the classes that compare staffing alternatives on random days of
+ *              customers with variance reduction:
+ *              - RandomStreams gives every random variate of the model its own substream: the uniform for
+ *                the interarrival time (or the service time) of customer i in replication r is a pure
+ *                function of (seed, r, i, variate), computed by hashing the key. Variates therefore do not
+ *                depend on the order in which they are drawn or on how many were drawn before, so the
+ *                streams stay synchronized whatever the configuration does with the customers.
+ *              - ScenarioComparison simulates each replication's day of customers (exponential
+ *                interarrival and service times, rounded to whole time units) under every scenario with
+ *                BankSimulation and compares the average waits. With common random numbers every scenario
+ *                of a replication sees the same customers; otherwise every scenario draws from substreams
+ *                of its own. With antithetic variates, replications come in pairs whose second day uses
+ *                1 - u for every uniform u of the first, and each pair is averaged into one observation.
+ *
+ *              The report gives each scenario's mean average wait and each scenario's difference to the
+ *              first one, with 95% confidence intervals. It also gives the variance reduction achieved for
+ *              each difference: the variance that independent streams would give with as many replications
+ *              (estimated from the per-scenario variances) over the variance obtained. A reduction of 8
+ *              means that independent streams would need 8 times as many replications for the same
+ *              precision.
+ *
+ * Class Invariant:
+ * - With antithetic variates the number of replications is even.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef SCENARIOCOMPARISON_H
+#define SCENARIOCOMPARISON_H
+
+#include <cstdint>
+#include <vector>
+#include "BankSimulation.h"
+
+class RandomStreams {
+
+public:
+    // Scoped enum for the variates of a customer, each drawn from its own substream
+    enum class Variate : std::uint64_t { INTERARRIVAL = 1, SERVICE = 2 };
+
+private:
+    std::uint64_t seed;
+
+public:
+    // Constructor
+    explicit RandomStreams(std::uint64_t seed);
+
+    // Description: Returns the uniform in (0, 1) of the given variate of customer in replication (and
+    //              stream, which separates otherwise identical keys, e.g. scenarios with independent streams).
+    // Time Efficiency: O(1)
+    double uniform(std::uint64_t stream, std::uint64_t replication, std::uint64_t customer, Variate variate) const;
+};
+
+class ScenarioComparison {
+
+public:
+    // Structure: Model
+    // Purpose: The random day of customers every scenario is simulated on.
+    struct Model {
+        double meanInterarrivalTime = 1;
+        double meanServiceTime = 1;
+        int customers = 1000;                   // Customers per day
+    };
+
+    // Structure: Scenario
+    // Purpose: A staffing alternative: the tellers at the start of the day and the staffing changes after.
+    struct Scenario {
+        int tellers;
+        std::vector<StaffingChange> staffing;
+    };
+
+    // Structure: Options
+    // Purpose: How the scenarios are replicated.
+    struct Options {
+        unsigned int replications = 20;         // Days simulated per scenario
+        bool commonRandomNumbers = true;        // Every scenario sees the same customers
+        bool antithetic = false;                // Replications come in antithetic pairs
+        std::uint64_t seed = 1;
+    };
+
+    // Structure: ScenarioSummary
+    // Purpose: The mean of a scenario's average waits over the observations.
+    struct ScenarioSummary {
+        double meanWait;
+        double halfWidth;                       // Half-width of the 95% confidence interval
+    };
+
+    // Structure: DifferenceSummary
+    // Purpose: The difference of a scenario's average wait to the first scenario's.
+    struct DifferenceSummary {
+        double meanDifference;
+        double halfWidth;
+        double variance;                        // Variance of the mean difference obtained
+        double independentVariance;             // Variance with independent streams and as many replications
+        double reduction;                       // independentVariance / variance
+    };
+
+    // Structure: Report
+    // Purpose: The outcome of a comparison.
+    struct Report {
+        std::vector<ScenarioSummary> scenarios;
+        std::vector<DifferenceSummary> differences;     // One per scenario after the first
+        unsigned int observations;                      // Replications, or antithetic pairs
+        unsigned long long events;                      // Events processed by all simulations
+    };
+
+private:
+    Model model;
+    std::vector<Scenario> scenarios;
+
+    // Utility methods
+    void generateDay(const RandomStreams& streams, std::uint64_t stream, std::uint64_t replication, bool antithetic,
+                     std::vector<Event>& arrivals) const;
+    double simulate(const Scenario& scenario, const std::vector<Event>& arrivals, unsigned long long& events) const;
+
+public:
+    // Constructor
+    // - Creates a comparison of scenarios (at least two) on days of the model.
+    ScenarioComparison(const Model& model, const std::vector<Scenario>& scenarios);
+
+    // Description: Simulates options.replications days under every scenario and summarizes them.
+    // Precondition: With options.antithetic, options.replications is even.
+    // Time Efficiency: O(s * r * n log2 n) for s scenarios, r replications and n customers per day
+    Report run(const Options& options) const;
+};
+
+#endif
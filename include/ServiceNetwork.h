@@ -0,0 +1,185 @@
+/*
+ * ServiceNetwork.h
+ *
+ * Description: This header file defines the ServiceNetwork class, which simulates customers moving through a
+ *              network of service stations: a teller, then perhaps a loan officer, then perhaps a manager.
+ *              Every station has its own servers and its own FIFO line. Customers enter at the first station;
+ *              when a service ends the customer moves on (without delay) to the next station of their route
+ *              or leaves the bank:
+ *              - A customer with a route from the input visits exactly the stations of the route, with the
+ *                given transaction lengths.
+ *              - Any other customer is routed at random: from station s to station t with the probability
+ *                of the route s -> t, and out of the bank with the remaining probability. The transaction
+ *                length at a station reached this way is exponentially distributed with the station's mean
+ *                (rounded up to whole time units, with the station's mean after rounding, and 1 for a mean
+ *                of at most 1).
+ *
+ *              The network is described by a configuration text:
+ *                  station NAME SERVERS MEAN_SERVICE_TIME
+ *                  route FROM TO PROBABILITY
+ *              with blank lines and lines starting with '#' ignored. The first station is the entrance.
+ *
+ *              Station names are only used while reading the configuration and the input: internally a
+ *              station is an index into plain arrays (servers, busy servers, line, statistics), the routing
+ *              table is one flat array of cumulative probabilities with a slice per station, and routes from
+ *              the input are flat arrays of station indices and lengths. The inner loop therefore does no
+ *              string lookups and no virtual calls, and its cost does not depend on the number of stations
+ *              beyond the O(log n) event priority queue and the routing slice of the station left.
+ *
+ *              Arrivals are processed before simultaneous departures, and simultaneous departures in the
+ *              order their services started. With a single station the statistics are exactly those of
+ *              BankSim --stream-arrivals with that many tellers.
+ *
+ * Class Invariant:
+ * - busy[s] <= servers[s]; a customer waits in the line of station s only while every server of s is busy.
+ * - Each customer in service has exactly one pending departure event.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef SERVICENETWORK_H
+#define SERVICENETWORK_H
+
+#include <cstddef>
+#include <istream>
+#include <random>
+#include <string>
+#include <vector>
+#include "PriorityQueue.h"
+#include "Queue.h"
+
+class ServiceNetwork {
+
+public:
+    // Structure: Station
+    // Purpose: The configuration of one station.
+    struct Station {
+        std::string name;
+        int servers;                    // Servers working at the station
+        double meanServiceTime;         // Mean transaction length of randomly routed visits
+    };
+
+    // Structure: Route
+    // Purpose: From station from, a customer moves to station to with the given probability.
+    struct Route {
+        int from;
+        int to;
+        double probability;
+    };
+
+    // Structure: StationStatistics
+    // Purpose: The statistics of one station after the run.
+    struct StationStatistics {
+        std::string name;
+        int servers;
+        unsigned long long visits;      // Customers who entered the station
+        long long cumulativeWaitTime;   // Sum of the waits in the station's line
+        int longestWait;
+        unsigned int longestLine;       // Most customers waiting in the line at once
+        double utilization;             // Busy server time / (servers * length of the day)
+        float averageWaitTime() const;
+    };
+
+private:
+    // Structure: Departure
+    // Purpose: The end of a service; ordered by time, then by the order the services started.
+    struct Departure {
+        int time;
+        unsigned long long sequence;
+        std::size_t customer;
+        int station;
+
+        bool operator<(const Departure& rhs) const;
+        bool operator>(const Departure& rhs) const;
+    };
+
+    // Stations
+    std::vector<Station> stations;
+    std::vector<int> servers;
+    std::vector<double> meanServiceTime;
+    std::vector<int> busy;
+    std::vector<Queue<std::size_t>> lines;
+    std::vector<unsigned int> lineLength;
+    std::vector<std::size_t> routingBegin;        // Slice of station s: [routingBegin[s], routingBegin[s + 1])
+    std::vector<double> routingCumulative;        // Cumulative probability of each route of the slice
+    std::vector<int> routingTarget;               // Target station of each route of the slice
+
+    // Station statistics
+    std::vector<unsigned long long> visits;
+    std::vector<long long> stationWaitTime;
+    std::vector<int> stationLongestWait;
+    std::vector<unsigned int> longestLine;
+    std::vector<long long> busyTime;
+
+    // Customers, in order of arrival
+    std::vector<int> arrivalTime;
+    std::vector<int> firstLength;
+    std::vector<std::size_t> routeBegin;          // Route of customer c: [routeBegin[c], routeBegin[c + 1])
+    std::vector<int> routeStation;
+    std::vector<int> routeLength;
+    std::vector<unsigned char> routed;            // Whether the customer follows a route from the input
+    std::vector<std::size_t> routePosition;       // Next route entry of the customer
+    std::vector<int> serviceLength;               // Transaction length at the current station
+    std::vector<int> enteredAt;                   // Time the customer entered the current station
+    std::vector<long long> customerWaitTime;
+    std::vector<int> customerVisits;
+
+    PriorityQueue<Departure> departures;
+    unsigned long long nextSequence;
+    std::mt19937_64 generator;
+
+    // End-to-end statistics
+    int firstArrival;
+    int simulationTime;
+    int customersCompleted;
+    long long cumulativeWaitTime;
+    long long cumulativeTimeInBank;
+    unsigned long long totalVisits;
+    unsigned long long eventsProcessed;
+
+    // Utility methods
+    void enterStation(std::size_t customer, int station, int length);
+    void startService(int station, std::size_t customer);
+    void finishService(int station, std::size_t customer);
+    int drawServiceTime(int station);
+
+public:
+    // Description: Reads a network configuration (see the file description) into stations and routes.
+    //              Returns false and sets error if it is malformed: an unknown keyword or station, a
+    //              station defined twice, fewer than one server, a mean that is not positive, routes from
+    //              a station whose probabilities add up to more than 1, or a station from which the routes never
+    //              lead out of the bank.
+    static bool readConfiguration(std::istream& input, std::vector<Station>& stations, std::vector<Route>& routes,
+                                  std::string& error);
+
+    // Constructor
+    // - Creates a network of the given stations (at least one) and routes. Random routes and transaction
+    //   lengths are drawn from a generator seeded with seed, so a run is reproducible.
+    ServiceNetwork(const std::vector<Station>& stations, const std::vector<Route>& routes, unsigned long long seed);
+
+    // Description: Returns the index of the station with the given name, or -1.
+    int findStation(const std::string& name) const;
+
+    // Description: Adds a customer arriving at time with the given transaction length at the first station.
+    //              If route is not empty, the customer then visits its (station, length) entries in order;
+    //              otherwise the customer is routed at random.
+    // Precondition: Customers are added in order of arrival time, before run().
+    void addCustomer(int time, int length, const std::vector<std::pair<int, int>>& route);
+
+    // Description: Processes all customers until the last one leaves the bank.
+    // Time Efficiency: O(v log2 s + r) for v visits, s servers in total and r routing slices scanned
+    void run();
+
+    // Getters
+    // - The wait of a customer is the sum of the waits in all lines the customer passed through.
+    int getSimulationTime() const;
+    unsigned long long getEventsProcessed() const;
+    int getCustomerCount() const;
+    float getAverageWaitTime() const;
+    float getAverageTimeInBank() const;
+    float getAverageVisits() const;
+    std::vector<StationStatistics> getStationStatistics() const;
+};
+
+#endif
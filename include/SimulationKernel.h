@@ -0,0 +1,201 @@
+/*
+ * SimulationKernel.h
+ *
+ * Description: This header file defines the SimulationKernel class template, the event loop of the bank reduced
+ *              to its core and parameterized at compile time on four policies, so that an experiment with a
+ *              different container, clock or statistic is a new template argument instead of a fork of the
+ *              simulation:
+ *              - EventSet: the class template holding the pending departures, with the PriorityQueue operations
+ *                (isEmpty, enqueue, dequeue, peek). PriorityQueue, LoserTree and FixedCapacity<N>::PriorityQueue
+ *                can be used.
+ *              - Line: the class template of the bank line, with the Queue operations. Queue and
+ *                FixedCapacity<N>::Queue can be used.
+ *              - Time: the arithmetic type of times and transaction lengths (int, long long, double, ...).
+ *              - Statistics: the class template, instantiated on Time, that is told of every arrival, service
+ *                start and departure (recordArrival, recordServiceStart, recordDeparture). WaitStatistics keeps
+ *                what the bank reports, NoStatistics nothing, and WaitExtremeStatistics also the longest wait
+ *                and line.
+ *
+ *              Every call from the loop to a policy is a call of a known function of a known type, so each
+ *              combination is compiled into its own loop with the policies inlined; nothing is dispatched at
+ *              run time. KernelBench measures the kernels against a loop written by hand for one combination.
+ *
+ *              The kernel simulates like BasicBankSimulation with ArrivalMode::STREAM: the arrivals (sorted by
+ *              time) are read one at a time, the event set only holds departures, and simultaneous events
+ *              are processed arrivals first. The number of tellers is fixed, and there is no event log,
+ *              staffing schedule or trace; with WaitStatistics and int times the statistics are those of
+ *              BankSimulation.
+ *
+ * Class Invariant:
+ * - tellersBusy is the number of customers currently being served; each has one pending departure.
+ * - A customer waits in the bank line only while no teller is free.
+ * - The arrival events referenced by the kernel outlive it and are not modified while it runs.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef SIMULATIONKERNEL_H
+#define SIMULATIONKERNEL_H
+
+#include <cstddef>
+#include <vector>
+#include "FixedPriorityQueue.h"
+#include "FixedQueue.h"
+#include "FullDataCollectionException.h"
+#include "PriorityQueue.h"
+#include "Queue.h"
+
+// The event loop and the policy calls it makes are always inlined, so that a kernel compiles to one flat loop
+// like a hand-written one even where the compiler would keep a function called from two places out of line
+#if defined(__GNUC__)
+#define KERNEL_INLINE __attribute__((always_inline)) inline
+#else
+#define KERNEL_INLINE inline
+#endif
+
+// Structure: KernelEvent
+// Purpose: A customer's arrival or a departure of the kernel. Events are ordered by time only: the event set
+//          holds nothing but departures, and the order of simultaneous departures does not change the statistics.
+template <typename Time>
+struct KernelEvent {
+    Time time;     // The time at which the event occurs
+    Time length;   // The transaction length of an arrival, 0 for a departure
+
+    KERNEL_INLINE bool operator<(const KernelEvent& rhs) const;
+    KERNEL_INLINE bool operator>(const KernelEvent& rhs) const;
+    KERNEL_INLINE bool operator<=(const KernelEvent& rhs) const;
+};
+
+// Structure: FixedCapacity
+// Purpose: The fixed-capacity containers with room for Capacity elements, as single-parameter templates that can
+//          be given as the EventSet or Line policy of a kernel.
+template <unsigned int Capacity>
+struct FixedCapacity {
+    template <typename ElementType>
+    using PriorityQueue = FixedPriorityQueue<ElementType, Capacity>;
+
+    template <typename ElementType>
+    using Queue = FixedQueue<ElementType, Capacity>;
+};
+
+// Class: WaitStatistics
+// Purpose: Statistics policy keeping the number of customers and their total wait, as reported by the bank.
+template <typename Time>
+class WaitStatistics {
+
+public:
+    // Type of the total wait: long long for integral times, so that a day of int waits cannot overflow
+    typedef decltype(Time() + 0LL) Total;
+
+private:
+    int customerCount = 0;          // Number of customers who have arrived
+    Total cumulativeWaitTime = 0;   // Sum of the wait times of all served customers
+
+public:
+    // Description: Called by the kernel for every arrival, every service start and every departure. lineLength
+    //              is the number of customers waiting when the customer arrives.
+    KERNEL_INLINE void recordArrival(Time time, unsigned int lineLength);
+    KERNEL_INLINE void recordServiceStart(Time time, Time wait);
+    KERNEL_INLINE void recordDeparture(Time time);
+
+    // Getters
+
+    // Description: Returns the number of customers who have arrived so far.
+    int getCustomerCount() const;
+
+    // Description: Returns the sum of the wait times of all customers served so far.
+    Total getCumulativeWaitTime() const;
+
+    // Description: Returns the average wait time over all customers who have arrived so far.
+    float getAverageWaitTime() const;
+};
+
+// Class: NoStatistics
+// Purpose: Statistics policy keeping nothing, for measuring the event loop alone. It adds no member to the kernel.
+template <typename Time>
+class NoStatistics {
+
+public:
+    KERNEL_INLINE void recordArrival(Time time, unsigned int lineLength);
+    KERNEL_INLINE void recordServiceStart(Time time, Time wait);
+    KERNEL_INLINE void recordDeparture(Time time);
+};
+
+// Class: WaitExtremeStatistics
+// Purpose: Statistics policy keeping the WaitStatistics and also the longest wait and the longest bank line met by
+//          an arriving customer.
+template <typename Time>
+class WaitExtremeStatistics : public WaitStatistics<Time> {
+
+private:
+    Time longestWait = 0;           // Longest wait of a served customer
+    unsigned int longestLine = 0;   // Longest bank line an arriving customer found
+
+public:
+    KERNEL_INLINE void recordArrival(Time time, unsigned int lineLength);
+    KERNEL_INLINE void recordServiceStart(Time time, Time wait);
+
+    // Getters
+    Time getLongestWait() const;
+    unsigned int getLongestLine() const;
+};
+
+// Class: SimulationKernel
+// Purpose: The bank's event loop, specialized for its policies (see the file description). The statistics policy
+//          is a private base class, so a policy without data members takes no space.
+template <template <typename> class EventSet = PriorityQueue, template <typename> class Line = Queue,
+          typename Time = int, template <typename> class Statistics = WaitStatistics>
+class SimulationKernel : private Statistics<Time> {
+
+private:
+    const std::vector<KernelEvent<Time>>* arrivals;     // The customers' arrival events, sorted by time (not owned)
+    EventSet<KernelEvent<Time>> departures;             // Pending departures, ordered by time
+    Line<KernelEvent<Time>> bankLine;                   // Customers waiting for a teller
+    std::size_t nextArrival;                            // Index of the next arrival not yet in the simulation
+
+    unsigned int lineLength;                            // Number of customers in the bank line
+    int tellers;                                        // Number of tellers on duty
+    int tellersBusy;                                    // Number of tellers currently serving a customer
+    Time simulationTime;                                // Time of the event processed last
+    unsigned long long eventsProcessed;                 // Number of events processed so far
+
+    // Utility methods
+    static EventSet<KernelEvent<Time>> makeEventSet(unsigned int capacity);
+    KERNEL_INLINE void processArrival(const KernelEvent<Time>& arrival);
+    KERNEL_INLINE void processDeparture();
+    KERNEL_INLINE void startService(const KernelEvent<Time>& customer);
+
+public:
+    // Constructor
+    // - Creates a kernel simulating arrivals (sorted by time, see sortArrivals) with the given number of tellers.
+    SimulationKernel(const std::vector<KernelEvent<Time>>& arrivals, int tellers = 1);
+
+    // Description: Sorts arrival events by time, keeping simultaneous arrivals in input order.
+    static void sortArrivals(std::vector<KernelEvent<Time>>& arrivals);
+
+    // Description: Processes the next event: the next arrival if it is not later than the next departure,
+    //              otherwise the next departure. Returns false if there was nothing left to process.
+    // Exceptions: Throws FullDataCollectionException if a fixed-capacity container overflows.
+    KERNEL_INLINE bool step();
+
+    // Description: Processes all remaining events.
+    // Exceptions: Throws FullDataCollectionException if a fixed-capacity container overflows.
+    void run();
+
+    // Getters
+
+    // Description: Returns the statistics policy, with the statistics of the events processed so far.
+    const Statistics<Time>& getStatistics() const;
+
+    // Description: Returns the time of the event processed last.
+    Time getSimulationTime() const;
+
+    // Description: Returns the number of events processed so far.
+    unsigned long long getEventsProcessed() const;
+};
+
+// Include the implementation file (SimulationKernel.cpp) after the class definition
+#include "../src/SimulationKernel.cpp"
+
+#endif
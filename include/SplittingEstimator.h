@@ -0,0 +1,147 @@
+/*
+ * SplittingEstimator.h
+ *
+ * Description: This header file defines the SplittingEstimator class, which estimates the probability that a
+ *              customer waits longer than a threshold when that probability is far too small for plain
+ *              simulation (around 1e-6 and below). The bank is modelled as an M/M/c queue: exponential
+ *              interarrival and service times, c tellers, one FIFO line.
+ *
+ *              The estimator uses fixed-effort multilevel splitting over regenerative cycles. A cycle starts
+ *              when a customer arrives at an empty bank and ends when the bank is empty again; by the
+ *              renewal-reward theorem the tail probability is E[tail customers per cycle] / E[customers per
+ *              cycle]. Long waits happen in cycles where the line grows long, so the line length is used as
+ *              the importance function, with increasing levels l1 < l2 < ... < lm:
+ *              - Stage 0 runs N cycles from the start until the line reaches l1 or the bank empties, and
+ *                keeps the states of the trajectories that reached l1.
+ *              - Stage k runs N trajectories, each from a copy of one of the states kept by stage k - 1
+ *                (taken in turn), until the line reaches l(k+1) or the bank empties. The last stage runs
+ *                until the bank empties.
+ *              With p_k the fraction of stage k trajectories that reached the next level, and R_k the mean
+ *              number of tail customers (or of customers) they produced, E[... per cycle] is estimated by
+ *              sum over k of p_0 * ... * p_(k-1) * R_k. Stages near the top thus cost as much as the first
+ *              ones but are reached with probability 1 instead of p_0 * ... * p_(k-1).
+ *
+ *              Copying a state must be cheap, because every trajectory of a stage starts from one. A state
+ *              is a flat value: the clock, the next arrival time, the pending departures in a
+ *              FixedPriorityQueue and the arrival times of the waiting customers in a FixedQueue, so copying
+ *              it copies one contiguous block and allocates nothing.
+ *
+ *              Confidence intervals come from independent runs of the whole estimator. For comparison,
+ *              estimateCrude() spends a given number of customers on plain simulation of cycles.
+ *
+ * Class Invariant:
+ * - The model is stable (service demand less than the tellers' capacity), so every cycle ends.
+ * - The levels are positive and strictly increasing.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef SPLITTINGESTIMATOR_H
+#define SPLITTINGESTIMATOR_H
+
+#include <random>
+#include <vector>
+#include "FixedPriorityQueue.h"
+#include "FixedQueue.h"
+
+class SplittingEstimator {
+
+public:
+    // Most tellers and most waiting customers a state can hold; a longer line throws
+    // FullDataCollectionException
+    static constexpr unsigned int MAX_TELLERS = 64;
+    static constexpr unsigned int MAX_LINE = 1024;
+
+    // Structure: Model
+    // Purpose: The M/M/c bank and the wait threshold.
+    struct Model {
+        int tellers = 1;
+        double meanInterarrivalTime = 1;
+        double meanServiceTime = 1;
+        double waitThreshold = 0;               // A customer is in the tail if their wait exceeds this
+    };
+
+    // Structure: Options
+    // Purpose: How much work the estimator does.
+    struct Options {
+        std::vector<int> levels;                // Line lengths l1 < l2 < ... (empty: chosen from the model)
+        unsigned int effort = 1000;             // Trajectories per stage
+        unsigned int runs = 10;                 // Independent runs for the confidence interval
+        unsigned long long seed = 1;
+    };
+
+    // Structure: Estimate
+    // Purpose: A tail probability with its 95% confidence interval and the work it took.
+    struct Estimate {
+        double probability;                     // Mean over the runs
+        double halfWidth;                       // Half-width of the 95% confidence interval
+        unsigned long long customers;           // Customers simulated by all runs
+        double seconds;                         // Wall-clock time of all runs
+        std::vector<double> levelProbabilities; // Mean fraction of each stage reaching the next level
+    };
+
+private:
+    // Structure: Departure
+    // Purpose: The end of a service in a state's event set.
+    struct Departure {
+        double time;
+        bool operator<(const Departure& rhs) const;
+        bool operator>(const Departure& rhs) const;
+    };
+
+    // Structure: State
+    // Purpose: Everything that determines the future of a cycle; a flat value that is copied to split.
+    struct State {
+        double time;
+        double nextArrival;
+        int busy;
+        FixedPriorityQueue<Departure, MAX_TELLERS> departures;
+        FixedQueue<double, MAX_LINE> line;      // Arrival times of the waiting customers
+    };
+
+    // Structure: Segment
+    // Purpose: What one trajectory produced until it stopped.
+    struct Segment {
+        bool reachedLevel;                      // Stopped at the next level (otherwise the bank emptied)
+        unsigned long long customers;           // Customers who arrived
+        unsigned long long tailCustomers;       // Customers whose service started after a wait over the threshold
+    };
+
+    Model model;
+    std::mt19937_64 generator;
+    std::exponential_distribution<double> interarrival;
+    std::exponential_distribution<double> service;
+
+    // Utility methods
+    State startCycle();
+    Segment advance(State& state, int level);
+    void startService(State& state);
+
+public:
+    // Constructor
+    // - Creates an estimator for model.
+    // Precondition: The model is stable and has at most MAX_TELLERS tellers.
+    explicit SplittingEstimator(const Model& model);
+
+    // Description: Returns true if the model is stable: the tellers can serve customers faster than they
+    //              arrive.
+    static bool isStable(const Model& model);
+
+    // Description: Returns the default levels for the model: every line length (or every few, for at most 64
+    //              levels) below the one at which a newcomer's expected wait reaches the threshold.
+    std::vector<int> defaultLevels() const;
+
+    // Description: Estimates the tail probability by splitting.
+    // Precondition: The levels are positive and strictly increasing.
+    // Exception: Throws FullDataCollectionException if the line outgrows MAX_LINE.
+    // Time Efficiency: O(R * (m + 1) * N * T) for R runs of m + 1 stages of N trajectories of length T
+    Estimate estimate(const Options& options);
+
+    // Description: Estimates the tail probability by plain simulation of whole cycles, with about customers
+    //              customers per run.
+    // Exception: Throws FullDataCollectionException if the line outgrows MAX_LINE.
+    Estimate estimateCrude(unsigned long long customers, unsigned int runs, unsigned long long seed);
+};
+
+#endif
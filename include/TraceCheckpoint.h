@@ -0,0 +1,122 @@
+/*
+ * TraceCheckpoint.h
+ *
+ * Description: This header file defines the TraceCheckpoint class, which lets a trace that only ever grows
+ *              at its end (a day of customers appended to every night) be simulated incrementally. After a
+ *              run the checkpoint records how far the trace was read (the input offset, just past the last
+ *              complete "arrival length" pair), a hash of the trace just before there, and the simulation state at
+ *              the moment the last of those arrivals was processed (BankSimulationBase::SavedState). The
+ *              departures still pending at that moment are not yet processed, so the next run can continue
+ *              from the state with the appended arrivals, and its statistics are those of a run over the
+ *              whole trace with --stream-arrivals.
+ *
+ *              A checkpoint is only used if it still describes the trace: the configuration (executable,
+ *              tellers and staffing schedule) is unchanged, the trace is the same file (device and inode) and
+ *              at least as long, the last CHECK_WINDOW bytes before the offset hash to the stored hash (the
+ *              window includes the byte after the offset, if there was one, so a last number that was extended
+ *              is noticed), and no appended customer arrives before the last customer of the checkpoint.
+ *              Otherwise the trace is simulated from the start. A resumed run thus reads the window and the
+ *              appended bytes only, whatever the length of the trace; the price is that a change before the
+ *              window goes unnoticed. The prefix hash, a hash of every byte before the offset that each run
+ *              extends with the bytes it appended, closes that gap for a trace read whole (verifiesPrefix):
+ *              on request, and whenever the trace was written since the checkpoint without growing
+ *              (wasRewritten), which appending cannot explain.
+ *
+ *              Checkpoints are written to a temporary file and renamed into place, so a crashed run leaves
+ *              the previous checkpoint intact.
+ *
+ * Class Invariant:
+ * - state is the state of a run over the arrivals in the first offset bytes of a trace whose bytes from
+ *   windowStart(hashedLength) to hashedLength hash to windowHash, at the time the last of those arrivals was
+ *   processed.
+ * - prefixHash is hashPrefix of the first hashedLength bytes of that trace, and traceFile describes its file.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef TRACECHECKPOINT_H
+#define TRACECHECKPOINT_H
+
+#include <climits>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "BankSimulation.h"
+#include "ResultCache.h"
+
+class TraceCheckpoint {
+
+public:
+    // Bytes before the end of the hashed part of the trace that a checkpoint is validated by
+    static constexpr std::uint64_t CHECK_WINDOW = 4096;
+
+    // Structure: TraceFile
+    // Purpose: The identity of the trace's file, and its size and modification time.
+    struct TraceFile {
+        std::uint64_t device = 0;
+        std::uint64_t inode = 0;
+        std::uint64_t size = 0;
+        std::int64_t modified = 0;              // Nanoseconds since the epoch
+    };
+
+    ResultCache::Key configuration;             // Hash of the executable, tellers and staffing schedule
+    std::uint64_t offset = 0;                   // Bytes of the trace read
+    std::uint64_t hashedLength = 0;             // offset, plus the byte after it if there was one
+    ResultCache::Key windowHash = {0, 0};       // Hash of the bytes from windowStart(hashedLength) to hashedLength
+    ResultCache::Key prefixHash = {0, 0};       // hashPrefix of the bytes before hashedLength
+    TraceFile traceFile;                        // The trace's file when the checkpoint was written
+    int lastArrivalTime = INT_MIN;              // Latest arrival read, or INT_MIN if there was none
+    BankSimulationBase::SavedState state;
+
+    // Description: Returns the offset of the first byte hashed for a checkpoint hashing up to hashedLength.
+    static std::uint64_t windowStart(std::uint64_t hashedLength);
+
+    // Description: Returns the hash of the bytes of the trace from windowStart(hashedLength) to hashedLength,
+    //              given the part of the trace from offset base (at most the window start) on.
+    // Time Efficiency: O(CHECK_WINDOW)
+    static ResultCache::Key hashWindow(const std::string& tail, std::uint64_t base, std::uint64_t hashedLength);
+
+    // Description: Returns the prefix hash of a trace extended by size bytes at data, given the prefix hash
+    //              of the trace before them (prefixHash of a default checkpoint for the empty trace). The hash
+    //              of a trace does not depend on how it was split into parts.
+    // Time Efficiency: O(size)
+    static ResultCache::Key hashPrefix(ResultCache::Key prefixHash, const char* data, std::size_t size);
+
+    // Description: Reads the identity, size and modification time of the file at path.
+    // Returns: true if the file exists.
+    static bool identify(const std::string& path, TraceFile& file);
+
+    // Description: Appends the "arrival length" pairs of trace from offset on to arrivals, stopping at the end
+    //              or at the first text that is not a pair of integers, like reading standard input.
+    // Returns: The offset just past the last pair read.
+    // Time Efficiency: O(size of trace - offset)
+    static std::uint64_t parseArrivals(const std::string& trace, std::uint64_t offset, std::vector<Event>& arrivals);
+
+    // Description: Returns true if the checkpoint can be continued with the rest of the trace in current
+    //              under configuration, given the part tail of the trace from offset base on, where base is at
+    //              most windowStart(hashedLength) (or the trace is shorter than that); otherwise sets reason.
+    // Time Efficiency: O(CHECK_WINDOW)
+    bool describes(const std::string& tail, std::uint64_t base, const TraceFile& current,
+                   const ResultCache::Key& configuration, std::string& reason) const;
+
+    // Description: Returns true if the trace in current has the size it had at the checkpoint but was written
+    //              since, so that only its prefix hash tells whether it changed.
+    bool wasRewritten(const TraceFile& current) const;
+
+    // Description: Returns true if every byte of the whole trace before hashedLength is unchanged, otherwise
+    //              sets reason.
+    // Time Efficiency: O(hashedLength)
+    bool verifiesPrefix(const std::string& trace, std::string& reason) const;
+
+    // Description: Reads the checkpoint at path.
+    // Returns: true if the file holds a whole checkpoint.
+    bool read(const std::string& path);
+
+    // Description: Atomically replaces the checkpoint at path by this one.
+    // Returns: true if it was written.
+    bool write(const std::string& path) const;
+};
+
+#endif
@@ -0,0 +1,63 @@
+/*
+ * TraceFormat.h
+ *
+ * Description: This header file defines the layout of an indexed trace file, the binary record of everything
+ *              that happened during a run (see TraceWriter and TraceReader). A trace file consists of:
+ *              - a TraceHeader at offset 0,
+ *              - recordCount TraceRecords, in the order they happened (so sorted by time), starting right
+ *                after the header,
+ *              - the sparse time index at indexOffset: one 32-bit time per block of blockSize records, the
+ *                time of the block's first record.
+ *
+ *              To find the records of a time window, a reader binary-searches the index for the block where
+ *              the window starts and reads records from there on, without touching the rest of the file.
+ *              All fields are in the machine's byte order, so a file is meant to be read on the machine
+ *              type that wrote it.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef TRACEFORMAT_H
+#define TRACEFORMAT_H
+
+#include <cstdint>
+
+// The first bytes of every trace file, and the format version described here
+const char TRACE_MAGIC[8] = {'B', 'A', 'N', 'K', 'T', 'R', 'C', '\0'};
+const std::uint32_t TRACE_VERSION = 1;
+
+// Structure: TraceHeader
+// Purpose: The header at the start of a trace file (40 bytes).
+struct TraceHeader {
+    char magic[8];                  // TRACE_MAGIC
+    std::uint32_t version;          // TRACE_VERSION
+    std::uint32_t blockSize;        // Records per index block
+    std::uint64_t recordCount;      // Number of records
+    std::uint64_t indexOffset;      // File offset of the time index
+    std::uint64_t indexCount;       // Number of index entries (blocks)
+};
+
+// Structure: TraceRecord
+// Purpose: One thing that happened during the run (16 bytes). lineLength and tellersBusy are the state of the
+//          bank right after it. Services started by an arrival, a departure or a staffing change are
+//          recorded before the record of that event.
+struct TraceRecord {
+    // Kind of record; value holds:
+    // - ARRIVAL: the customer's transaction length
+    // - DEPARTURE: 0
+    // - SERVICE_START: the wait of the customer whose service started
+    // - STAFFING: the number of tellers on duty from now on
+    enum Type : std::uint16_t { ARRIVAL = 0, DEPARTURE = 1, SERVICE_START = 2, STAFFING = 3 };
+
+    std::int32_t time;              // Time of the record
+    std::uint16_t type;             // One of Type
+    std::uint16_t tellersBusy;      // Tellers serving a customer (at most 65535 reported)
+    std::uint32_t lineLength;       // Customers in the bank line
+    std::int32_t value;             // See Type
+};
+
+static_assert(sizeof(TraceHeader) == 40, "The trace header layout must not contain padding");
+static_assert(sizeof(TraceRecord) == 16, "The trace record layout must not contain padding");
+
+#endif
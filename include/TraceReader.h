@@ -0,0 +1,88 @@
+/*
+ * TraceReader.h
+ *
+ * Description: This header file defines the TraceReader class, which answers time-window queries on an
+ *              indexed trace file (see TraceFormat.h) without reading the whole file. The file is memory
+ *              mapped; a query binary-searches the sparse time index (O(log n)), then scans at most one
+ *              block to the first record of the window, and returns the window's records as a contiguous
+ *              range of the mapping. Only the pages of the index and of the window are ever read from disk.
+ *
+ * Class Invariant:
+ * - While a file is open, records points to recordCount records sorted by time and index to one time
+ *   per block of blockSize records.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef TRACEREADER_H
+#define TRACEREADER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "TraceFormat.h"
+
+class TraceReader {
+
+public:
+    // Structure: Range
+    // Purpose: The records [begin, end) of a query, pointing into the mapped file.
+    struct Range {
+        const TraceRecord* begin;
+        const TraceRecord* end;
+    };
+
+private:
+    void* mapping;                   // The mapped file, or nullptr
+    std::size_t mappingSize;         // Size of the mapping in bytes
+    const TraceHeader* header;       // The header at the start of the mapping
+    const TraceRecord* records;      // The records of the file
+    const std::int32_t* index;       // The time of the first record of each block
+    std::string error;               // Why the last open() failed
+
+    // Utility methods
+    bool fail(const std::string& message);
+
+public:
+    // Constructor
+    TraceReader();
+
+    // Destructor
+    // - Unmaps the file.
+    ~TraceReader();
+
+    // Description: Maps the trace file at path and checks its header, index and size.
+    //              Returns false (see getError) if the file cannot be used.
+    bool open(const std::string& path);
+
+    // Description: Unmaps the file, if one is open.
+    void close();
+
+    // Description: Returns the reason the last open() failed.
+    const std::string& getError() const;
+
+    // Description: Returns the number of records in the file.
+    std::uint64_t getRecordCount() const;
+
+    // Description: Returns the number of records per index block.
+    std::uint32_t getBlockSize() const;
+
+    // Description: Returns all records of the file.
+    Range getAll() const;
+
+    // Description: Returns the records whose time t satisfies from <= t < to.
+    // Precondition: A file is open.
+    // Time Efficiency: O(log b + s + k) for b blocks of s records and k records returned
+    Range query(int from, int to) const;
+
+    // Description: Returns the last record before the range (its state holds at the start of the window),
+    //              or nullptr if the range starts at the first record.
+    const TraceRecord* before(const Range& range) const;
+
+    // The reader owns its mapping, so it cannot be copied
+    TraceReader(const TraceReader&) = delete;
+    TraceReader& operator=(const TraceReader&) = delete;
+};
+
+#endif
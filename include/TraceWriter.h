@@ -0,0 +1,68 @@
+/*
+ * TraceWriter.h
+ *
+ * Description: This header file defines the TraceWriter class, which writes the indexed trace file of a run
+ *              (see TraceFormat.h). The simulation reports every event, service start and staffing change;
+ *              the writer appends a 16-byte record to a block buffer, writes the buffer in one call when it
+ *              fills up, and notes the time of the first record of every index block. finish() appends the
+ *              index and completes the header, so the output stream must be seekable (a regular file).
+ *
+ * Class Invariant:
+ * - Records are reported in time order.
+ * - blockTimes[b] is the time of record b * blockSize.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef TRACEWRITER_H
+#define TRACEWRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "TraceFormat.h"
+
+class TraceWriter {
+
+private:
+    std::FILE* out;                            // Output file (not owned)
+    std::uint32_t blockSize;                   // Records per index block
+    std::vector<TraceRecord> buffer;           // Records not yet written
+    std::size_t used;                          // Number of records in buffer
+    std::uint64_t recordCount;                 // Records reported so far
+    std::vector<std::int32_t> blockTimes;      // The sparse time index
+    bool finished;                             // True once finish() has run
+    bool failed;                               // True if a write has failed
+
+    // Utility methods
+    void writeBuffer();
+
+public:
+    // Constructor
+    // - Writes a provisional header to out, which must be a seekable file opened for binary writing.
+    // - An index entry is kept for every blockSize records; bufferSize records are written per call.
+    TraceWriter(std::FILE* out, std::uint32_t blockSize = 1024, std::size_t bufferSize = 4096);
+
+    // Destructor
+    // - Calls finish() if it has not been called yet.
+    ~TraceWriter();
+
+    // Description: Appends a record (see TraceRecord for the meaning of value).
+    // Time Efficiency: O(1) amortized
+    void record(TraceRecord::Type type, int time, int value, unsigned int lineLength, int tellersBusy);
+
+    // Description: Writes the remaining records, the index and the final header, then flushes the file.
+    //              Returns false if any write failed.
+    bool finish();
+
+    // Description: Returns the number of records reported so far.
+    std::uint64_t getRecordCount() const;
+
+    // The writer owns a buffer and completes the file once, so it cannot be copied
+    TraceWriter(const TraceWriter&) = delete;
+    TraceWriter& operator=(const TraceWriter&) = delete;
+};
+
+#endif
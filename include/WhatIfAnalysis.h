@@ -0,0 +1,76 @@
+/*
+ * WhatIfAnalysis.h
+ *
+ * Description: This header file defines the WhatIfAnalysis class, which answers staffing questions such as
+ *              "what if a second teller opened at time 840?" without re-simulating the whole day.
+ *
+ *              During the baseline run, a snapshot of the complete simulation state is recorded every
+ *              snapshotInterval time units. A what-if scenario is a different staffing schedule; since
+ *              the scenario and the baseline are identical up to the first staffing change in which they
+ *              differ (the divergence point), the scenario is resumed from the last snapshot taken at or
+ *              before that point and only the remainder of the day is simulated.
+ *
+ *              The simulations run in BankSimulation::ArrivalMode::STREAM, so a snapshot only holds the
+ *              pending departures, the bank line and a few counters: it is small and cheap to copy.
+ *
+ * Class Invariant:
+ * - snapshots[i] is the state of the baseline run before processing any event at or after
+ *   snapshotTimes[i]; snapshotTimes is strictly increasing and snapshots[0] is the initial state.
+ * - The arrival events and schedules passed in outlive the analysis and the simulations it returns.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#ifndef WHATIFANALYSIS_H
+#define WHATIFANALYSIS_H
+
+#include <vector>
+#include "BankSimulation.h"
+#include "Event.h"
+
+class WhatIfAnalysis {
+
+public:
+    // Structure: Result
+    // Purpose: The completed what-if simulation, with the point it was resumed from.
+    struct Result {
+        BankSimulation simulation;             // The simulation of the scenario, run to completion
+        int resumedAt;                         // Snapshot time resumed from (INT_MIN: start of the day)
+        unsigned long long eventsResimulated;  // Number of events processed after resuming
+    };
+
+private:
+    const std::vector<Event>& arrivals;                 // Arrival events sorted by time
+    const std::vector<StaffingChange>& baseline;        // Staffing schedule of the baseline run
+    int tellers;                                        // Number of tellers on duty at the start
+    int snapshotInterval;                               // Time between two snapshots
+
+    std::vector<BankSimulation> snapshots;              // Baseline states, oldest first
+    std::vector<int> snapshotTimes;                     // Time of each snapshot
+    BankSimulation baselineResult;                      // The completed baseline run
+
+    // Utility method: returns the time of the first staffing change in which schedule differs from baseline
+    int findDivergence(const std::vector<StaffingChange>& schedule) const;
+
+public:
+    // Constructor
+    // - arrivals must be sorted by time (see BankSimulation::sortArrivals) and baseline sorted by time.
+    WhatIfAnalysis(const std::vector<Event>& arrivals, int tellers,
+                   const std::vector<StaffingChange>& baseline, int snapshotInterval);
+
+    // Description: Runs the baseline simulation, recording a snapshot every snapshotInterval time units.
+    //              The baseline log is printed if logEvents is true.
+    // Postcondition: The completed baseline simulation is returned and kept for later scenarios.
+    const BankSimulation& runBaseline(bool logEvents, EventLogWriter* asyncLog = nullptr);
+
+    // Description: Simulates scenario, a staffing schedule sorted by time, by resuming from the last
+    //              baseline snapshot before the first change in which it differs from the baseline.
+    // Precondition: runBaseline() has been called; scenario outlives the returned simulation.
+    Result evaluate(const std::vector<StaffingChange>& scenario) const;
+
+    // Description: Returns the number of snapshots recorded by the baseline run.
+    unsigned int getSnapshotCount() const;
+};
+
+#endif
@@ -0,0 +1,190 @@
+/*
+ * AnalyticModel.cpp
+ *
+ * Description: This file implements the AnalyticModel class: the fit of the model to the customers, the
+ *              recognition of the family and the formulas of each family.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "../include/AnalyticModel.h"
+
+namespace {
+
+// Windows of equal length the day is cut into for the stationarity test
+const int STATIONARITY_WINDOWS = 10;
+
+// 99th percentile of the chi-squared distribution with STATIONARITY_WINDOWS - 1 degrees of freedom
+const double STATIONARITY_CRITICAL_VALUE = 21.666;
+
+// Smallest distance to 1 an SCV may have and still be taken for exponential times. Whole time units move the
+// SCV of exponential times a little (a transaction of mean length 25 rounded up has an SCV of about 0.96).
+const double MIN_SCV_TOLERANCE = 0.05;
+
+// Arrival times are whole time units. Rounding them moves every arrival by less than one unit, which adds
+// about 2 / 12 to the variance of the interarrival times; the fit removes it.
+const double ROUNDING_VARIANCE = 1.0 / 6.0;
+
+}
+
+// Constructor
+AnalyticModel::AnalyticModel(const std::vector<Event>& arrivals, int tellers)
+    : tellers(tellers), customers(arrivals.size()), arrivalRate(0), interarrivalScv(0), meanService(0),
+      serviceScv(0), family(Family::NONE), utilization(0), probabilityOfWait(0), meanWait(0), meanLineLength(0) {
+    if (customers < MIN_CUSTOMERS) {
+        reason = "too few customers to fit a model";
+        return;
+    }
+    fit(arrivals);
+    utilization = arrivalRate * meanService / tellers;
+    if (!(utilization < 1)) {
+        reason = "the tellers cannot keep up (utilization of 1 or more)";
+    } else if (!isStationary(arrivals)) {
+        reason = "the arrival rate changes over the day";
+    } else {
+        solve();
+    }
+}
+
+// erlangC
+// Description: Computes the Erlang B blocking probability by its stable recursion, then converts it.
+double AnalyticModel::erlangC(int c, double a) {
+    double blocking = 1;
+    for (int k = 1; k <= c; k++) {
+        blocking = a * blocking / (k + a * blocking);
+    }
+    double rho = a / c;
+    return blocking / (1 - rho * (1 - blocking));
+}
+
+// familyName
+const char* AnalyticModel::familyName(Family family) {
+    switch (family) {
+        case Family::MMC:
+            return "M/M/c";
+        case Family::MG1:
+            return "M/G/1";
+        case Family::GGC:
+            return "G/G/c";
+        default:
+            return "none";
+    }
+}
+
+// Getters
+
+AnalyticModel::Family AnalyticModel::getFamily() const {
+    return family;
+}
+
+const std::string& AnalyticModel::getReason() const {
+    return reason;
+}
+
+std::size_t AnalyticModel::getCustomerCount() const {
+    return customers;
+}
+
+double AnalyticModel::getArrivalRate() const {
+    return arrivalRate;
+}
+
+double AnalyticModel::getInterarrivalScv() const {
+    return interarrivalScv;
+}
+
+double AnalyticModel::getMeanService() const {
+    return meanService;
+}
+
+double AnalyticModel::getServiceScv() const {
+    return serviceScv;
+}
+
+double AnalyticModel::getUtilization() const {
+    return utilization;
+}
+
+double AnalyticModel::getProbabilityOfWait() const {
+    return probabilityOfWait;
+}
+
+double AnalyticModel::getMeanWait() const {
+    return meanWait;
+}
+
+double AnalyticModel::getMeanLineLength() const {
+    return meanLineLength;
+}
+
+// Utility method
+// Description: Estimates the arrival rate and the means and SCVs of the interarrival and service times.
+void AnalyticModel::fit(const std::vector<Event>& arrivals) {
+    double gapSum = 0, gapSquares = 0, serviceSum = 0, serviceSquares = 0;
+    for (std::size_t i = 0; i < customers; i++) {
+        double length = arrivals[i].getLength();
+        serviceSum += length;
+        serviceSquares += length * length;
+        if (i > 0) {
+            double gap = arrivals[i].getTime() - arrivals[i - 1].getTime();
+            gapSum += gap;
+            gapSquares += gap * gap;
+        }
+    }
+    double gaps = static_cast<double>(customers - 1);
+    double meanGap = gapSum / gaps;
+    double gapVariance = std::max(0.0, (gapSquares - gaps * meanGap * meanGap) / (gaps - 1) - ROUNDING_VARIANCE);
+    arrivalRate = meanGap > 0 ? 1 / meanGap : 0;
+    interarrivalScv = meanGap > 0 ? gapVariance / (meanGap * meanGap) : 0;
+
+    double n = static_cast<double>(customers);
+    meanService = serviceSum / n;
+    double serviceVariance = std::max(0.0, (serviceSquares - n * meanService * meanService) / (n - 1));
+    serviceScv = meanService > 0 ? serviceVariance / (meanService * meanService) : 0;
+}
+
+// Utility method
+// Description: Counts the arrivals in STATIONARITY_WINDOWS windows of equal length. For a stationary renewal
+//              process the counts' dispersion statistic, divided by the interarrival SCV, is approximately
+//              chi-squared distributed; a value above its 99th percentile rejects stationarity.
+bool AnalyticModel::isStationary(const std::vector<Event>& arrivals) const {
+    double first = arrivals.front().getTime();
+    double span = arrivals.back().getTime() - first + 1;
+    std::vector<double> counts(STATIONARITY_WINDOWS, 0.0);
+    for (const Event& arrival : arrivals) {
+        int window = static_cast<int>((arrival.getTime() - first) / span * STATIONARITY_WINDOWS);
+        counts[std::min(window, STATIONARITY_WINDOWS - 1)]++;
+    }
+    double expected = static_cast<double>(customers) / STATIONARITY_WINDOWS;
+    double dispersion = 0;
+    for (double count : counts) {
+        dispersion += (count - expected) * (count - expected) / expected;
+    }
+    return dispersion / std::max(interarrivalScv, 0.05) <= STATIONARITY_CRITICAL_VALUE;
+}
+
+// Utility method
+// Description: Picks the first family that fits (see the file description) and computes its waits.
+void AnalyticModel::solve() {
+    double tolerance = std::max(MIN_SCV_TOLERANCE, 3 * std::sqrt(8.0 / customers));
+    bool poissonArrivals = std::fabs(interarrivalScv - 1) <= tolerance;
+    bool exponentialService = std::fabs(serviceScv - 1) <= tolerance;
+
+    double load = arrivalRate * meanService;
+    probabilityOfWait = erlangC(tellers, load);
+    double markovianWait = probabilityOfWait * meanService / (tellers * (1 - utilization));
+    if (poissonArrivals && exponentialService) {
+        family = Family::MMC;
+        meanWait = markovianWait;
+    } else if (poissonArrivals && tellers == 1) {
+        family = Family::MG1;
+        meanWait = utilization * meanService * (1 + serviceScv) / (2 * (1 - utilization));
+    } else {
+        family = Family::GGC;
+        meanWait = markovianWait * (interarrivalScv + serviceScv) / 2;
+    }
+    meanLineLength = arrivalRate * meanWait;
+}
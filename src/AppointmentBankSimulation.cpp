@@ -0,0 +1,149 @@
+/*
+ * AppointmentBankSimulation.cpp
+ *
+ * Description: This file implements the AppointmentBankSimulation class. The next event is the earliest of
+ *              the next appointment, the next walk-in and the first pending departure.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include "../include/AppointmentBankSimulation.h"
+
+// averageWaitTime
+float AppointmentBankSimulation::TypeStatistics::averageWaitTime() const {
+    return static_cast<float>(cumulativeWaitTime) / customerCount;
+}
+
+// Constructor
+AppointmentBankSimulation::AppointmentBankSimulation(WalkInStream& walkIns, AppointmentStream& appointments,
+                                                     int tellers, PriorityRule rule, int lateGrace)
+    : walkIns(&walkIns), appointments(&appointments), tellers(tellers), rule(rule), lateGrace(lateGrace),
+      departures(static_cast<unsigned int>(tellers + 1)), tellersBusy(0), simulationTime(0), eventsProcessed(0),
+      walkInStatistics{0, 0, 0}, appointmentStatistics{0, 0, 0}, lateAppointments(0), onTimeServices(0),
+      cumulativeDelay(0) {}
+
+// run
+// Description: Takes the earliest of the two stream heads and the first departure until all are exhausted.
+//              An arrival wins a tie against a departure, and an appointment against a walk-in.
+void AppointmentBankSimulation::run() {
+    while (walkIns->hasNext() || appointments->hasNext() || !departures.isEmpty()) {
+        const Arrival* next = nullptr;
+        if (appointments->hasNext()) {
+            next = &appointments->peek();
+        }
+        if (walkIns->hasNext() && (next == nullptr || walkIns->peek().time < next->time)) {
+            next = &walkIns->peek();
+        }
+
+        if (next != nullptr && (departures.isEmpty() || next->time <= departures.peek().getTime())) {
+            Arrival customer = *next;
+            if (customer.appointment) {
+                appointments->advance();
+            } else {
+                walkIns->advance();
+            }
+            processArrival(customer);
+        } else {
+            processDeparture();
+        }
+        eventsProcessed++;
+    }
+}
+
+// Getters
+
+int AppointmentBankSimulation::getSimulationTime() const {
+    return simulationTime;
+}
+
+unsigned long long AppointmentBankSimulation::getEventsProcessed() const {
+    return eventsProcessed;
+}
+
+int AppointmentBankSimulation::getCustomerCount() const {
+    return walkInStatistics.customerCount + appointmentStatistics.customerCount;
+}
+
+float AppointmentBankSimulation::getAverageWaitTime() const {
+    return static_cast<float>(walkInStatistics.cumulativeWaitTime + appointmentStatistics.cumulativeWaitTime) /
+           getCustomerCount();
+}
+
+const AppointmentBankSimulation::TypeStatistics& AppointmentBankSimulation::getWalkInStatistics() const {
+    return walkInStatistics;
+}
+
+const AppointmentBankSimulation::TypeStatistics& AppointmentBankSimulation::getAppointmentStatistics() const {
+    return appointmentStatistics;
+}
+
+int AppointmentBankSimulation::getLateAppointments() const {
+    return lateAppointments;
+}
+
+int AppointmentBankSimulation::getOnTimeServices() const {
+    return onTimeServices;
+}
+
+long long AppointmentBankSimulation::getCumulativeDelay() const {
+    return cumulativeDelay;
+}
+
+// Utility method
+// Description: Serves the arriving customer at once if a teller is free; otherwise the customer joins the
+//              priority line or the regular line according to the rule.
+void AppointmentBankSimulation::processArrival(Arrival customer) {
+    simulationTime = customer.time;
+    (customer.appointment ? appointmentStatistics : walkInStatistics).customerCount++;
+
+    if (tellersBusy < tellers) {
+        startService(customer);
+        return;
+    }
+    if (rule == PriorityRule::STRICT && customer.appointment) {
+        if (lateGrace < 0 || customer.time - customer.scheduled <= lateGrace) {
+            priorityLine.enqueue(customer);
+            return;
+        }
+        lateAppointments++;
+    }
+    regularLine.enqueue(customer);
+}
+
+// Utility method
+// Description: The freed teller serves the head of the priority line, or else the head of the regular line.
+void AppointmentBankSimulation::processDeparture() {
+    simulationTime = departures.peek().getTime();
+    departures.dequeue();
+    tellersBusy--;
+
+    Queue<Arrival>* line = !priorityLine.isEmpty() ? &priorityLine : (!regularLine.isEmpty() ? &regularLine : nullptr);
+    if (line != nullptr) {
+        Arrival customer = line->peek();
+        line->dequeue();
+        startService(customer);
+    }
+}
+
+// Utility method
+// Description: Starts serving customer now: records the wait (and for appointments the delay past the
+//              appointment time) and schedules the departure.
+void AppointmentBankSimulation::startService(const Arrival& customer) {
+    int wait = simulationTime - customer.time;
+    TypeStatistics& statistics = customer.appointment ? appointmentStatistics : walkInStatistics;
+    statistics.cumulativeWaitTime += wait;
+    statistics.longestWait = std::max(statistics.longestWait, wait);
+    if (customer.appointment) {
+        if (simulationTime <= customer.scheduled) {
+            onTimeServices++;
+        } else {
+            cumulativeDelay += simulationTime - customer.scheduled;
+        }
+    }
+
+    Event departure(Event::EventType::DEPARTURE, simulationTime + customer.length);
+    departures.enqueue(departure);
+    tellersBusy++;
+}
@@ -0,0 +1,143 @@
+/*
+ * ArrivalStreams.cpp
+ *
+ * Description: This file implements the lazily read arrival streams of the appointment simulation.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include "../include/ArrivalStreams.h"
+
+// Arrival comparison operators
+bool Arrival::operator<(const Arrival& rhs) const {
+    return time < rhs.time || (time == rhs.time && sequence < rhs.sequence);
+}
+
+bool Arrival::operator>(const Arrival& rhs) const {
+    return rhs < *this;
+}
+
+// WalkInStream constructor
+WalkInStream::WalkInStream(std::istream& input) : input(&input), available(false), outOfOrder(false), count(0) {
+    advance();
+}
+
+// hasNext
+bool WalkInStream::hasNext() const {
+    return available;
+}
+
+// peek
+const Arrival& WalkInStream::peek() const {
+    return next;
+}
+
+// advance
+// Description: Reads the next "arrival length" line; a walk-in earlier than the previous one ends the stream.
+void WalkInStream::advance() {
+    int arriveTime, processTime;
+    available = false;
+    if (outOfOrder || !(*input >> arriveTime >> processTime)) {
+        return;
+    }
+    if (count > 0 && arriveTime < next.time) {
+        outOfOrder = true;
+        return;
+    }
+    next.time = arriveTime;
+    next.length = processTime;
+    next.scheduled = arriveTime;
+    next.appointment = false;
+    next.sequence = count++;
+    available = true;
+}
+
+// isOutOfOrder
+bool WalkInStream::isOutOfOrder() const {
+    return outOfOrder;
+}
+
+// AppointmentStream constructor
+AppointmentStream::AppointmentStream(std::istream& input, int earliest, int latest, double noShowProbability,
+                                     unsigned long long seed)
+    : input(&input), earliest(earliest), latest(latest), noShowProbability(noShowProbability), generator(seed),
+      readAhead(false), booked(0), noShows(0), outOfOrder(false) {
+    readBooking();
+    refill();
+}
+
+// hasNext
+bool AppointmentStream::hasNext() const {
+    return !pending.isEmpty();
+}
+
+// peek
+const Arrival& AppointmentStream::peek() const {
+    return pending.peek();
+}
+
+// advance
+void AppointmentStream::advance() {
+    pending.dequeue();
+    refill();
+}
+
+// getBookedCount
+unsigned long long AppointmentStream::getBookedCount() const {
+    return booked;
+}
+
+// getNoShowCount
+unsigned long long AppointmentStream::getNoShowCount() const {
+    return noShows;
+}
+
+// isOutOfOrder
+bool AppointmentStream::isOutOfOrder() const {
+    return outOfOrder;
+}
+
+// Utility method
+// Description: Reads the next booking into lookahead, if there is one.
+void AppointmentStream::readBooking() {
+    int scheduled, length;
+    if (!(*input >> scheduled >> length)) {
+        readAhead = false;
+        return;
+    }
+    if (readAhead && scheduled < lookahead.scheduled) {
+        readAhead = false;
+        outOfOrder = true;
+        return;
+    }
+    lookahead.scheduled = scheduled;
+    lookahead.length = length;
+    lookahead.appointment = true;
+    lookahead.sequence = booked++;
+    readAhead = true;
+}
+
+// Utility method
+// Description: Moves bookings into the pending queue until its first customer is known to arrive before every
+//              unread booking. No-shows are counted and dropped as they are read.
+void AppointmentStream::refill() {
+    while (readAhead && (pending.isEmpty() || pending.peek().time > lookahead.scheduled + earliest)) {
+        Arrival customer = lookahead;
+        bool noShow = noShowProbability > 0 && std::bernoulli_distribution(noShowProbability)(generator);
+        int deviation = (earliest == latest) ? earliest : std::uniform_int_distribution<int>(earliest, latest)(generator);
+        readBooking();
+        if (outOfOrder) {
+            while (!pending.isEmpty()) {
+                pending.dequeue();
+            }
+            return;
+        }
+        if (noShow) {
+            noShows++;
+            continue;
+        }
+        customer.time = customer.scheduled + deviation;
+        pending.enqueue(customer);
+    }
+}
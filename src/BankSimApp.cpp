@@ -1,182 +1,2020 @@
 /*
- * BankSimulation.cpp
+ * BankSimApp.cpp
  *
  * Description:
- * This file implements a simple bank simulation where customers arrive and are either served immediately 
- * if the teller is available or placed in a queue if the teller is busy. The simulation tracks customer 
- * arrivals and departures using events, which are managed in a priority queue. The bank line is represented 
- * as a queue of events waiting to be processed. The simulation calculates and outputs the total number of 
- * customers processed and the average wait time at the end.
+ * This file implements BankSim, the command-line program of the bank simulation. Customers arrive and are
+ * either served immediately if a teller is available or wait in the bank line; the program outputs the
+ * number of customers processed and their average wait.
  *
- * The program consists of the following key components:
- * - processArrival: Handles the arrival of customers, determining whether they are served immediately or 
- *   placed in a waiting line.
- * - processDeparture: Handles the departure of customers after they have been served, updating the queue 
- *   and managing the availability of the teller.
- * - outputEventProcessing: Outputs details of the event currently being processed, helping to track the 
- *   simulation's progress.
- * - Main Function: Initializes the simulation, reads customer data, processes all events, and outputs 
- *   the final statistics, including total customers processed and average wait time.
- *
- * This simulation demonstrates basic event-driven programming concepts using queues and priority queues. 
- * It provides insights into queue management, event handling, and the effects of processing time and 
- * arrival rates on customer wait times.
+ * parseArguments reads the options, chooses one engine (Engine) from them and checks the other options
+ * against the table of the options that engine allows. runBank then dispatches to the engine:
+ * - SIMULATION (the default): BankSimulation, which logs every event (asynchronously with --async-log through
+ *   an EventLogWriter) and, depending on the options, streams or batches the events, runs allocation-free
+ *   (--fixed-capacity) or with a LoserTree (--loser-tree), follows a staffing schedule, re-simulates another
+ *   schedule from a snapshot (--what-if, WhatIfAnalysis), runs replications on worker threads
+ *   (--replications, ReplicationRunner), writes interval statistics, customer statistics and indexed traces
+ *   (--interval, --customer-stats, --trace), or answers with a queueing formula (--analytic, AnalyticModel).
+ * - SCENARIOS: ScenarioComparison compares staffing alternatives on random days (--scenario).
+ * - TAIL_WAIT: SplittingEstimator estimates the probability of very long waits in an M/M/c model
+ *   (--tail-wait).
+ * - BRANCHES: BranchPool simulates many independent branches in one process (--branches).
+ * - NETWORK: ServiceNetwork routes customers through a network of stations (--network).
+ * - APPEND_TRACE: TraceCheckpoint continues a growing trace from its saved state (--append-trace).
+ * - FLUID: FluidApproximation integrates a fluid model instead of simulating the customers (--fluid).
+ * - APPOINTMENTS: AppointmentBankSimulation merges walk-ins with booked appointments (--appointments).
+ * - INTERRUPTIONS: InterruptibleBankSimulation simulates teller breaks and failures (--interrupt,
+ *   --failures).
+ * - RETRIALS: RetrialBankSimulation limits the line; blocked customers retry later (--line-capacity).
+ * - KERNEL: SimulationKernel runs the generic event loop over the chosen event set (--kernel).
+ * Any engine's output can be replayed from a ResultCache instead of running it again (--cache-dir).
  *
  * Author: Kunpeng (Andy) Zhang
- * Last Modified: Sep. 2024
+ * Last Modified: Oct. 2026
  */
 
 #include <iostream>
-#include <iomanip> // For std::setw, used to format the output
+#include <iomanip> // For std::setw, used to align the branch statistics table
+#include <algorithm> // For std::stable_sort, used to sort staffing schedules
+#include <climits> // For INT_MIN, the time of the initial what-if snapshot
+#include <cstdio> // For std::fopen, used to write the interval statistics
+#include <cstdlib> // For std::strtol, std::strtoul and std::strtod, used to parse command-line options
+#include <cstring> // For std::strcmp and std::strncmp, used to parse command-line options
+#include <vector>
 #include "../include/Event.h" // Include the Event class definition
 #include "../include/EmptyDataCollectionException.h" // Include the exception class for empty data collections
-#include "../include/PriorityQueue.h" // Include the PriorityQueue class definition
-#include "../include/Queue.h" // Include the Queue class definition
+#include "../include/FullDataCollectionException.h" // Include the exception class for full fixed-capacity collections
+#include "../include/BankSimulation.h" // Include the simulation engine
+#include "../include/BinaryHeap.h" // Include the binary heap, whose shrink policy can be configured
+#include "../include/EventLogWriter.h" // Include the asynchronous event log writer
+#include "../include/IntervalStatistics.h" // Include the per-interval statistics
+#include "../include/WhatIfAnalysis.h" // Include the snapshot-based what-if analysis
+#include "../include/ReplicationRunner.h" // Include the multi-threaded replication runner
+#include "../include/BranchPool.h" // Include the batched simulation of many branches
+#include "../include/ColumnStatistics.h" // Include the vectorized statistics of per-customer columns
+#include "../include/CustomerRecords.h" // Include the per-customer records
+#include "../include/TraceWriter.h" // Include the indexed trace file writer
+#include "../include/InterruptibleBankSimulation.h" // Include the simulation with teller interruptions
+#include "../include/AppointmentBankSimulation.h" // Include the simulation of walk-ins and appointments
+#include "../include/ServiceNetwork.h" // Include the simulation of a network of service stations
+#include "../include/RetrialBankSimulation.h" // Include the simulation of a finite line with retrials
+#include "../include/SplittingEstimator.h" // Include the rare-event estimator of long waits
+#include "../include/ScenarioComparison.h" // Include the comparison of staffing scenarios with common random numbers
+#include "../include/AnalyticModel.h" // Include the queueing formulas of the analytic mode
+#include "../include/ResultCache.h" // Include the on-disk cache of run outputs
+#include "../include/TraceCheckpoint.h" // Include the checkpoints of growing traces
+#include "../include/FluidApproximation.h" // Include the fluid approximation of very large volumes
+#include "../include/SimulationKernel.h" // Include the policy-based generic simulation kernel
+#include <fstream> // For std::ifstream, used to read the appointment booking sheet, the network and growing traces
+#include <sstream> // For std::istringstream, used to read the routes of network customers
 
 using namespace std;
 
-// Function: processArrival
-// Purpose: This function processes an arrival event in the simulation. It determines whether the teller is available 
-//          or if the customer needs to wait in the queue. If the teller is available, a departure event is scheduled 
-//          immediately. If not, the customer is added to the queue.
-// Parameters:
-//   - newEvent: The arrival event being processed.
-//   - eventPriorityQueue: The priority queue that stores and orders all events in the simulation.
-//   - bankLine: The queue that represents the line of customers waiting for service at the bank.
-//   - simulationTime: The current time in the simulation, updated to the time of the new event.
-//   - tellerAvailable: A boolean flag indicating whether the teller is currently available.
-void processArrival(Event& newEvent, PriorityQueue<Event>& eventPriorityQueue, Queue<Event>& bankLine, int& simulationTime, bool& tellerAvailable) {
-    // Remove the arrival event from the priority queue since it's being processed
-    eventPriorityQueue.dequeue();
-
-    // If the bank line is empty and the teller is available, process the customer immediately
-    if (bankLine.isEmpty() && tellerAvailable) {
-        // Calculate the departure time for this customer based on the current simulation time and their processing time
-        int departureTime = simulationTime + newEvent.getLength();
-
-        // Create a new departure event for this customer
-        Event newDepartureEvent(Event::EventType::DEPARTURE, departureTime);
-
-        // Add the departure event to the priority queue
-        eventPriorityQueue.enqueue(newDepartureEvent);
-
-        // Mark the teller as unavailable since they are now serving a customer
-        tellerAvailable = false;
+// Capacities of the allocation-free simulation used by --fixed-capacity: pending departures (one per
+// teller on duty) and customers waiting in the bank line
+const unsigned int FIXED_EVENT_CAPACITY = 16;
+const unsigned int FIXED_LINE_CAPACITY = 1024;
+typedef FixedBankSimulation<FIXED_EVENT_CAPACITY, FIXED_LINE_CAPACITY> FixedSimulation;
+
+// Event sets of the generic kernel selectable with --kernel (NONE runs BankSimulation); the fixed-capacity kernel
+// has the capacities of --fixed-capacity
+enum class KernelEventSet { NONE, HEAP, LOSER_TREE, FIXED };
+
+// Engines that run the day; parseArguments chooses one from the options, and the bank simulation (SIMULATION)
+// when no other engine is selected
+enum class Engine {
+    SIMULATION, SCENARIOS, TAIL_WAIT, BRANCHES, NETWORK, APPEND_TRACE, FLUID, APPOINTMENTS, INTERRUPTIONS,
+    RETRIALS, KERNEL
+};
+
+// Number of bins of the wait histogram printed by --customer-stats
+const unsigned int WAIT_HISTOGRAM_BINS = 10;
+
+// Structure: SimulationOptions
+// Purpose: Holds the command-line options of the simulation. The defaults reproduce the original
+//          behaviour: one teller, and the event log is written synchronously to standard output.
+struct SimulationOptions {
+    bool logEvents = true;         // --quiet turns off the per-event log
+    bool asyncLog = false;         // --async-log formats and writes the log on a writer thread
+    EventLogWriter::OverflowPolicy logOverflow = EventLogWriter::OverflowPolicy::BLOCK;  // --log-overflow=block|drop
+    unsigned long logRingCapacity = 65536;  // --log-ring=N records buffered between the threads
+    int tellers = 1;               // --tellers=N tellers on duty at the start of the day
+    bool streamArrivals = false;   // --stream-arrivals reads arrivals one at a time (BankSimulation::ArrivalMode::STREAM)
+    vector<StaffingChange> staffing;  // --staffing=T:N,... baseline staffing schedule
+    bool whatIf = false;           // --what-if=T:N,... was given
+    vector<StaffingChange> whatIfStaffing;  // Staffing schedule of the what-if scenario
+    int snapshotInterval = 60;     // --snapshot-interval=N time units between baseline snapshots
+    ReplicationRunner::Options replication;  // --replications=N, --threads=N, --numa, --huge-pages
+    bool replicate = false;        // --replications=N was given
+    bool fixedCapacity = false;    // --fixed-capacity runs an allocation-free FixedSimulation
+    bool batchEvents = false;      // --batch-events processes simultaneous events as a group
+    bool loserTree = false;        // --loser-tree merges per-teller departures with a LoserTree
+    bool customerStats = false;    // --customer-stats keeps per-customer records and summarizes them
+    int waitThreshold = 10;        // --wait-threshold=N counts the customers who waited longer than N
+    int histogramBin = 10;         // --histogram-bin=N width of the wait histogram bins
+    StatisticsKernel statisticsKernel = bestKernel();  // --stats-kernel=scalar|avx2|avx512
+    int interval = 0;              // --interval=N writes statistics every N time units (0 = off)
+    const char* intervalFile = "intervals.csv";  // --interval-file=PATH receives the interval rows
+    IntervalStatistics::Format intervalFormat = IntervalStatistics::Format::CSV;  // --interval-format=csv|binary
+    const char* traceFile = nullptr;  // --trace=PATH writes an indexed trace file of the run
+    int traceBlock = 1024;         // --trace-block=N records per trace index block
+    vector<InterruptibleBankSimulation::Interruption> interruptions;  // --interrupt=T:D[:K],... scheduled breaks
+    bool failures = false;         // --failures=MTBF:MTTR makes every teller fail at random
+    double meanTimeBetweenFailures = 0;
+    double meanTimeToRepair = 0;
+    unsigned long long failureSeed = 1;  // --failure-seed=N seeds the random up and repair times
+    InterruptibleBankSimulation::Policy interruptPolicy = InterruptibleBankSimulation::Policy::PREEMPT_RESUME;  // --interrupt-policy=resume|restart|finish
+    const char* appointmentsFile = nullptr;  // --appointments=PATH merges a booking sheet with the walk-ins
+    int appointmentEarliest = 0;   // --appointment-deviation=E:L customers arrive between E and L after their time
+    int appointmentLatest = 0;
+    double noShowProbability = 0;  // --no-show=P probability that a booked customer does not come
+    unsigned long long appointmentSeed = 1;  // --appointment-seed=N seeds the deviations and no-shows
+    AppointmentBankSimulation::PriorityRule appointmentRule = AppointmentBankSimulation::PriorityRule::STRICT;  // --appointment-priority=strict|fifo
+    int lateGrace = -1;            // --late-grace=N appointments later than N lose priority (negative = never)
+    const char* networkFile = nullptr;  // --network=PATH routes customers through the stations of PATH
+    unsigned long long networkSeed = 1;  // --network-seed=N seeds the random routes and transaction lengths
+    int lineCapacity = -1;         // --line-capacity=N blocks customers who find N waiting (negative = unlimited)
+    double meanRetrialDelay = 10;  // --retrial-mean=T blocked customers retry after exponential delays of mean T
+    unsigned long long retrialSeed = 1;  // --retrial-seed=N seeds the retrial delays
+    double tailWait = -1;          // --tail-wait=W estimates the probability of waiting longer than W (negative = off)
+    SplittingEstimator::Model tailModel;  // The M/M/c model of --tail-wait, from the options below and --tellers
+    SplittingEstimator::Options splitting;  // --split-levels=L,..., --split-effort=N, --split-runs=R, --split-seed=N
+    bool splitCompare = false;     // --split-compare also runs plain simulation with as many customers
+    double meanInterarrivalTime = 1;  // --mean-interarrival=A mean interarrival time of the random models
+    double meanServiceTime = 1;    // --mean-service=S mean service time of the random models
+    vector<ScenarioComparison::Scenario> scenarios;  // --scenario=N[/T:N,...] staffing alternatives to compare
+    ScenarioComparison::Options comparison;  // --scenario-replications=N, --independent-streams, --antithetic, --scenario-seed=N
+    int dayCustomers = 1000;       // --day-customers=N customers per random day of the comparison
+    bool analytic = false;         // --analytic answers with queueing formulas when the day fits a known family
+    int analyticValidation = 0;    // --analytic-validate=N also simulates the first N customers to compare (0 = off)
+    const char* cacheDirectory = nullptr;  // --cache-dir=PATH replays or stores the output of the run in PATH
+    int cacheSize = 256;           // --cache-size=MB megabytes the cache entries may use together
+    const char* appendTrace = nullptr;  // --append-trace=PATH simulates the growing trace PATH from its checkpoint
+    bool verifyPrefix = false;     // --verify-prefix checks every byte of the trace before the checkpoint
+    bool fluid = false;            // --fluid integrates the fluid approximation instead of simulating
+    FluidApproximation::Options fluidOptions;  // --fluid-bin=W, --fluid-scale=K, --fluid-tolerance=E
+    const char* fluidTrajectory = nullptr;  // --fluid-trajectory=PATH writes the state at the end of every bin
+    int heapShrinkFactor = 4;      // --heap-shrink=N shrinks drained event heaps at 1/N use (0 = never)
+    bool branches = false;         // --branches reads "branch arrival length" lines and simulates every branch
+    int sweepLength = 60;          // --sweep=N time units every branch advances per sweep
+    KernelEventSet kernel = KernelEventSet::NONE;  // --kernel=heap|loser-tree|fixed simulates with the generic kernel
+    Engine engine = Engine::SIMULATION;  // The engine chosen by parseArguments
+};
+
+// Function: printUsage
+// Purpose: Prints the supported command-line options to standard error.
+void printUsage(const char* program) {
+    cerr << "Usage: " << program << " [options] < input" << endl
+         << "  --quiet                   Do not print the per-event log" << endl
+         << "  --async-log               Format and write the event log on a separate thread" << endl
+         << "  --log-overflow=block|drop When the log ring is full, wait (default) or drop and count" << endl
+         << "  --log-ring=N              Number of log records buffered between the threads" << endl
+         << "  --tellers=N               Number of tellers on duty at the start of the day (default 1)" << endl
+         << "  --staffing=T:N[,T:N...]   From time T on, N tellers are on duty" << endl
+         << "  --stream-arrivals         Read arrivals one at a time instead of preloading them" << endl
+         << "  --what-if=T:N[,T:N...]    Also simulate this staffing schedule, resuming from a snapshot" << endl
+         << "  --snapshot-interval=N     Time units between baseline snapshots for --what-if (default 60)" << endl
+         << "  --replications=N          Run N replications quietly and report the throughput" << endl
+         << "  --threads=N               Worker threads used for --replications (default 1)" << endl
+         << "  --numa                    Pin workers to NUMA nodes and keep their data node-local" << endl
+         << "  --huge-pages              Back large event priority queue arrays with transparent huge pages" << endl
+         << "  --batch-events            Take all events with the same time out of the queue at once" << endl
+         << "  --interval=N              Write arrivals, waits, line length and utilization every N time units" << endl
+         << "  --interval-file=PATH      File receiving the interval statistics (default intervals.csv)" << endl
+         << "  --interval-format=csv|binary  Format of the interval statistics (default csv)" << endl
+         << "  --trace=PATH              Write every event, service start and staffing change to an indexed trace file" << endl
+         << "  --trace-block=N           Records per block of the trace time index (default 1024)" << endl
+         << "  --interrupt=T:D[:K][,...] Teller K (default 1) is away from time T for D time units" << endl
+         << "  --failures=MTBF:MTTR      Tellers fail after exponential up times and are repaired after exponential repair times" << endl
+         << "  --failure-seed=N          Seed of the random up and repair times (default 1)" << endl
+         << "  --interrupt-policy=P      Interrupted customer: resume, restart or finish (served first; default resume)" << endl
+         << "  --appointments=PATH       Also read \"time length\" appointment bookings from PATH (walk-ins on stdin)" << endl
+         << "  --appointment-deviation=E:L  Customers arrive between E and L time units after their appointment" << endl
+         << "  --no-show=P               Probability that a booked customer does not come (default 0)" << endl
+         << "  --appointment-seed=N      Seed of the deviations and no-shows (default 1)" << endl
+         << "  --appointment-priority=R  strict (appointments served first, default) or fifo" << endl
+         << "  --late-grace=N            Appointments arriving more than N late lose their priority" << endl
+         << "  --network=PATH            Route customers through the stations of PATH; input lines are" << endl
+         << "                            \"arrival length [STATION:LENGTH ...]\"" << endl
+         << "  --network-seed=N          Seed of the random routes and transaction lengths (default 1)" << endl
+         << "  --line-capacity=N         At most N customers wait; others are blocked and retry later" << endl
+         << "  --retrial-mean=T          Mean of the exponential delay before a blocked customer retries (default 10)" << endl
+         << "  --retrial-seed=N          Seed of the retrial delays (default 1)" << endl
+         << "  --tail-wait=W             Estimate P(wait > W) of an M/M/c bank by splitting (reads no input)" << endl
+         << "  --mean-interarrival=A     Mean interarrival time of --tail-wait and --scenario (default 1)" << endl
+         << "  --mean-service=S          Mean service time of --tail-wait and --scenario (default 1)" << endl
+         << "  --split-levels=L,...      Increasing line lengths at which trajectories are split (default: automatic)" << endl
+         << "  --split-effort=N          Trajectories per splitting stage (default 1000)" << endl
+         << "  --split-runs=R            Independent runs for the confidence interval (default 10)" << endl
+         << "  --split-seed=N            Seed of the model's random times (default 1)" << endl
+         << "  --split-compare           Also estimate by plain simulation of as many customers" << endl
+         << "  --scenario=N[/T:N,...]    Staffing alternative: N tellers, then the given changes; give two or more" << endl
+         << "                            to compare them on random days (reads no input)" << endl
+         << "  --day-customers=N         Customers per random day (default 1000)" << endl
+         << "  --scenario-replications=N Random days per scenario (default 20)" << endl
+         << "  --independent-streams     Give every scenario its own customers instead of common random numbers" << endl
+         << "  --antithetic              Simulate the days in antithetic pairs (even number of replications)" << endl
+         << "  --scenario-seed=N         Seed of the random days (default 1)" << endl
+         << "  --analytic                Answer with M/M/c, M/G/1 or G/G/c formulas when the day fits; simulate otherwise" << endl
+         << "  --analytic-validate=N     Also simulate the first N customers and compare with the formula" << endl
+         << "  --cache-dir=PATH          Replay the output of an identical earlier run from PATH, or store this one" << endl
+         << "  --cache-size=MB           Megabytes of the cache; least recently used entries are evicted (default 256)" << endl
+         << "  --append-trace=PATH       Simulate the growing trace PATH, continuing from PATH.checkpoint" << endl
+         << "                            with the customers appended since the last run" << endl
+         << "  --verify-prefix           Check every byte of the trace before the checkpoint, not only the last 4 KiB" << endl
+         << "  --fluid                   Integrate a fluid approximation of the queue instead of simulating customers" << endl
+         << "  --fluid-bin=W             Time units per arrival rate bin of --fluid (default 60)" << endl
+         << "  --fluid-scale=K           Multiply the arrival rates and tellers by K (default 1)" << endl
+         << "  --fluid-tolerance=E       Relative error allowed per integration step (default 1e-6)" << endl
+         << "  --fluid-trajectory=PATH   Write the state at the end of every bin to PATH (CSV)" << endl
+         << "  --heap-shrink=N           Shrink a drained event priority queue once 1/N of it is used (0 = never)" << endl
+         << "  --branches                Input lines are \"branch arrival length\"; simulate all branches at once" << endl
+         << "  --sweep=N                 Time units each branch advances per sweep with --branches (default 60)" << endl
+         << "  --loser-tree              Merge per-teller departures with a loser tree (implies --stream-arrivals)" << endl
+         << "  --customer-stats          Keep per-customer records and print wait statistics after the run" << endl
+         << "  --wait-threshold=N        Count the customers who waited longer than N (default 10)" << endl
+         << "  --histogram-bin=N         Width of the wait histogram bins (default 10)" << endl
+         << "  --stats-kernel=K          Statistics kernel: scalar, avx2 or avx512 (default: best supported)" << endl
+         << "  --fixed-capacity          Use allocation-free containers (at most " << FIXED_EVENT_CAPACITY
+         << " tellers, " << FIXED_LINE_CAPACITY << " waiting customers)" << endl
+         << "  --kernel=heap|loser-tree|fixed  Simulate with the generic kernel on this event set (no event log)" << endl;
+}
+
+// Function: parseInteger
+// Purpose: Parses a whole string as an int no smaller than minimum.
+// Returns: true if text is a valid integer in range, otherwise false.
+bool parseInteger(const char* text, int minimum, int& value) {
+    char* end = nullptr;
+    long parsed = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || parsed < minimum || parsed > INT_MAX) {
+        return false;
+    }
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+// Function: parsePositive
+// Purpose: Parses a positive floating-point number.
+// Returns: true if text is such a number, otherwise false.
+bool parsePositive(const char* text, double& value) {
+    char* end = nullptr;
+    value = strtod(text, &end);
+    return end != text && *end == '\0' && value > 0;
+}
+
+// Function: parseLevels
+// Purpose: Parses a list "L,L,..." of positive, strictly increasing splitting levels.
+// Returns: true if the list is well formed, otherwise false.
+bool parseLevels(const char* text, vector<int>& levels) {
+    levels.clear();
+    const char* cursor = text;
+    while (true) {
+        char* end = nullptr;
+        long level = strtol(cursor, &end, 10);
+        if (end == cursor || level <= 0 || level > static_cast<long>(SplittingEstimator::MAX_LINE) ||
+            (!levels.empty() && level <= levels.back())) {
+            return false;
+        }
+        levels.push_back(static_cast<int>(level));
+        if (*end == '\0') {
+            return true;
+        }
+        if (*end != ',') {
+            return false;
+        }
+        cursor = end + 1;
+    }
+}
+
+// Function: parseSchedule
+// Purpose: Parses a staffing schedule "T:N,T:N,..." and sorts it by time.
+// Returns: true if the schedule is well formed, otherwise false.
+bool parseSchedule(const char* text, vector<StaffingChange>& schedule) {
+    schedule.clear();
+    const char* cursor = text;
+    while (*cursor != '\0') {
+        char* end = nullptr;
+        StaffingChange change;
+        change.time = static_cast<int>(strtol(cursor, &end, 10));
+        if (end == cursor || *end != ':') {
+            return false;
+        }
+        cursor = end + 1;
+        change.tellers = static_cast<int>(strtol(cursor, &end, 10));
+        if (end == cursor || change.tellers < 0 || (*end != ',' && *end != '\0')) {
+            return false;
+        }
+        schedule.push_back(change);
+        cursor = (*end == ',') ? end + 1 : end;
+    }
+    stable_sort(schedule.begin(), schedule.end(),
+                [](const StaffingChange& lhs, const StaffingChange& rhs) { return lhs.time < rhs.time; });
+    return !schedule.empty();
+}
+
+// Function: parseScenario
+// Purpose: Parses a staffing alternative "N" or "N/T:N,...": the tellers at the start of the day and the
+//          staffing schedule after.
+// Returns: true if the scenario is well formed, otherwise false.
+bool parseScenario(const char* text, ScenarioComparison::Scenario& scenario) {
+    scenario.staffing.clear();
+    const char* slash = strchr(text, '/');
+    string tellers = slash == nullptr ? string(text) : string(text, slash);
+    return parseInteger(tellers.c_str(), 1, scenario.tellers) &&
+           (slash == nullptr || parseSchedule(slash + 1, scenario.staffing));
+}
+
+// Function: parseIntegerField
+// Purpose: Parses the integer at the start of text, setting end past it, for lists of fields such as "T:D".
+// Returns: true if text starts with an integer in the range of int, otherwise false.
+bool parseIntegerField(const char* text, char*& end, int& value) {
+    long parsed = strtol(text, &end, 10);
+    if (end == text || parsed < INT_MIN || parsed > INT_MAX) {
+        return false;
+    }
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+// Function: parseInterruptions
+// Purpose: Parses scheduled interruptions "T:D[:K],..." (teller K, numbered from 1, is away from time T for
+//          D time units) into interruptions with tellers numbered from 0.
+// Returns: true if the list is well formed, otherwise false.
+bool parseInterruptions(const char* text, vector<InterruptibleBankSimulation::Interruption>& interruptions) {
+    const char* cursor = text;
+    while (*cursor != '\0') {
+        char* end = nullptr;
+        InterruptibleBankSimulation::Interruption interruption;
+        if (!parseIntegerField(cursor, end, interruption.time) || *end != ':') {
+            return false;
+        }
+        cursor = end + 1;
+        if (!parseIntegerField(cursor, end, interruption.duration) || interruption.duration < 1) {
+            return false;
+        }
+        interruption.teller = 0;
+        if (*end == ':') {
+            cursor = end + 1;
+            if (!parseIntegerField(cursor, end, interruption.teller) || interruption.teller < 1) {
+                return false;
+            }
+            interruption.teller--;
+        }
+        if (*end != ',' && *end != '\0') {
+            return false;
+        }
+        interruptions.push_back(interruption);
+        cursor = (*end == ',') ? end + 1 : end;
+    }
+    return !interruptions.empty();
+}
+
+// Function: parseFailures
+// Purpose: Parses "MTBF:MTTR", the positive mean up time and mean repair time of the tellers.
+// Returns: true if both means are valid, otherwise false.
+bool parseFailures(const char* text, SimulationOptions& options) {
+    char* end = nullptr;
+    options.meanTimeBetweenFailures = strtod(text, &end);
+    if (end == text || *end != ':' || !(options.meanTimeBetweenFailures > 0)) {
+        return false;
+    }
+    const char* cursor = end + 1;
+    options.meanTimeToRepair = strtod(cursor, &end);
+    if (end == cursor || *end != '\0' || !(options.meanTimeToRepair > 0)) {
+        return false;
+    }
+    options.failures = true;
+    return true;
+}
+
+// Function: parseDeviation
+// Purpose: Parses "E:L", the range of deviations of appointment arrivals from their appointment times.
+// Returns: true if E <= L, otherwise false.
+bool parseDeviation(const char* text, SimulationOptions& options) {
+    char* end = nullptr;
+    long earliest = strtol(text, &end, 10);
+    if (end == text || *end != ':') {
+        return false;
+    }
+    const char* cursor = end + 1;
+    long latest = strtol(cursor, &end, 10);
+    if (end == cursor || *end != '\0' || earliest > latest || earliest < -INT_MAX / 4 || latest > INT_MAX / 4) {
+        return false;
+    }
+    options.appointmentEarliest = static_cast<int>(earliest);
+    options.appointmentLatest = static_cast<int>(latest);
+    return true;
+}
+
+// Options that change how an engine runs or what it outputs; each engine allows some of them
+enum Modifier : unsigned int {
+    STAFFING = 1u << 0,
+    FIXED_CAPACITY = 1u << 1,
+    LOSER_TREE = 1u << 2,
+    BATCH_EVENTS = 1u << 3,
+    INTERVAL = 1u << 4,
+    WHAT_IF = 1u << 5,
+    REPLICATIONS = 1u << 6,
+    CUSTOMER_STATS = 1u << 7,
+    TRACE = 1u << 8,
+    ANALYTIC = 1u << 9,
+    CACHE = 1u << 10,
+    ASYNC_LOG = 1u << 11,
+    FLUID_TRAJECTORY = 1u << 12
+};
+
+// Structure: ModifierOption
+// Purpose: The command-line option of a modifier, used to name it in errors.
+struct ModifierOption {
+    Modifier modifier;
+    const char* name;
+};
+
+const ModifierOption MODIFIER_OPTIONS[] = {
+    {STAFFING, "--staffing"}, {FIXED_CAPACITY, "--fixed-capacity"}, {LOSER_TREE, "--loser-tree"},
+    {BATCH_EVENTS, "--batch-events"}, {INTERVAL, "--interval"}, {WHAT_IF, "--what-if"},
+    {REPLICATIONS, "--replications"}, {CUSTOMER_STATS, "--customer-stats"}, {TRACE, "--trace"},
+    {ANALYTIC, "--analytic"}, {CACHE, "--cache-dir"}, {ASYNC_LOG, "--async-log"},
+    {FLUID_TRAJECTORY, "--fluid-trajectory"}};
+
+// Modifiers that every engine accepts (they only matter to some of them)
+const unsigned int ANY_ENGINE = ASYNC_LOG | FLUID_TRAJECTORY;
+
+// Structure: EngineRule
+// Purpose: The modifiers an engine allows. The engines other than the bank simulation read their own input
+//          or none, and have their own outputs, so they take none of the options that describe a simulated
+//          day; the generic kernel has no batched step either. The tail estimator's measured times, and a
+//          growing trace read from its own file, cannot be cached.
+struct EngineRule {
+    Engine engine;
+    unsigned int allowed;
+};
+
+const EngineRule ENGINE_RULES[] = {
+    {Engine::SIMULATION, STAFFING | FIXED_CAPACITY | LOSER_TREE | BATCH_EVENTS | INTERVAL | WHAT_IF | REPLICATIONS |
+                             CUSTOMER_STATS | TRACE | ANALYTIC | CACHE | ANY_ENGINE},
+    {Engine::SCENARIOS, BATCH_EVENTS | CACHE | ANY_ENGINE},
+    {Engine::TAIL_WAIT, BATCH_EVENTS | ANY_ENGINE},
+    {Engine::BRANCHES, LOSER_TREE | BATCH_EVENTS | CACHE | ANY_ENGINE},
+    {Engine::NETWORK, BATCH_EVENTS | CACHE | ANY_ENGINE},
+    {Engine::APPEND_TRACE, STAFFING | BATCH_EVENTS | ANY_ENGINE},
+    {Engine::FLUID, STAFFING | BATCH_EVENTS | CACHE | ANY_ENGINE},
+    {Engine::APPOINTMENTS, BATCH_EVENTS | CACHE | ANY_ENGINE},
+    {Engine::INTERRUPTIONS, BATCH_EVENTS | CACHE | ANY_ENGINE},
+    {Engine::RETRIALS, BATCH_EVENTS | CACHE | ANY_ENGINE},
+    {Engine::KERNEL, CACHE | ANY_ENGINE}};
+
+// Structure: ModifierConflict
+// Purpose: Modifiers that no engine combines with a given one. The fixed-capacity and loser-tree
+//          simulations are not used for what-if snapshots or replications, and interval statistics, customer
+//          records and traces describe a single run; the analytic mode answers without a simulated run; the
+//          cache records standard output and standard error only, so files written by the run are not
+//          replayed, the asynchronous log bypasses the recorded stream, and measured times would be replayed
+//          as new measurements.
+struct ModifierConflict {
+    Modifier modifier;
+    unsigned int excluded;
+};
+
+const ModifierConflict MODIFIER_CONFLICTS[] = {
+    {FIXED_CAPACITY, LOSER_TREE | WHAT_IF | REPLICATIONS},
+    {LOSER_TREE, WHAT_IF | REPLICATIONS},
+    {INTERVAL, WHAT_IF | REPLICATIONS},
+    {CUSTOMER_STATS, WHAT_IF | REPLICATIONS},
+    {TRACE, WHAT_IF | REPLICATIONS},
+    {ANALYTIC, INTERVAL | WHAT_IF | REPLICATIONS | CUSTOMER_STATS | TRACE},
+    {CACHE, ASYNC_LOG | INTERVAL | TRACE | FLUID_TRAJECTORY | REPLICATIONS}};
+
+// Structure: EngineOption
+// Purpose: An engine selected on the command line and the option that selected it.
+struct EngineOption {
+    Engine engine;
+    const char* name;
+};
+
+// Function: selectedEngines
+// Purpose: Lists the engines selected by options, in the order runBank gives them precedence.
+vector<EngineOption> selectedEngines(const SimulationOptions& options) {
+    vector<EngineOption> selected;
+    if (!options.scenarios.empty()) {
+        selected.push_back({Engine::SCENARIOS, "--scenario"});
+    }
+    if (options.tailWait >= 0) {
+        selected.push_back({Engine::TAIL_WAIT, "--tail-wait"});
+    }
+    if (options.branches) {
+        selected.push_back({Engine::BRANCHES, "--branches"});
+    }
+    if (options.networkFile != nullptr) {
+        selected.push_back({Engine::NETWORK, "--network"});
+    }
+    if (options.appendTrace != nullptr) {
+        selected.push_back({Engine::APPEND_TRACE, "--append-trace"});
+    }
+    if (options.fluid) {
+        selected.push_back({Engine::FLUID, "--fluid"});
+    }
+    if (options.appointmentsFile != nullptr) {
+        selected.push_back({Engine::APPOINTMENTS, "--appointments"});
+    }
+    // Scheduled interruptions and random failures are simulated together by the same engine
+    if (!options.interruptions.empty() || options.failures) {
+        selected.push_back({Engine::INTERRUPTIONS, options.interruptions.empty() ? "--failures" : "--interrupt"});
+    }
+    if (options.lineCapacity >= 0) {
+        selected.push_back({Engine::RETRIALS, "--line-capacity"});
+    }
+    if (options.kernel != KernelEventSet::NONE) {
+        selected.push_back({Engine::KERNEL, "--kernel"});
+    }
+    return selected;
+}
+
+// Function: modifiersOf
+// Purpose: Collects the modifiers given in options.
+unsigned int modifiersOf(const SimulationOptions& options) {
+    unsigned int modifiers = 0;
+    modifiers |= options.staffing.empty() ? 0 : STAFFING;
+    modifiers |= options.fixedCapacity ? FIXED_CAPACITY : 0;
+    modifiers |= options.loserTree ? LOSER_TREE : 0;
+    modifiers |= options.batchEvents ? BATCH_EVENTS : 0;
+    modifiers |= options.interval > 0 ? INTERVAL : 0;
+    modifiers |= options.whatIf ? WHAT_IF : 0;
+    modifiers |= options.replicate ? REPLICATIONS : 0;
+    modifiers |= options.customerStats ? CUSTOMER_STATS : 0;
+    modifiers |= options.traceFile != nullptr ? TRACE : 0;
+    modifiers |= options.analytic ? ANALYTIC : 0;
+    modifiers |= options.cacheDirectory != nullptr ? CACHE : 0;
+    modifiers |= options.asyncLog ? ASYNC_LOG : 0;
+    modifiers |= options.fluidTrajectory != nullptr ? FLUID_TRAJECTORY : 0;
+    return modifiers;
+}
+
+// Function: modifierName
+// Purpose: Finds the command-line option of a modifier.
+const char* modifierName(Modifier modifier) {
+    for (const ModifierOption& option : MODIFIER_OPTIONS) {
+        if (option.modifier == modifier) {
+            return option.name;
+        }
+    }
+    return "";
+}
+
+// Function: rejectOptions
+// Purpose: Reports an invalid use of the options to standard error.
+// Returns: false, so that parseArguments can return it.
+bool rejectOptions(const string& reason) {
+    cerr << "Invalid options: " << reason << endl;
+    return false;
+}
+
+// Function: rejectPair
+// Purpose: Reports two options that cannot be combined.
+// Returns: false.
+bool rejectPair(const char* first, const char* second) {
+    return rejectOptions(string(first) + " cannot be combined with " + second);
+}
+
+// Function: validateOptions
+// Purpose: Chooses the engine of options and checks that it allows every other option given.
+// Returns: true if the options can be combined, otherwise false after naming the options that conflict.
+bool validateOptions(SimulationOptions& options) {
+    // At most one engine; the bank simulation runs when none is selected
+    vector<EngineOption> engines = selectedEngines(options);
+    if (engines.size() > 1) {
+        return rejectPair(engines[0].name, engines[1].name);
+    }
+    options.engine = engines.empty() ? Engine::SIMULATION : engines[0].engine;
+    const char* engineName = engines.empty() ? nullptr : engines[0].name;
+
+    // Options that only refine another one
+    if (options.analyticValidation > 0 && !options.analytic) {
+        return rejectOptions("--analytic-validate requires --analytic");
+    }
+    if (options.verifyPrefix && options.engine != Engine::APPEND_TRACE) {
+        return rejectOptions("--verify-prefix requires --append-trace");
+    }
+
+    // The modifiers the engine allows, then the pairs of modifiers no engine combines
+    unsigned int modifiers = modifiersOf(options);
+    for (const EngineRule& rule : ENGINE_RULES) {
+        if (rule.engine != options.engine) {
+            continue;
+        }
+        for (const ModifierOption& modifier : MODIFIER_OPTIONS) {
+            if ((modifiers & modifier.modifier) != 0 && (rule.allowed & modifier.modifier) == 0) {
+                return rejectPair(engineName, modifier.name);
+            }
+        }
+    }
+    for (const ModifierConflict& conflict : MODIFIER_CONFLICTS) {
+        if ((modifiers & conflict.modifier) == 0) {
+            continue;
+        }
+        for (const ModifierOption& modifier : MODIFIER_OPTIONS) {
+            if ((modifiers & conflict.excluded & modifier.modifier) != 0) {
+                return rejectPair(modifierName(conflict.modifier), modifier.name);
+            }
+        }
+    }
+
+    // Checks of the engine's own options
+    switch (options.engine) {
+        case Engine::SCENARIOS:
+            // Antithetic pairs need an even number of days and at least two pairs
+            if (options.scenarios.size() < 2) {
+                return rejectOptions("--scenario must be given at least twice");
+            }
+            if (options.comparison.antithetic &&
+                (options.comparison.replications % 2 != 0 || options.comparison.replications < 4)) {
+                return rejectOptions("--antithetic requires an even --scenario-replications of at least 4");
+            }
+            break;
+        case Engine::TAIL_WAIT:
+            // The tail estimator simulates its own M/M/c model, which must be stable and fit in its fixed
+            // containers
+            options.tailModel.tellers = options.tellers;
+            options.tailModel.meanInterarrivalTime = options.meanInterarrivalTime;
+            options.tailModel.meanServiceTime = options.meanServiceTime;
+            options.tailModel.waitThreshold = options.tailWait;
+            if (!SplittingEstimator::isStable(options.tailModel)) {
+                return rejectOptions("--tail-wait requires a stable model (--mean-service below --tellers times "
+                                     "--mean-interarrival)");
+            }
+            if (options.tellers > static_cast<int>(SplittingEstimator::MAX_TELLERS)) {
+                return rejectOptions("--tail-wait supports at most " +
+                                     std::to_string(SplittingEstimator::MAX_TELLERS) + " tellers");
+            }
+            break;
+        case Engine::INTERRUPTIONS:
+            // The interruptible simulation numbers its tellers
+            for (const InterruptibleBankSimulation::Interruption& interruption : options.interruptions) {
+                if (interruption.teller >= options.tellers) {
+                    return rejectOptions("--interrupt names teller " + std::to_string(interruption.teller + 1) +
+                                         " but --tellers is " + std::to_string(options.tellers));
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+// Function: parseArguments
+// Purpose: Fills options from the command-line arguments.
+// Returns: true if every argument was recognized and valid, otherwise false.
+bool parseArguments(int argc, char* argv[], SimulationOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--quiet") == 0) {
+            options.logEvents = false;
+        } else if (strcmp(arg, "--async-log") == 0) {
+            options.asyncLog = true;
+        } else if (strcmp(arg, "--log-overflow=block") == 0) {
+            options.logOverflow = EventLogWriter::OverflowPolicy::BLOCK;
+        } else if (strcmp(arg, "--log-overflow=drop") == 0) {
+            options.logOverflow = EventLogWriter::OverflowPolicy::DROP;
+        } else if (strncmp(arg, "--log-ring=", 11) == 0) {
+            char* end = nullptr;
+            options.logRingCapacity = strtoul(arg + 11, &end, 10);
+            if (*end != '\0' || options.logRingCapacity == 0) {
+                return false;
+            }
+        } else if (strncmp(arg, "--tellers=", 10) == 0) {
+            if (!parseInteger(arg + 10, 1, options.tellers)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--staffing=", 11) == 0) {
+            if (!parseSchedule(arg + 11, options.staffing)) {
+                return false;
+            }
+        } else if (strcmp(arg, "--stream-arrivals") == 0) {
+            options.streamArrivals = true;
+        } else if (strncmp(arg, "--what-if=", 10) == 0) {
+            if (!parseSchedule(arg + 10, options.whatIfStaffing)) {
+                return false;
+            }
+            options.whatIf = true;
+        } else if (strncmp(arg, "--snapshot-interval=", 20) == 0) {
+            if (!parseInteger(arg + 20, 1, options.snapshotInterval)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--replications=", 15) == 0) {
+            int replications = 0;
+            if (!parseInteger(arg + 15, 1, replications)) {
+                return false;
+            }
+            options.replication.replications = static_cast<unsigned int>(replications);
+            options.replicate = true;
+        } else if (strncmp(arg, "--threads=", 10) == 0) {
+            int threads = 0;
+            if (!parseInteger(arg + 10, 1, threads)) {
+                return false;
+            }
+            options.replication.threads = static_cast<unsigned int>(threads);
+        } else if (strcmp(arg, "--numa") == 0) {
+            options.replication.numaAware = true;
+        } else if (strcmp(arg, "--huge-pages") == 0) {
+            options.replication.hugePages = true;
+        } else if (strcmp(arg, "--batch-events") == 0) {
+            options.batchEvents = true;
+        } else if (strncmp(arg, "--interval=", 11) == 0) {
+            if (!parseInteger(arg + 11, 1, options.interval)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--interval-file=", 16) == 0) {
+            options.intervalFile = arg + 16;
+        } else if (strcmp(arg, "--interval-format=csv") == 0) {
+            options.intervalFormat = IntervalStatistics::Format::CSV;
+        } else if (strcmp(arg, "--interval-format=binary") == 0) {
+            options.intervalFormat = IntervalStatistics::Format::BINARY;
+        } else if (strncmp(arg, "--trace=", 8) == 0) {
+            options.traceFile = arg + 8;
+        } else if (strncmp(arg, "--trace-block=", 14) == 0) {
+            if (!parseInteger(arg + 14, 1, options.traceBlock)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--interrupt=", 12) == 0) {
+            if (!parseInterruptions(arg + 12, options.interruptions)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--failures=", 11) == 0) {
+            if (!parseFailures(arg + 11, options)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--failure-seed=", 15) == 0) {
+            char* end = nullptr;
+            options.failureSeed = strtoull(arg + 15, &end, 10);
+            if (end == arg + 15 || *end != '\0') {
+                return false;
+            }
+        } else if (strcmp(arg, "--interrupt-policy=resume") == 0) {
+            options.interruptPolicy = InterruptibleBankSimulation::Policy::PREEMPT_RESUME;
+        } else if (strcmp(arg, "--interrupt-policy=restart") == 0) {
+            options.interruptPolicy = InterruptibleBankSimulation::Policy::PREEMPT_RESTART;
+        } else if (strcmp(arg, "--interrupt-policy=finish") == 0) {
+            options.interruptPolicy = InterruptibleBankSimulation::Policy::FINISH_CURRENT;
+        } else if (strncmp(arg, "--appointments=", 15) == 0) {
+            options.appointmentsFile = arg + 15;
+        } else if (strncmp(arg, "--appointment-deviation=", 24) == 0) {
+            if (!parseDeviation(arg + 24, options)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--no-show=", 10) == 0) {
+            char* end = nullptr;
+            options.noShowProbability = strtod(arg + 10, &end);
+            if (end == arg + 10 || *end != '\0' || !(options.noShowProbability >= 0 && options.noShowProbability <= 1)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--appointment-seed=", 19) == 0) {
+            char* end = nullptr;
+            options.appointmentSeed = strtoull(arg + 19, &end, 10);
+            if (end == arg + 19 || *end != '\0') {
+                return false;
+            }
+        } else if (strcmp(arg, "--appointment-priority=strict") == 0) {
+            options.appointmentRule = AppointmentBankSimulation::PriorityRule::STRICT;
+        } else if (strcmp(arg, "--appointment-priority=fifo") == 0) {
+            options.appointmentRule = AppointmentBankSimulation::PriorityRule::FIFO;
+        } else if (strncmp(arg, "--late-grace=", 13) == 0) {
+            if (!parseInteger(arg + 13, 0, options.lateGrace)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--network=", 10) == 0) {
+            options.networkFile = arg + 10;
+        } else if (strncmp(arg, "--network-seed=", 15) == 0) {
+            char* end = nullptr;
+            options.networkSeed = strtoull(arg + 15, &end, 10);
+            if (end == arg + 15 || *end != '\0') {
+                return false;
+            }
+        } else if (strncmp(arg, "--line-capacity=", 16) == 0) {
+            if (!parseInteger(arg + 16, 0, options.lineCapacity)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--retrial-mean=", 15) == 0) {
+            char* end = nullptr;
+            options.meanRetrialDelay = strtod(arg + 15, &end);
+            if (end == arg + 15 || *end != '\0' || !(options.meanRetrialDelay > 0)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--retrial-seed=", 15) == 0) {
+            char* end = nullptr;
+            options.retrialSeed = strtoull(arg + 15, &end, 10);
+            if (end == arg + 15 || *end != '\0') {
+                return false;
+            }
+        } else if (strncmp(arg, "--tail-wait=", 12) == 0) {
+            char* end = nullptr;
+            options.tailWait = strtod(arg + 12, &end);
+            if (end == arg + 12 || *end != '\0' || !(options.tailWait >= 0)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--mean-interarrival=", 20) == 0) {
+            if (!parsePositive(arg + 20, options.meanInterarrivalTime)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--mean-service=", 15) == 0) {
+            if (!parsePositive(arg + 15, options.meanServiceTime)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--split-levels=", 15) == 0) {
+            if (!parseLevels(arg + 15, options.splitting.levels)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--split-effort=", 15) == 0) {
+            int effort = 0;
+            if (!parseInteger(arg + 15, 1, effort)) {
+                return false;
+            }
+            options.splitting.effort = static_cast<unsigned int>(effort);
+        } else if (strncmp(arg, "--split-runs=", 13) == 0) {
+            int runs = 0;
+            if (!parseInteger(arg + 13, 1, runs)) {
+                return false;
+            }
+            options.splitting.runs = static_cast<unsigned int>(runs);
+        } else if (strncmp(arg, "--split-seed=", 13) == 0) {
+            char* end = nullptr;
+            options.splitting.seed = strtoull(arg + 13, &end, 10);
+            if (end == arg + 13 || *end != '\0') {
+                return false;
+            }
+        } else if (strcmp(arg, "--split-compare") == 0) {
+            options.splitCompare = true;
+        } else if (strncmp(arg, "--scenario=", 11) == 0) {
+            ScenarioComparison::Scenario scenario;
+            if (!parseScenario(arg + 11, scenario)) {
+                return false;
+            }
+            options.scenarios.push_back(scenario);
+        } else if (strncmp(arg, "--day-customers=", 16) == 0) {
+            if (!parseInteger(arg + 16, 1, options.dayCustomers)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--scenario-replications=", 24) == 0) {
+            int replications = 0;
+            if (!parseInteger(arg + 24, 2, replications)) {
+                return false;
+            }
+            options.comparison.replications = static_cast<unsigned int>(replications);
+        } else if (strcmp(arg, "--independent-streams") == 0) {
+            options.comparison.commonRandomNumbers = false;
+        } else if (strcmp(arg, "--antithetic") == 0) {
+            options.comparison.antithetic = true;
+        } else if (strncmp(arg, "--scenario-seed=", 16) == 0) {
+            char* end = nullptr;
+            options.comparison.seed = strtoull(arg + 16, &end, 10);
+            if (end == arg + 16 || *end != '\0') {
+                return false;
+            }
+        } else if (strcmp(arg, "--analytic") == 0) {
+            options.analytic = true;
+        } else if (strncmp(arg, "--analytic-validate=", 20) == 0) {
+            if (!parseInteger(arg + 20, 1, options.analyticValidation)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--cache-dir=", 12) == 0) {
+            options.cacheDirectory = arg + 12;
+            if (*options.cacheDirectory == '\0') {
+                return false;
+            }
+        } else if (strncmp(arg, "--cache-size=", 13) == 0) {
+            if (!parseInteger(arg + 13, 1, options.cacheSize)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--append-trace=", 15) == 0) {
+            options.appendTrace = arg + 15;
+            if (*options.appendTrace == '\0') {
+                return false;
+            }
+        } else if (strcmp(arg, "--verify-prefix") == 0) {
+            options.verifyPrefix = true;
+        } else if (strcmp(arg, "--fluid") == 0) {
+            options.fluid = true;
+        } else if (strncmp(arg, "--fluid-bin=", 12) == 0) {
+            if (!parseInteger(arg + 12, 1, options.fluidOptions.binWidth)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--fluid-scale=", 14) == 0) {
+            if (!parseInteger(arg + 14, 1, options.fluidOptions.scale)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--fluid-tolerance=", 18) == 0) {
+            if (!parsePositive(arg + 18, options.fluidOptions.tolerance)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--fluid-trajectory=", 19) == 0) {
+            options.fluidTrajectory = arg + 19;
+        } else if (strncmp(arg, "--heap-shrink=", 14) == 0) {
+            if (!parseInteger(arg + 14, 0, options.heapShrinkFactor) ||
+                (options.heapShrinkFactor > 0 && options.heapShrinkFactor < 3)) {
+                return false;
+            }
+        } else if (strcmp(arg, "--branches") == 0) {
+            options.branches = true;
+        } else if (strncmp(arg, "--sweep=", 8) == 0) {
+            if (!parseInteger(arg + 8, 1, options.sweepLength)) {
+                return false;
+            }
+        } else if (strcmp(arg, "--loser-tree") == 0) {
+            options.loserTree = true;
+        } else if (strcmp(arg, "--customer-stats") == 0) {
+            options.customerStats = true;
+        } else if (strncmp(arg, "--wait-threshold=", 17) == 0) {
+            if (!parseInteger(arg + 17, 0, options.waitThreshold)) {
+                return false;
+            }
+        } else if (strncmp(arg, "--histogram-bin=", 16) == 0) {
+            if (!parseInteger(arg + 16, 1, options.histogramBin)) {
+                return false;
+            }
+        } else if (strcmp(arg, "--stats-kernel=scalar") == 0) {
+            options.statisticsKernel = StatisticsKernel::SCALAR;
+        } else if (strcmp(arg, "--stats-kernel=avx2") == 0) {
+            options.statisticsKernel = StatisticsKernel::AVX2;
+        } else if (strcmp(arg, "--stats-kernel=avx512") == 0) {
+            options.statisticsKernel = StatisticsKernel::AVX512;
+        } else if (strcmp(arg, "--fixed-capacity") == 0) {
+            options.fixedCapacity = true;
+        } else if (strcmp(arg, "--kernel=heap") == 0) {
+            options.kernel = KernelEventSet::HEAP;
+        } else if (strcmp(arg, "--kernel=loser-tree") == 0) {
+            options.kernel = KernelEventSet::LOSER_TREE;
+        } else if (strcmp(arg, "--kernel=fixed") == 0) {
+            options.kernel = KernelEventSet::FIXED;
+        } else {
+            return false;
+        }
+    }
+    return validateOptions(options);
+}
+
+// Function: printStatistics
+// Purpose: Outputs the number of customers processed and their average wait time.
+template <typename Simulation>
+void printStatistics(const Simulation& simulation) {
+    cout << "    Total number of people processed: " << simulation.getCustomerCount() << endl;
+    cout << "    Average amount of time spent waiting: " << simulation.getAverageWaitTime() << endl;
+}
+
+// Function: printCustomerStatistics
+// Purpose: Summarizes the wait column of records in one pass and outputs the wait statistics and histogram.
+void printCustomerStatistics(const CustomerRecords& records, const SimulationOptions& options) {
+    // A kernel the CPU does not support falls back to the best one it does
+    StatisticsKernel kernel = isKernelSupported(options.statisticsKernel) ? options.statisticsKernel : bestKernel();
+    const vector<int>& waits = records.getWaits();
+    ColumnSummary summary = summarizeColumn(waits.data(), waits.size(), options.waitThreshold,
+                                            options.histogramBin, WAIT_HISTOGRAM_BINS, kernel);
+
+    cout << "\nCustomer Statistics:\n" << endl;
+    cout << "    Customers served: " << summary.count << endl;
+    cout << "    Mean wait: " << summary.mean() << endl;
+    cout << "    Wait variance: " << summary.variance() << endl;
+    cout << "    Shortest wait: " << summary.minimum << endl;
+    cout << "    Longest wait: " << summary.maximum << endl;
+    cout << "    Waited longer than " << options.waitThreshold << ": " << summary.aboveThreshold << endl;
+    cout << "    Wait histogram:" << endl;
+    for (unsigned int bin = 0; bin < summary.binCount; bin++) {
+        long long low = static_cast<long long>(bin) * options.histogramBin;
+        cout << "        " << setw(8) << low;
+        if (bin + 1 < summary.binCount) {
+            cout << " - " << setw(8) << left << low + options.histogramBin - 1 << right;
+        } else {
+            cout << " and up    ";
+        }
+        cout << setw(10) << summary.histogram[bin] << endl;
+    }
+    cout << "    Kernel: " << kernelName(kernel) << endl;
+}
+
+// Function: runSimulation
+// Purpose: Runs simulation to completion with the baseline staffing schedule and the event log, appending
+//          a record per served customer to records (if not nullptr) and writing the trace file (if requested).
+// Returns: false if a fixed-capacity container of the simulation overflowed, otherwise true.
+template <typename Simulation>
+bool runSimulation(Simulation& simulation, const SimulationOptions& options, EventLogWriter* asyncLog,
+                   CustomerRecords* records = nullptr) {
+    // Interval rows go to their own file, so that they never mix with the event log
+    IntervalStatistics* intervals = nullptr;
+    std::FILE* intervalOutput = nullptr;
+    if (options.interval > 0) {
+        intervalOutput = std::fopen(options.intervalFile, options.intervalFormat == IntervalStatistics::Format::CSV ? "w" : "wb");
+        if (intervalOutput == nullptr) {
+            cerr << "Cannot open " << options.intervalFile << endl;
+            return false;
+        }
+        intervals = new IntervalStatistics(intervalOutput, options.interval, options.intervalFormat);
+    }
+    TraceWriter* trace = nullptr;
+    std::FILE* traceOutput = nullptr;
+    if (options.traceFile != nullptr) {
+        traceOutput = std::fopen(options.traceFile, "wb");
+        if (traceOutput == nullptr) {
+            cerr << "Cannot open " << options.traceFile << endl;
+            delete intervals;
+            if (intervalOutput != nullptr) {
+                std::fclose(intervalOutput);
+            }
+            return false;
+        }
+        trace = new TraceWriter(traceOutput, static_cast<std::uint32_t>(options.traceBlock));
+    }
+
+    simulation.setStaffingSchedule(&options.staffing);
+    simulation.setEventLog(options.logEvents, asyncLog);
+    simulation.setBatchEvents(options.batchEvents);
+    simulation.setIntervalStatistics(intervals);
+    simulation.setCustomerRecords(records);
+    simulation.setTraceWriter(trace);
+    bool completed = true;
+    try {
+        simulation.run();
+    } catch (const FullDataCollectionException& exception) {
+        cerr << exception.what() << endl;
+        completed = false;
+    }
+
+    simulation.setCustomerRecords(nullptr);
+    if (intervals != nullptr) {
+        simulation.setIntervalStatistics(nullptr);
+        delete intervals;  // Writes the last row
+        std::fclose(intervalOutput);
+    }
+    if (trace != nullptr) {
+        simulation.setTraceWriter(nullptr);
+        if (!trace->finish()) {
+            cerr << "Cannot write " << options.traceFile << endl;
+        }
+        delete trace;
+        std::fclose(traceOutput);
+    }
+    return completed;
+}
+
+// Function: finishEventLog
+// Purpose: Waits for the asynchronous log writer (if any) to drain, reports dropped records and
+//          deletes the writer.
+void finishEventLog(EventLogWriter* asyncLog) {
+    if (asyncLog != nullptr) {
+        asyncLog->finish();
+        if (asyncLog->getDroppedCount() > 0) {
+            cerr << "Event log: " << asyncLog->getDroppedCount() << " records dropped" << endl;
+        }
+        delete asyncLog;
+    }
+}
+
+// Function: runReplications
+// Purpose: Runs the replications requested by --replications and outputs the statistics of one
+//          replication followed by the throughput achieved on each NUMA node.
+void runReplications(const vector<Event>& arrivals, const SimulationOptions& options) {
+    ReplicationRunner runner(arrivals, options.tellers, options.staffing);
+    ReplicationRunner::Report report = runner.run(options.replication);
+
+    cout << "Simulation Ends" << endl;
+    cout << "\nFinal Statistics:\n" << endl;
+    cout << "    Total number of people processed: " << report.customerCount << endl;
+    cout << "    Average amount of time spent waiting: " << report.averageWaitTime << endl;
+
+    cout << "\nReplication Statistics:\n" << endl;
+    cout << "    Replications: " << options.replication.replications << " on " << options.replication.threads
+         << " thread(s), " << report.nodes.size() << " NUMA node(s)"
+         << (options.replication.numaAware ? ", pinned" : "")
+         << (options.replication.hugePages ? ", huge pages" : "") << endl;
+    for (const ReplicationRunner::NodeReport& node : report.nodes) {
+        cout << "    Node " << node.node << ": " << node.threads << " thread(s), " << node.replications
+             << " replications, " << node.events << " events, "
+             << static_cast<unsigned long long>(node.events / report.wallSeconds) << " events/s" << endl;
+    }
+    cout << "    Total: " << report.events << " events in " << report.wallSeconds << " s, "
+         << static_cast<unsigned long long>(report.events / report.wallSeconds) << " events/s" << endl;
+    if (!report.consistent) {
+        cout << "    Warning: replications produced different statistics" << endl;
+    }
+}
+
+// Function: runBranches
+// Purpose: Reads "branch arrival length" lines, simulates all branches in one BranchPool and outputs one
+//          table row per branch, followed by the totals.
+void runBranches(const SimulationOptions& options) {
+    int branch, arriveTime, processTime;
+    vector<int> branches;
+    vector<Event> arrivals;
+    while (cin >> branch >> arriveTime >> processTime) {
+        branches.push_back(branch);
+        arrivals.push_back(Event(Event::EventType::ARRIVAL, arriveTime, processTime));
+    }
+
+    BranchPool pool(branches, arrivals, options.tellers);
+    pool.run(options.sweepLength);
+
+    cout << "Simulation Ends" << endl;
+    cout << "\nBranch Statistics:\n" << endl;
+    cout << "    " << setw(10) << "Branch" << setw(12) << "Customers" << setw(14) << "Average wait"
+         << setw(12) << "Events" << endl;
+    unsigned long long events = 0;
+    for (const BranchPool::BranchStatistics& entry : pool.getStatistics()) {
+        cout << "    " << setw(10) << entry.branch << setw(12) << entry.customerCount << setw(14)
+             << entry.averageWaitTime << setw(12) << entry.eventsProcessed << endl;
+        events += entry.eventsProcessed;
+    }
+    cout << "\n    Total: " << pool.getBranchCount() << " branches, " << arrivals.size() << " customers, "
+         << events << " events in " << pool.getSweepCount() << " sweeps" << endl;
+}
+
+// Function: policyName
+// Purpose: Returns the name of an interruption policy as given to --interrupt-policy.
+const char* policyName(InterruptibleBankSimulation::Policy policy) {
+    switch (policy) {
+        case InterruptibleBankSimulation::Policy::PREEMPT_RESTART:
+            return "restart";
+        case InterruptibleBankSimulation::Policy::FINISH_CURRENT:
+            return "finish";
+        default:
+            return "resume";
+    }
+}
+
+// Function: runInterruptions
+// Purpose: Simulates the day with the requested teller interruptions and once without them, and outputs the
+//          statistics of the interrupted day followed by the interruptions and their impact on the waits.
+void runInterruptions(const vector<Event>& arrivals, const SimulationOptions& options) {
+    InterruptibleBankSimulation baseline(arrivals, options.tellers, options.interruptPolicy);
+    baseline.run();
+    InterruptibleBankSimulation simulation(arrivals, options.tellers, options.interruptPolicy);
+    simulation.setSchedule(options.interruptions);
+    if (options.failures) {
+        simulation.setFailures(options.meanTimeBetweenFailures, options.meanTimeToRepair, options.failureSeed);
+    }
+    simulation.run();
+
+    cout << "Simulation Ends" << endl;
+    cout << "\nFinal Statistics:\n" << endl;
+    printStatistics(simulation);
+
+    cout << "\nInterruption Statistics:\n" << endl;
+    cout << "    Policy: " << policyName(options.interruptPolicy) << endl;
+    cout << "    Interruptions: " << simulation.getScheduledInterruptions() << " scheduled, "
+         << simulation.getRandomInterruptions() << " random" << endl;
+    cout << "    Customers preempted: " << simulation.getPreemptions() << endl;
+    cout << "    Service time lost to restarts: " << simulation.getLostServiceTime() << endl;
+    cout << "    Teller time unavailable: " << simulation.getUnavailableTime() << endl;
+    cout << "    Average wait without interruptions: " << baseline.getAverageWaitTime() << endl;
+    cout << "    Average wait with interruptions: " << simulation.getAverageWaitTime() << endl;
+    cout << "    Longest wait without interruptions: " << baseline.getLongestWait() << endl;
+    cout << "    Longest wait with interruptions: " << simulation.getLongestWait() << endl;
+}
+
+// Function: runAppointments
+// Purpose: Simulates the walk-ins of standard input together with the appointments of the booking sheet and
+//          outputs the final statistics followed by the statistics of each arrival type.
+// Returns: The exit status: 1 if the booking sheet cannot be read or an input is out of order, otherwise 0.
+int runAppointments(const SimulationOptions& options) {
+    std::ifstream bookings(options.appointmentsFile);
+    if (!bookings) {
+        cerr << "Cannot open " << options.appointmentsFile << endl;
+        return 1;
+    }
+    WalkInStream walkIns(cin);
+    AppointmentStream appointments(bookings, options.appointmentEarliest, options.appointmentLatest,
+                                   options.noShowProbability, options.appointmentSeed);
+    AppointmentBankSimulation simulation(walkIns, appointments, options.tellers, options.appointmentRule,
+                                         options.lateGrace);
+    simulation.run();
+    if (walkIns.isOutOfOrder() || appointments.isOutOfOrder()) {
+        cerr << (walkIns.isOutOfOrder() ? "Walk-ins must be sorted by arrival time"
+                                        : "Appointments must be sorted by appointment time") << endl;
+        return 1;
+    }
+
+    cout << "Simulation Ends" << endl;
+    cout << "\nFinal Statistics:\n" << endl;
+    printStatistics(simulation);
+
+    const AppointmentBankSimulation::TypeStatistics& walkIn = simulation.getWalkInStatistics();
+    const AppointmentBankSimulation::TypeStatistics& appointment = simulation.getAppointmentStatistics();
+    cout << "\nArrival Type Statistics:\n" << endl;
+    cout << "    Walk-ins: " << walkIn.customerCount << " customers, average wait "
+         << (walkIn.customerCount > 0 ? walkIn.averageWaitTime() : 0) << ", longest wait " << walkIn.longestWait << endl;
+    cout << "    Appointments: " << appointment.customerCount << " customers, average wait "
+         << (appointment.customerCount > 0 ? appointment.averageWaitTime() : 0) << ", longest wait "
+         << appointment.longestWait << endl;
+    cout << "    Appointments booked: " << appointments.getBookedCount() << ", no-shows: "
+         << appointments.getNoShowCount() << endl;
+    cout << "    Late appointments without priority: " << simulation.getLateAppointments() << endl;
+    cout << "    Served by their appointment time: " << simulation.getOnTimeServices() << endl;
+    cout << "    Average delay past appointment time: "
+         << (appointment.customerCount > 0 ? static_cast<float>(simulation.getCumulativeDelay()) / appointment.customerCount : 0)
+         << endl;
+    return 0;
+}
+
+// Function: printTailEstimate
+// Purpose: Outputs one estimate of the tail probability with its confidence interval and cost.
+void printTailEstimate(const char* method, const SplittingEstimator::Estimate& estimate) {
+    cout << "    " << method << ": " << estimate.probability << " +/- " << estimate.halfWidth << " (95%), "
+         << estimate.customers << " customers in " << estimate.seconds << " s" << endl;
+}
+
+// Function: runTailEstimate
+// Purpose: Estimates the probability that a customer of the M/M/c model waits longer than the threshold by
+//          splitting (and, if requested, by plain simulation of as many customers) and outputs the estimates.
+// Returns: The exit status: 1 if the line outgrew the estimator's capacity, otherwise 0.
+int runTailEstimate(const SimulationOptions& options) {
+    SplittingEstimator estimator(options.tailModel);
+    vector<int> levels = options.splitting.levels.empty() ? estimator.defaultLevels() : options.splitting.levels;
+    try {
+        SplittingEstimator::Estimate splitting = estimator.estimate(options.splitting);
+
+        cout << "Simulation Ends" << endl;
+        cout << "\nTail Estimate:\n" << endl;
+        cout << "    Model: M/M/" << options.tellers << ", mean interarrival " << options.tailModel.meanInterarrivalTime
+             << ", mean service " << options.tailModel.meanServiceTime << endl;
+        cout << "    P(wait > " << options.tailWait << ")" << endl;
+        cout << "    Levels:";
+        for (size_t k = 0; k < levels.size(); k++) {
+            cout << " " << levels[k] << " (" << splitting.levelProbabilities[k] << ")";
+        }
+        cout << endl;
+        printTailEstimate("Splitting", splitting);
+        if (options.splitCompare) {
+            SplittingEstimator::Estimate crude =
+                estimator.estimateCrude(splitting.customers / options.splitting.runs, options.splitting.runs,
+                                        options.splitting.seed);
+            printTailEstimate("Plain simulation", crude);
+        }
+    } catch (const FullDataCollectionException& exception) {
+        cerr << exception.what() << endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Function: runScenarioComparison
+// Purpose: Compares the staffing scenarios on random days and outputs each scenario's mean wait, and each
+//          scenario's difference to the first with the variance reduction achieved.
+void runScenarioComparison(const SimulationOptions& options) {
+    ScenarioComparison::Model model;
+    model.meanInterarrivalTime = options.meanInterarrivalTime;
+    model.meanServiceTime = options.meanServiceTime;
+    model.customers = options.dayCustomers;
+    ScenarioComparison comparison(model, options.scenarios);
+    ScenarioComparison::Report report = comparison.run(options.comparison);
+
+    cout << "Simulation Ends" << endl;
+    cout << "\nScenario Comparison:\n" << endl;
+    cout << "    " << options.comparison.replications << " days of " << options.dayCustomers << " customers, "
+         << (options.comparison.commonRandomNumbers ? "common random numbers" : "independent streams")
+         << (options.comparison.antithetic ? ", antithetic pairs" : "") << ", " << report.events << " events" << endl;
+    if (options.meanServiceTime < 1) {
+        cout << "    Mean transaction length: 1 (requested " << options.meanServiceTime
+             << ", lengths are whole time units)" << endl;
+    }
+    cout << endl;
+    cout << "    " << setw(10) << "Scenario" << setw(16) << "Average wait" << setw(12) << "+/- (95%)" << setw(16)
+         << "Difference" << setw(12) << "+/- (95%)" << setw(12) << "Reduction" << endl;
+    for (size_t s = 0; s < report.scenarios.size(); s++) {
+        cout << "    " << setw(10) << s + 1 << setw(16) << report.scenarios[s].meanWait << setw(12)
+             << report.scenarios[s].halfWidth;
+        if (s > 0) {
+            const ScenarioComparison::DifferenceSummary& difference = report.differences[s - 1];
+            cout << setw(16) << difference.meanDifference << setw(12) << difference.halfWidth << setw(12)
+                 << difference.reduction;
+        }
+        cout << endl;
+    }
+    cout << "\n    Differences are to scenario 1. A reduction of R means independent streams would need R times" << endl
+         << "    as many days for the same precision." << endl;
+}
+
+// Function: runRetrials
+// Purpose: Simulates the day with a bank line of limited capacity and outputs the statistics of the served
+//          customers followed by the blocking and orbit statistics.
+void runRetrials(const vector<Event>& arrivals, const SimulationOptions& options) {
+    RetrialBankSimulation simulation(arrivals, options.tellers, options.lineCapacity, options.meanRetrialDelay,
+                                     options.retrialSeed);
+    simulation.run();
+
+    cout << "Simulation Ends" << endl;
+    cout << "\nFinal Statistics:\n" << endl;
+    printStatistics(simulation);
+
+    cout << "\nRetrial Statistics:\n" << endl;
+    cout << "    Line capacity: " << options.lineCapacity << ", mean retrial delay: " << options.meanRetrialDelay << endl;
+    cout << "    Blocked arrivals: " << simulation.getBlockedArrivals() << " of " << arrivals.size() << endl;
+    cout << "    Blocking probability: " << simulation.getBlockingProbability() << endl;
+    cout << "    Retrials: " << simulation.getRetrials() << ", blocked again: " << simulation.getBlockedRetrials() << endl;
+    cout << "    Average orbit size: " << simulation.getAverageOrbitSize() << endl;
+    cout << "    Largest orbit size: " << simulation.getLargestOrbit() << endl;
+    cout << "    Longest wait (orbit included): " << simulation.getLongestWait() << endl;
+    if (simulation.getUnservedCustomers() > 0) {
+        cout << "    Unserved customers (retrial after the last representable time): "
+             << simulation.getUnservedCustomers() << endl;
+    }
+}
+
+// Function: runKernel
+// Purpose: Simulates the day with the generic Kernel and outputs its final statistics.
+// Returns: The exit status: 1 if a fixed-capacity container of the kernel overflowed.
+template <typename Kernel>
+int runKernel(const vector<Event>& arrivals, const SimulationOptions& options) {
+    vector<KernelEvent<int>> customers;
+    customers.reserve(arrivals.size());
+    for (const Event& arrival : arrivals) {
+        customers.push_back(KernelEvent<int>{arrival.getTime(), arrival.getLength()});
+    }
+    Kernel::sortArrivals(customers);
+
+    // A fixed-capacity kernel holds its containers, so it is kept off the stack
+    Kernel* kernel = new Kernel(customers, options.tellers);
+    try {
+        kernel->run();
+    } catch (const FullDataCollectionException& exception) {
+        cerr << exception.what() << endl;
+        delete kernel;
+        return 1;
+    }
+
+    cout << "Simulation Ends" << endl;
+    cout << "\nFinal Statistics:\n" << endl;
+    printStatistics(kernel->getStatistics());
+    delete kernel;
+    return 0;
+}
+
+// Function: runAnalytic
+// Purpose: Fits the analytic model to the day and, if a formula applies, outputs its answer: the final
+//          statistics followed by the fitted model and, with --analytic-validate, a short simulation of the
+//          same day for comparison.
+// Returns: true if the day was answered, false if it has to be simulated (the reason goes to standard error).
+bool runAnalytic(const vector<Event>& arrivals, const SimulationOptions& options) {
+    vector<Event> sorted = arrivals;
+    BankSimulation::sortArrivals(sorted);
+    AnalyticModel model(sorted, options.tellers);
+    const char* reason = !options.staffing.empty() ? "the staffing changes over the day" : model.getReason().c_str();
+    if (!options.staffing.empty() || model.getFamily() == AnalyticModel::Family::NONE) {
+        cerr << "No formula applies (" << reason << "); simulating" << endl;
+        return false;
+    }
+
+    cout << "Simulation Ends" << endl;
+    cout << "\nFinal Statistics:\n" << endl;
+    cout << "    Total number of people processed: " << model.getCustomerCount() << endl;
+    cout << "    Average amount of time spent waiting: " << model.getMeanWait() << endl;
+
+    cout << "\nAnalytic Statistics:\n" << endl;
+    cout << "    Model: " << AnalyticModel::familyName(model.getFamily())
+         << (model.getFamily() == AnalyticModel::Family::GGC ? " (Allen-Cunneen approximation)" : " (exact)")
+         << " with " << options.tellers << " teller" << (options.tellers == 1 ? "" : "s") << endl;
+    cout << "    Arrival rate: " << model.getArrivalRate() << ", interarrival SCV: " << model.getInterarrivalScv() << endl;
+    cout << "    Mean service time: " << model.getMeanService() << ", service SCV: " << model.getServiceScv() << endl;
+    cout << "    Utilization: " << model.getUtilization() << endl;
+    cout << "    Probability of waiting: " << model.getProbabilityOfWait() << endl;
+    cout << "    Average line length: " << model.getMeanLineLength() << endl;
+
+    if (options.analyticValidation > 0) {
+        size_t count = min(sorted.size(), static_cast<size_t>(options.analyticValidation));
+        vector<Event> day(sorted.begin(), sorted.begin() + count);
+        BankSimulation simulation(day, options.tellers, BankSimulation::ArrivalMode::STREAM);
+        simulation.setEventLog(false);
+        simulation.run();
+        double simulated = simulation.getAverageWaitTime();
+        cout << "    Simulated average wait of the first " << count << " customers: " << simulated;
+        if (simulated > 0) {
+            cout << " (formula off by " << (model.getMeanWait() - simulated) / simulated * 100 << "%)";
+        }
+        cout << endl;
+    }
+    return true;
+}
+
+// Function: runAppendTrace
+// Purpose: Simulates the growing trace of --append-trace: continues from its checkpoint with the customers
+//          appended since, or simulates it from the start if the checkpoint does not describe it, saves the
+//          state at its last arrival for the next run, and outputs the final statistics of the whole trace
+//          followed by what this run simulated.
+// Returns: The exit status: 1 if the trace cannot be read, otherwise 0.
+int runAppendTrace(const SimulationOptions& options) {
+    ifstream file(options.appendTrace, ios::binary);
+    if (!file) {
+        cerr << "Cannot open " << options.appendTrace << endl;
+        return 1;
+    }
+    // The file is identified before it is read, so that a change during the run is noticed by the next one
+    TraceCheckpoint::TraceFile traceFile;
+    TraceCheckpoint::identify(options.appendTrace, traceFile);
+    file.seekg(0, ios::end);
+    const uint64_t traceSize = static_cast<uint64_t>(file.tellg());
+    traceFile.size = traceSize;
+    const string checkpointPath = string(options.appendTrace) + ".checkpoint";
+
+    // Reads the trace from offset base to its end into tail
+    string tail;
+    uint64_t base = 0, bytesRead = 0;
+    auto readFrom = [&](uint64_t from) {
+        base = min(from, traceSize);
+        tail.assign(static_cast<size_t>(traceSize - base), '\0');
+        file.clear();
+        file.seekg(static_cast<streamoff>(base));
+        file.read(&tail[0], static_cast<streamsize>(tail.size()));
+        tail.resize(static_cast<size_t>(file.gcount()));
+        bytesRead += tail.size();
+    };
+
+    // The configuration the checkpoint must have been saved under
+    ResultCache::KeyBuilder builder;
+    builder.addFile("/proc/self/exe");
+    builder.add(&options.tellers, sizeof(options.tellers));
+    for (const StaffingChange& change : options.staffing) {
+        builder.add(&change, sizeof(change));
+    }
+    ResultCache::Key configuration = builder.finish();
+
+    // A checkpoint is validated by the file and the window of the trace before its offset, so only the window
+    // and the appended bytes are read; the whole trace is read if it is simulated from the start, or to check
+    // the prefix hash with --verify-prefix or after the trace was rewritten without growing
+    TraceCheckpoint checkpoint;
+    string reason = "there is no checkpoint";
+    bool resumed = checkpoint.read(checkpointPath);
+    const bool rewritten = resumed && checkpoint.wasRewritten(traceFile);
+    const bool verifyPrefix = options.verifyPrefix || rewritten;
+    readFrom(resumed && !verifyPrefix ? TraceCheckpoint::windowStart(checkpoint.hashedLength) : 0);
+    resumed = resumed && checkpoint.describes(tail, base, traceFile, configuration, reason) &&
+              (!verifyPrefix || checkpoint.verifiesPrefix(tail, reason));
+    vector<Event> arrivals;
+    uint64_t offset = 0;
+    if (resumed) {
+        offset = base + TraceCheckpoint::parseArrivals(tail, checkpoint.offset - base, arrivals);
+        for (const Event& arrival : arrivals) {
+            if (arrival.getTime() < checkpoint.lastArrivalTime) {
+                reason = "an appended customer arrives before the last customer of the checkpoint";
+                resumed = false;
+                break;
+            }
+        }
+    }
+    if (!resumed) {
+        if (base > 0) {
+            readFrom(0);
+        }
+        arrivals.clear();
+        offset = TraceCheckpoint::parseArrivals(tail, 0, arrivals);
+    }
+    int lastArrivalTime = resumed ? checkpoint.lastArrivalTime : INT_MIN;
+    for (const Event& arrival : arrivals) {
+        lastArrivalTime = max(lastArrivalTime, arrival.getTime());
+    }
+    BankSimulation::sortArrivals(arrivals);
+
+    // Simulate up to the last arrival and save the state there, then finish the day
+    BankSimulation simulation(arrivals, options.tellers, BankSimulation::ArrivalMode::STREAM);
+    simulation.setEventLog(false);
+    if (!options.staffing.empty()) {
+        simulation.setStaffingSchedule(&options.staffing);
+    }
+    unsigned long long eventsBefore = 0;
+    if (resumed) {
+        simulation.restoreState(checkpoint.state);
+        eventsBefore = checkpoint.state.eventsProcessed;
+    }
+    while (simulation.getArrivalsStarted() < arrivals.size()) {
+        simulation.step();
+    }
+    TraceCheckpoint next;
+    next.configuration = configuration;
+    next.offset = offset;
+    next.hashedLength = min<uint64_t>(offset + 1, base + tail.size());
+    next.windowHash = TraceCheckpoint::hashWindow(tail, base, next.hashedLength);
+    const uint64_t prefixHashed = resumed ? checkpoint.hashedLength : 0;
+    next.prefixHash = TraceCheckpoint::hashPrefix(resumed ? checkpoint.prefixHash : ResultCache::Key{0, 0},
+                                                  tail.data() + (prefixHashed - base),
+                                                  static_cast<size_t>(next.hashedLength - prefixHashed));
+    next.traceFile = traceFile;
+    next.lastArrivalTime = lastArrivalTime;
+    next.state = simulation.saveState();
+    simulation.run();
+
+    cout << "Simulation Ends" << endl;
+    cout << "\nFinal Statistics:\n" << endl;
+    printStatistics(simulation);
+
+    cout << "\nAppend Statistics:\n" << endl;
+    if (resumed) {
+        cout << "    Resumed from the checkpoint after " << checkpoint.state.customerCount << " customers" << endl;
     } else {
-        // If the teller is busy, add the customer to the bank line to wait for service
-        bankLine.enqueue(newEvent);
-    }
-}
-
-// Function: processDeparture
-// Purpose: This function processes a departure event in the simulation. It either moves the next customer in line 
-//          to the teller or marks the teller as available if no customers are waiting.
-// Parameters:
-//   - newEvent: The departure event being processed.
-//   - eventPriorityQueue: The priority queue that stores and orders all events in the simulation.
-//   - bankLine: The queue that represents the line of customers waiting for service at the bank.
-//   - simulationTime: The current time in the simulation, updated to the time of the new event.
-//   - tellerAvailable: A boolean flag indicating whether the teller is currently available.
-//   - cumulativeWaitTime: A running total of all customers' wait times, used to calculate the average wait time.
-void processDeparture(Event& newEvent, PriorityQueue<Event>& eventPriorityQueue, Queue<Event>& bankLine, int& simulationTime, bool& tellerAvailable, int& cumulativeWaitTime) {
-    // Remove the departure event from the priority queue since it's being processed
-    eventPriorityQueue.dequeue();
-
-    // If there are customers waiting in the bank line, move the next customer to the teller
-    if (!bankLine.isEmpty()) {
-        // Get the next customer from the bank line
-        Event customer = bankLine.peek();
-        bankLine.dequeue();
-
-        // Calculate the customer's wait time based on the current simulation time and their arrival time
-        int waitTime = simulationTime - customer.getTime();
-        cumulativeWaitTime += waitTime; // Update the cumulative wait time
-
-        // Calculate the departure time for this customer based on the current simulation time and their processing time
-        int departureTime = simulationTime + customer.getLength();
-
-        // Create a new departure event for this customer
-        Event newDepartureEvent(Event::EventType::DEPARTURE, departureTime);
-
-        // Add the departure event to the priority queue
-        eventPriorityQueue.enqueue(newDepartureEvent);
+        cout << "    Simulated from the start: " << reason << endl;
+    }
+    cout << "    Customers simulated: " << arrivals.size() << endl;
+    cout << "    Events processed: " << simulation.getEventsProcessed() - eventsBefore << endl;
+    cout << "    Trace bytes read: " << bytesRead << " of " << traceSize << endl;
+    if (verifyPrefix) {
+        cout << "    Checked before the checkpoint: every byte"
+             << (rewritten ? " (the trace was written without growing)" : "") << endl;
     } else {
-        // If no customers are waiting, mark the teller as available
-        tellerAvailable = true;
+        cout << "    Checked before the checkpoint: the last " << TraceCheckpoint::CHECK_WINDOW
+             << " bytes and the file's identity; earlier changes" << endl
+             << "    to a trace that also grew are not noticed (--verify-prefix checks every byte)" << endl;
+    }
+    if (!next.write(checkpointPath)) {
+        cerr << "Cannot write " << checkpointPath << endl;
+    }
+    return 0;
+}
+
+// Function: runFluid
+// Purpose: Reads the customers of standard input into the fluid approximation, integrates it and outputs the
+//          final statistics followed by the fluid statistics, and the trajectory if requested.
+// Returns: The exit status: 1 if there are no customers or the trajectory cannot be written, otherwise 0.
+int runFluid(const SimulationOptions& options) {
+    FluidApproximation fluid(options.tellers, options.staffing, options.fluidOptions);
+    int arriveTime, processTime;
+    unsigned long long customers = 0;
+    while (cin >> arriveTime >> processTime) {
+        fluid.addCustomer(arriveTime, processTime);
+        customers++;
+    }
+    if (customers == 0) {
+        cerr << "The fluid approximation needs at least one customer" << endl;
+        return 1;
+    }
+    FluidApproximation::Result result = fluid.run();
+
+    cout << "Simulation Ends" << endl;
+    cout << "\nFinal Statistics:\n" << endl;
+    cout << "    Total number of people processed: " << static_cast<unsigned long long>(result.customers) << endl;
+    cout << "    Average amount of time spent waiting: " << result.averageWait << endl;
+
+    cout << "\nFluid Statistics:\n" << endl;
+    cout << "    Bins: " << result.trajectory.size() << " of " << options.fluidOptions.binWidth
+         << " time units, scale " << options.fluidOptions.scale << endl;
+    cout << "    Average line length: " << result.averageLineLength << endl;
+    cout << "    Peak line length: " << result.peakLineLength << " at time " << result.peakTime << endl;
+    cout << "    Drained at time: " << result.drainedAt << endl;
+    cout << "    Steps accepted: " << result.acceptedSteps << ", rejected: " << result.rejectedSteps << endl;
+
+    if (options.fluidTrajectory != nullptr) {
+        std::ofstream trajectory(options.fluidTrajectory);
+        trajectory << "time,arrival_rate,tellers,in_bank,line_length,wait\n";
+        for (const FluidApproximation::Sample& sample : result.trajectory) {
+            trajectory << sample.time << ',' << sample.arrivalRate << ',' << sample.tellers << ',' << sample.inBank
+                       << ',' << sample.lineLength << ',' << sample.wait << '\n';
+        }
+        if (!trajectory) {
+            cerr << "Cannot write " << options.fluidTrajectory << endl;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Function: runNetwork
+// Purpose: Reads the network and the customers of standard input, routes the customers through the stations
+//          and outputs the final statistics followed by the end-to-end and per-station statistics.
+// Returns: The exit status: 1 if the network or a customer line cannot be read, otherwise 0.
+int runNetwork(const SimulationOptions& options) {
+    std::ifstream file(options.networkFile);
+    if (!file) {
+        cerr << "Cannot open " << options.networkFile << endl;
+        return 1;
+    }
+    vector<ServiceNetwork::Station> stations;
+    vector<ServiceNetwork::Route> routes;
+    string error;
+    if (!ServiceNetwork::readConfiguration(file, stations, routes, error)) {
+        cerr << options.networkFile << ": " << error << endl;
+        return 1;
+    }
+    ServiceNetwork network(stations, routes, options.networkSeed);
+
+    // Customers with their routes, resolved to station indices; sorted by arrival time like the streamed
+    // simulation
+    struct NetworkCustomer {
+        int arrival;
+        int length;
+        vector<pair<int, int>> route;
+    };
+    vector<NetworkCustomer> customers;
+    string line;
+    int lineNumber = 0;
+    while (getline(cin, line)) {
+        lineNumber++;
+        istringstream fields(line);
+        NetworkCustomer customer;
+        if (!(fields >> customer.arrival)) {
+            continue;
+        }
+        bool valid = static_cast<bool>(fields >> customer.length);
+        string visit;
+        while (valid && fields >> visit) {
+            size_t colon = visit.rfind(':');
+            int station = colon == string::npos ? -1 : network.findStation(visit.substr(0, colon));
+            int length = 0;
+            valid = station >= 0 && parseInteger(visit.c_str() + colon + 1, 1, length);
+            customer.route.push_back(make_pair(station, length));
+        }
+        if (!valid) {
+            cerr << "Line " << lineNumber << ": expected \"arrival length [STATION:LENGTH ...]\" with known stations" << endl;
+            return 1;
+        }
+        customers.push_back(customer);
+    }
+    stable_sort(customers.begin(), customers.end(),
+                [](const NetworkCustomer& a, const NetworkCustomer& b) { return a.arrival < b.arrival; });
+    for (const NetworkCustomer& customer : customers) {
+        network.addCustomer(customer.arrival, customer.length, customer.route);
+    }
+    network.run();
+
+    cout << "Simulation Ends" << endl;
+    cout << "\nFinal Statistics:\n" << endl;
+    printStatistics(network);
+
+    cout << "\nNetwork Statistics:\n" << endl;
+    cout << "    Average time in the bank: " << (customers.empty() ? 0 : network.getAverageTimeInBank()) << endl;
+    cout << "    Average stations visited: " << (customers.empty() ? 0 : network.getAverageVisits()) << endl;
+    cout << "    Events processed: " << network.getEventsProcessed() << endl << endl;
+    cout << "    " << setw(12) << "Station" << setw(9) << "Servers" << setw(10) << "Visits" << setw(14)
+         << "Average wait" << setw(14) << "Longest wait" << setw(14) << "Longest line" << setw(13)
+         << "Utilization" << endl;
+    for (const ServiceNetwork::StationStatistics& station : network.getStationStatistics()) {
+        cout << "    " << setw(12) << station.name << setw(9) << station.servers << setw(10) << station.visits
+             << setw(14) << station.averageWaitTime() << setw(14) << station.longestWait << setw(14)
+             << station.longestLine << setw(13) << station.utilization << endl;
     }
+    return 0;
 }
 
-// Function: outputEventProcessing
-// Purpose: This helper function outputs a message indicating that an event is being processed. It formats 
-//          the output to align the event times consistently.
-// Parameters:
-//   - event: The event being processed.
-//   - type: A string indicating the type of event ("arrival" or "departure").
-void outputEventProcessing(const Event& event, const std::string& type) {
-    if (type == "arrival") {
-        cout << "Processing an " << type << " event at time:" << setw(5) << event.getTime() << endl;
-    } else { // type is "departure"
-        cout << "Processing a " << type << " event at time:" << setw(4) << event.getTime() << endl;
+// Function: runKernelEngine
+// Purpose: Simulates arrivals with the generic kernel over the event set selected by --kernel.
+// Returns: The exit status.
+int runKernelEngine(const vector<Event>& arrivals, const SimulationOptions& options) {
+    switch (options.kernel) {
+        case KernelEventSet::LOSER_TREE:
+            return runKernel<SimulationKernel<LoserTree, Queue, int, WaitStatistics>>(arrivals, options);
+        case KernelEventSet::FIXED:
+            return runKernel<SimulationKernel<FixedCapacity<FIXED_EVENT_CAPACITY>::PriorityQueue,
+                                              FixedCapacity<FIXED_LINE_CAPACITY>::Queue, int, WaitStatistics>>(arrivals, options);
+        default:
+            return runKernel<SimulationKernel<PriorityQueue, Queue, int, WaitStatistics>>(arrivals, options);
     }
 }
 
-int main() {
+// Function: runBank
+// Purpose: Runs the engine selected by options on standard input and outputs its results.
+// Returns: The exit status.
+int runBank(SimulationOptions& options) {
     cout << "Simulation Begins" << endl;
 
-    // Initialize the bank line (a queue of events representing customers waiting for service)
-    Queue<Event> bankLine;
-    // Initialize the event priority queue (a priority queue of events to be processed in the simulation)
-    PriorityQueue<Event> eventPriorityQueue;
-    // Initialize a boolean flag to track whether the teller is available
-    bool tellerAvailable = true;
-    // Initialize the simulation time
-    int simulationTime = 0;
+    // Event priority queues give memory back once they have drained (e.g. after the preloaded arrivals)
+    BinaryHeap<Event>::setShrinkPolicy(static_cast<unsigned int>(options.heapShrinkFactor), 1024);
+
+    // The engines that read their own input, or none
+    switch (options.engine) {
+        case Engine::SCENARIOS:
+            // The scenario comparison simulates random days
+            runScenarioComparison(options);
+            return 0;
+        case Engine::TAIL_WAIT:
+            // The tail estimator simulates a model
+            return runTailEstimate(options);
+        case Engine::BRANCHES:
+            // The branch pool reads its own input format
+            runBranches(options);
+            return 0;
+        case Engine::NETWORK:
+            // The network reads its own configuration and input format
+            return runNetwork(options);
+        case Engine::APPEND_TRACE:
+            // A growing trace is read from its own file
+            return runAppendTrace(options);
+        case Engine::FLUID:
+            // The fluid approximation counts the customers into bins as they are read
+            return runFluid(options);
+        case Engine::APPOINTMENTS:
+            // Walk-ins and appointments are read lazily, while the simulation runs
+            return runAppointments(options);
+        default:
+            break;
+    }
+
     // Variables to hold arrival and processing times for customers
     int arriveTime, processTime;
-    // Initialize counters for the total number of customers and the cumulative wait time
-    int customerCount = 0;
-    int cumulativeWaitTime = 0;
+    // The arrival events of all customers, in input order
+    vector<Event> arrivals;
 
     // Read customer arrival and processing times from input and create corresponding arrival events
     while (cin >> arriveTime >> processTime) {
-        // Create a new arrival event
-        Event newArrivalEvent(Event::EventType::ARRIVAL, arriveTime, processTime);
-
-        // Add the arrival event to the event priority queue
-        eventPriorityQueue.enqueue(newArrivalEvent);
-        // Increment the customer count
-        customerCount++;
-    }
-
-    // Process all events in the priority queue until it is empty
-    while (!eventPriorityQueue.isEmpty()) {
-        // Get the next event to process (either an arrival or a departure)
-        Event newEvent = eventPriorityQueue.peek();
-        // Update the simulation time to the time of this event
-        simulationTime = newEvent.getTime();
-
-        // Check if the event is an arrival or a departure and process accordingly
-        if (newEvent.isArrival()) {
-            // Output the processing of the arrival event
-            outputEventProcessing(newEvent, "arrival");
-            // Process the arrival event
-            processArrival(newEvent, eventPriorityQueue, bankLine, simulationTime, tellerAvailable);
-        } else {
-            // Output the processing of the departure event
-            outputEventProcessing(newEvent, "departure");
-            // Process the departure event
-            processDeparture(newEvent, eventPriorityQueue, bankLine, simulationTime, tellerAvailable, cumulativeWaitTime);
+        arrivals.push_back(Event(Event::EventType::ARRIVAL, arriveTime, processTime));
+    }
+
+    // The what-if analysis and the fixed-capacity and loser-tree simulations stream arrivals, so they must
+    // be in time order
+    BankSimulation::ArrivalMode mode = BankSimulation::ArrivalMode::PRELOAD;
+    if (options.streamArrivals || options.whatIf || options.fixedCapacity || options.loserTree) {
+        BankSimulation::sortArrivals(arrivals);
+        mode = BankSimulation::ArrivalMode::STREAM;
+    }
+
+    // The analytic mode answers without simulating if a formula applies, and otherwise falls through to the
+    // simulation chosen by the other options
+    if (options.analytic && runAnalytic(arrivals, options)) {
+        return 0;
+    }
+
+    switch (options.engine) {
+        case Engine::INTERRUPTIONS:
+            // The interruptible simulation prints no event log, like the branch pool
+            BankSimulation::sortArrivals(arrivals);
+            runInterruptions(arrivals, options);
+            return 0;
+        case Engine::RETRIALS:
+            // The retrial simulation prints no event log either
+            BankSimulation::sortArrivals(arrivals);
+            runRetrials(arrivals, options);
+            return 0;
+        case Engine::KERNEL:
+            // The generic kernel prints no event log either
+            return runKernelEngine(arrivals, options);
+        default:
+            break;
+    }
+
+    // Replications are run quietly on worker threads
+    if (options.replicate) {
+        options.replication.arrivalMode = mode;
+        runReplications(arrivals, options);
+        return 0;
+    }
+
+    // Start the asynchronous log writer only now, so that it writes after "Simulation Begins"
+    EventLogWriter* asyncLog = nullptr;
+    if (options.logEvents && options.asyncLog) {
+        asyncLog = new EventLogWriter(stdout, options.logOverflow, options.logRingCapacity);
+    }
+
+    // Per-customer records for --customer-stats, one per served customer
+    CustomerRecords records;
+    CustomerRecords* recordsUsed = nullptr;
+    if (options.customerStats) {
+        records.reserve(arrivals.size());
+        recordsUsed = &records;
+    }
+
+    // The fixed-capacity simulation keeps all of its state in this stack frame
+    if (options.fixedCapacity) {
+        FixedSimulation simulation(arrivals, options.tellers, mode);
+        bool completed = runSimulation(simulation, options, asyncLog, recordsUsed);
+        finishEventLog(asyncLog);
+        if (!completed) {
+            return 1;
         }
+        cout << "Simulation Ends" << endl;
+        cout << "\nFinal Statistics:\n" << endl;
+        printStatistics(simulation);
+        if (options.customerStats) {
+            printCustomerStatistics(records, options);
+        }
+        return 0;
     }
 
-    // Calculate the average wait time for all customers
-    float averageWaitTime = static_cast<float>(cumulativeWaitTime) / customerCount;
+    // The loser-tree simulation keeps one event slot per teller instead of a global event heap
+    if (options.loserTree) {
+        LoserTreeBankSimulation simulation(arrivals, options.tellers, mode);
+        runSimulation(simulation, options, asyncLog, recordsUsed);
+        finishEventLog(asyncLog);
+        cout << "Simulation Ends" << endl;
+        cout << "\nFinal Statistics:\n" << endl;
+        printStatistics(simulation);
+        if (options.customerStats) {
+            printCustomerStatistics(records, options);
+        }
+        return 0;
+    }
+
+    // Process all events of the (baseline) simulation until none is left
+    BankSimulation simulation(arrivals, options.tellers, mode);
+    WhatIfAnalysis whatIf(arrivals, options.tellers, options.staffing, options.snapshotInterval);
+    if (options.whatIf) {
+        simulation = whatIf.runBaseline(options.logEvents, asyncLog);
+    } else {
+        runSimulation(simulation, options, asyncLog, recordsUsed);
+    }
+
+    // Wait for the log writer to drain before printing the statistics after the log
+    finishEventLog(asyncLog);
 
     // Output the final statistics of the simulation
     cout << "Simulation Ends" << endl;
     cout << "\nFinal Statistics:\n" << endl;
-    cout << "    Total number of people processed: " << customerCount << endl;
-    cout << "    Average amount of time spent waiting: " << averageWaitTime << endl;
+    printStatistics(simulation);
+    if (options.customerStats) {
+        printCustomerStatistics(records, options);
+    }
+
+    // Output the statistics of the what-if scenario and how much of the day had to be re-simulated
+    if (options.whatIf) {
+        WhatIfAnalysis::Result result = whatIf.evaluate(options.whatIfStaffing);
+        cout << "\nWhat-If Statistics:\n" << endl;
+        printStatistics(result.simulation);
+        cout << "    Resumed from snapshot at time: ";
+        if (result.resumedAt == INT_MIN) {
+            cout << "start" << endl;
+        } else {
+            cout << result.resumedAt << endl;
+        }
+        cout << "    Events re-simulated: " << result.eventsResimulated << " of "
+             << result.simulation.getEventsProcessed() << endl;
+    }
 
     return 0;
 }
+
+// Function: addToKey
+// Purpose: Adds a value of a field of the options, a path or a list of values to the key of a cached run.
+template <typename T>
+void addToKey(ResultCache::KeyBuilder& builder, const T& value) {
+    builder.add(&value, sizeof(value));
+}
+
+void addToKey(ResultCache::KeyBuilder& builder, const char* path) {
+    builder.add(path == nullptr ? string("<none>") : "=" + string(path));
+}
+
+void addToKey(ResultCache::KeyBuilder& builder, const StaffingChange& change) {
+    addToKey(builder, change.time);
+    addToKey(builder, change.tellers);
+}
+
+void addToKey(ResultCache::KeyBuilder& builder, const InterruptibleBankSimulation::Interruption& interruption) {
+    addToKey(builder, interruption.time);
+    addToKey(builder, interruption.duration);
+    addToKey(builder, interruption.teller);
+}
+
+void addToKey(ResultCache::KeyBuilder& builder, const ScenarioComparison::Scenario& scenario);
+
+template <typename T>
+void addToKey(ResultCache::KeyBuilder& builder, const vector<T>& values) {
+    addToKey(builder, values.size());
+    for (const T& value : values) {
+        addToKey(builder, value);
+    }
+}
+
+void addToKey(ResultCache::KeyBuilder& builder, const ScenarioComparison::Scenario& scenario) {
+    addToKey(builder, scenario.tellers);
+    addToKey(builder, scenario.staffing);
+}
+
+// Function: addOptionsToKey
+// Purpose: Adds the parsed options to the key of a cached run field by field (structures may have padding of
+//          any value), so that the same options key the same entry however they were spelled and ordered. The
+//          options of the cache itself are left out.
+void addOptionsToKey(ResultCache::KeyBuilder& builder, const SimulationOptions& options) {
+    addToKey(builder, options.logEvents);
+    addToKey(builder, options.asyncLog);
+    addToKey(builder, options.logOverflow);
+    addToKey(builder, options.logRingCapacity);
+    addToKey(builder, options.tellers);
+    addToKey(builder, options.streamArrivals);
+    addToKey(builder, options.staffing);
+    addToKey(builder, options.whatIf);
+    addToKey(builder, options.whatIfStaffing);
+    addToKey(builder, options.snapshotInterval);
+    addToKey(builder, options.replication.replications);
+    addToKey(builder, options.replication.threads);
+    addToKey(builder, options.replication.numaAware);
+    addToKey(builder, options.replication.hugePages);
+    addToKey(builder, options.replication.arrivalMode);
+    addToKey(builder, options.replicate);
+    addToKey(builder, options.fixedCapacity);
+    addToKey(builder, options.batchEvents);
+    addToKey(builder, options.loserTree);
+    addToKey(builder, options.customerStats);
+    addToKey(builder, options.waitThreshold);
+    addToKey(builder, options.histogramBin);
+    addToKey(builder, options.statisticsKernel);
+    addToKey(builder, options.interval);
+    addToKey(builder, options.intervalFile);
+    addToKey(builder, options.intervalFormat);
+    addToKey(builder, options.traceFile);
+    addToKey(builder, options.traceBlock);
+    addToKey(builder, options.interruptions);
+    addToKey(builder, options.failures);
+    addToKey(builder, options.meanTimeBetweenFailures);
+    addToKey(builder, options.meanTimeToRepair);
+    addToKey(builder, options.failureSeed);
+    addToKey(builder, options.interruptPolicy);
+    addToKey(builder, options.appointmentsFile);
+    addToKey(builder, options.appointmentEarliest);
+    addToKey(builder, options.appointmentLatest);
+    addToKey(builder, options.noShowProbability);
+    addToKey(builder, options.appointmentSeed);
+    addToKey(builder, options.appointmentRule);
+    addToKey(builder, options.lateGrace);
+    addToKey(builder, options.networkFile);
+    addToKey(builder, options.networkSeed);
+    addToKey(builder, options.lineCapacity);
+    addToKey(builder, options.meanRetrialDelay);
+    addToKey(builder, options.retrialSeed);
+    addToKey(builder, options.tailWait);
+    addToKey(builder, options.splitting.levels);
+    addToKey(builder, options.splitting.effort);
+    addToKey(builder, options.splitting.runs);
+    addToKey(builder, options.splitting.seed);
+    addToKey(builder, options.splitCompare);
+    addToKey(builder, options.meanInterarrivalTime);
+    addToKey(builder, options.meanServiceTime);
+    addToKey(builder, options.scenarios);
+    addToKey(builder, options.comparison.replications);
+    addToKey(builder, options.comparison.commonRandomNumbers);
+    addToKey(builder, options.comparison.antithetic);
+    addToKey(builder, options.comparison.seed);
+    addToKey(builder, options.dayCustomers);
+    addToKey(builder, options.analytic);
+    addToKey(builder, options.analyticValidation);
+    addToKey(builder, options.appendTrace);
+    addToKey(builder, options.verifyPrefix);
+    addToKey(builder, options.fluid);
+    addToKey(builder, options.fluidOptions.binWidth);
+    addToKey(builder, options.fluidOptions.scale);
+    addToKey(builder, options.fluidOptions.tolerance);
+    addToKey(builder, options.fluidTrajectory);
+    addToKey(builder, options.heapShrinkFactor);
+    addToKey(builder, options.branches);
+    addToKey(builder, options.sweepLength);
+    addToKey(builder, options.kernel);
+}
+
+// Function: runCached
+// Purpose: Replays the output of an earlier run with the same executable, options (other than the cache's
+//          own), standard input and named input files, or runs the bank and stores its output if it
+//          succeeds.
+// Returns: The exit status.
+int runCached(SimulationOptions& options) {
+    ostringstream input;
+    input << cin.rdbuf();
+
+    ResultCache::KeyBuilder builder;
+    if (!builder.addFile("/proc/self/exe")) {
+        cerr << "Cannot identify the engine; running without the cache" << endl;
+        istringstream replay(input.str());
+        cin.rdbuf(replay.rdbuf());
+        return runBank(options);
+    }
+    addOptionsToKey(builder, options);
+    builder.add(input.str());
+    for (const char* path : {options.networkFile, options.appointmentsFile}) {
+        if (path != nullptr) {
+            builder.addFile(path);
+        }
+    }
+    ResultCache::Key key = builder.finish();
+    uint64_t capacity = static_cast<uint64_t>(options.cacheSize) << 20;
+    ResultCache cache(options.cacheDirectory, capacity);
+
+    ResultCache::Entry entry;
+    if (cache.lookup(key, entry)) {
+        cout << entry.output << flush;
+        cerr << entry.errors << flush;
+        return 0;
+    }
+
+    // Run with standard input replayed from memory and both output streams recorded
+    istringstream replay(input.str());
+    streambuf* originalInput = cin.rdbuf(replay.rdbuf());
+    // Neither stream is recorded past the capacity: an entry larger than the cache is never stored
+    OutputRecorder output(cout.rdbuf(), static_cast<size_t>(capacity));
+    OutputRecorder errors(cerr.rdbuf(), static_cast<size_t>(capacity));
+    streambuf* originalOutput = cout.rdbuf(&output);
+    streambuf* originalErrors = cerr.rdbuf(&errors);
+    int status = runBank(options);
+    cout.flush();
+    cerr.flush();
+    cin.rdbuf(originalInput);
+    cout.rdbuf(originalOutput);
+    cerr.rdbuf(originalErrors);
+
+    if (status == 0 && !output.isTruncated() && !errors.isTruncated()) {
+        entry.output = output.getRecorded();
+        entry.errors = errors.getRecorded();
+        if (!cache.store(key, entry)) {
+            cerr << "Cannot write to the cache in " << options.cacheDirectory << endl;
+        }
+    }
+    return status;
+}
+
+int main(int argc, char* argv[]) {
+    SimulationOptions options;
+    if (!parseArguments(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (options.cacheDirectory != nullptr) {
+        return runCached(options);
+    }
+    return runBank(options);
+}
@@ -0,0 +1,500 @@
+/*
+ * BankSimulation.cpp
+ *
+ * Description: This file implements the BasicBankSimulation class template, the event-driven core of the bank
+ *              simulation. Customers arrive and are either served immediately if a teller is free or
+ *              placed in the bank line. Each service schedules a departure event; when a customer
+ *              departs, the next customer in line (if any) is served by the freed teller.
+ *
+ *              The simulation keeps all of its state in the object, so a run can be advanced one event
+ *              at a time, copied in the middle of the day and resumed from the copy. With one teller, no
+ *              staffing schedule and ArrivalMode::PRELOAD the sequence of priority queue operations is
+ *              the same as in the original simulation, so the event log and statistics are unchanged.
+ *
+ *              The event set and bank line only need the PriorityQueue and Queue operations. Their enqueue
+ *              operations report a full fixed-capacity container by returning false, which the simulation
+ *              turns into a FullDataCollectionException.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include "../include/BankSimulation.h"
+#include <algorithm>    // For std::min and std::stable_sort
+#include <stdexcept>    // For std::logic_error
+#include <string>       // For std::string
+#include <type_traits>  // For std::is_constructible
+
+// Constructor
+// Description: Creates a simulation of arrivals with the given number of tellers on duty.
+//              In ArrivalMode::PRELOAD every arrival event is enqueued in the event priority queue now.
+//              The event priority queue is sized for all events that can be pending at once, so it is
+//              allocated (and first touched) in one piece by the thread constructing the simulation.
+//              Arrivals and departures get their handlers; every other type has none until one is set.
+template <typename EventSet, typename Line>
+BasicBankSimulation<EventSet, Line>::BasicBankSimulation(const std::vector<Event>& arrivals, int tellers, ArrivalMode mode)
+    : arrivals(&arrivals), staffing(nullptr), arrivalMode(mode),
+      eventPriorityQueue(makeEventSet(static_cast<unsigned int>(mode == ArrivalMode::PRELOAD ? arrivals.size() + tellers : tellers + 1))),
+      nextArrival(0), nextStaffingChange(0),
+      lineLength(0), tellersOnDuty(tellers), tellersBusy(0), simulationTime(0), customerCount(0), cumulativeWaitTime(0),
+      eventsProcessed(0), logEvents(false), asyncLog(nullptr), batchEvents(false),
+      intervals(nullptr), records(nullptr), trace(nullptr) {
+    for (HandlerEntry& entry : handlers) {
+        entry = HandlerEntry{handleUnknown, nullptr};
+    }
+    handlers[static_cast<unsigned int>(Event::EventType::ARRIVAL)].handler = handleArrival;
+    handlers[static_cast<unsigned int>(Event::EventType::DEPARTURE)].handler = handleDeparture;
+    if (arrivalMode == ArrivalMode::PRELOAD) {
+        for (const Event& arrival : arrivals) {
+            if (!eventPriorityQueue.enqueue(arrival)) {
+                throw FullDataCollectionException("event set cannot hold all arrivals");
+            }
+        }
+        nextArrival = arrivals.size();
+    }
+}
+
+// sortArrivals
+// Description: Stable sort by time, so that simultaneous arrivals keep their input order.
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::sortArrivals(std::vector<Event>& arrivals) {
+    std::stable_sort(arrivals.begin(), arrivals.end(),
+                [](const Event& lhs, const Event& rhs) { return lhs.getTime() < rhs.getTime(); });
+}
+
+// setStaffingSchedule
+// Description: Sets the staffing schedule; changes that are already due are applied by the next step().
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::setStaffingSchedule(const std::vector<StaffingChange>* schedule) {
+    staffing = schedule;
+}
+
+// setEventLog
+// Description: Enables or disables the per-event log and selects the asynchronous writer, if any.
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::setEventLog(bool logEvents, EventLogWriter* asyncLog) {
+    this->logEvents = logEvents;
+    this->asyncLog = asyncLog;
+}
+
+// setBatchEvents
+// Description: Selects whether run() processes simultaneous events one at a time or as a group.
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::setBatchEvents(bool batchEvents) {
+    this->batchEvents = batchEvents;
+}
+
+// setIntervalStatistics
+// Description: Selects the per-interval statistics updated by every event.
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::setIntervalStatistics(IntervalStatistics* intervals) {
+    this->intervals = intervals;
+}
+
+// setCustomerRecords
+// Description: Selects the per-customer records appended by every service start.
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::setCustomerRecords(CustomerRecords* records) {
+    this->records = records;
+}
+
+// setTraceWriter
+// Description: Selects the trace writer that records every event, service start and staffing change.
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::setTraceWriter(TraceWriter* trace) {
+    this->trace = trace;
+}
+
+// setEventHandler
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::setEventHandler(Event::EventType type, EventHandler handler, void* context) {
+    handlers[static_cast<unsigned int>(type)] = HandlerEntry{handler, context};
+}
+
+// scheduleEvent
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::scheduleEvent(const Event& event) {
+    registeredEvents.emplace(std::make_pair(event.getTime(), static_cast<int>(event.getType())), event);
+}
+
+// hasPendingEvents
+// Description: Returns true if the event priority queue or the arrival stream still holds an event, or if
+//              customers are waiting and a staffing change (which may open a teller for them) is left.
+template <typename EventSet, typename Line>
+bool BasicBankSimulation<EventSet, Line>::hasPendingEvents() const {
+    return hasEvents() || (lineLength > 0 && staffing != nullptr && nextStaffingChange < staffing->size());
+}
+
+// getNextEventTime
+// Description: Returns the time of the event that step() would process next, or the time of the next
+//              staffing change if no event is left.
+template <typename EventSet, typename Line>
+int BasicBankSimulation<EventSet, Line>::getNextEventTime() const {
+    if (!hasEvents()) {
+        return (*staffing)[nextStaffingChange].time;
+    }
+    if (registeredEventIsDue()) {
+        return registeredEvents.begin()->second.getTime();
+    }
+    if (nextArrivalIsDue()) {
+        return (*arrivals)[nextArrival].getTime();
+    }
+    return eventPriorityQueue.peek().getTime();
+}
+
+// step
+// Description: Processes the next event. Staffing changes scheduled at or before the time of that event
+//              are applied first, so a teller opening at time t can serve a customer arriving at time t.
+template <typename EventSet, typename Line>
+bool BasicBankSimulation<EventSet, Line>::step() {
+    if (!hasPendingEvents()) {
+        return false;
+    }
+
+    // Applying a change can start services (and add departures), so the next event is re-examined
+    applyStaffingChanges(getNextEventTime());
+    if (!hasEvents()) {
+        return true;
+    }
+
+    // Get the next event to process (an arrival, a departure or a registered event) and remove it
+    Event newEvent;
+    if (registeredEventIsDue()) {
+        newEvent = registeredEvents.begin()->second;
+        registeredEvents.erase(registeredEvents.begin());
+    } else if (nextArrivalIsDue()) {
+        newEvent = (*arrivals)[nextArrival++];
+    } else {
+        newEvent = eventPriorityQueue.peek();
+        eventPriorityQueue.dequeue();
+    }
+
+    processEvent(newEvent);
+    return true;
+}
+
+// stepBatch
+// Description: Processes the group of events at the time of the next event. The arrivals of the group
+//              are taken from the arrival stream (in input order) and the rest with a single group
+//              removal from the event set, instead of one removal and re-heap per event. The registered
+//              events of the group's time come last.
+template <typename EventSet, typename Line>
+bool BasicBankSimulation<EventSet, Line>::stepBatch() {
+    if (!hasPendingEvents()) {
+        return false;
+    }
+
+    applyStaffingChanges(getNextEventTime());
+    if (!hasEvents()) {
+        return true;
+    }
+    const int groupTime = getNextEventTime();
+
+    batch.clear();
+    while (nextArrival < arrivals->size() && (*arrivals)[nextArrival].getTime() == groupTime) {
+        batch.push_back((*arrivals)[nextArrival++]);
+    }
+    if (!eventPriorityQueue.isEmpty() && eventPriorityQueue.peek().getTime() == groupTime) {
+        eventPriorityQueue.dequeueGroup(batch);
+    }
+    while (!registeredEvents.empty() && registeredEvents.begin()->first.first == groupTime) {
+        batch.push_back(registeredEvents.begin()->second);
+        registeredEvents.erase(registeredEvents.begin());
+    }
+
+    // Arrivals first, then departures and registered event types, each in the order they were collected
+    for (Event& newEvent : batch) {
+        if (newEvent.isArrival()) {
+            processEvent(newEvent);
+        }
+    }
+    for (Event& newEvent : batch) {
+        if (!newEvent.isArrival()) {
+            processEvent(newEvent);
+        }
+    }
+    return true;
+}
+
+// run
+// Description: Processes all events until none is left, one at a time or in groups.
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::run() {
+    if (batchEvents) {
+        while (stepBatch()) {
+        }
+    } else {
+        while (step()) {
+        }
+    }
+}
+
+// saveState
+// Description: Drains copies of the event set and the bank line into the saved state.
+template <typename EventSet, typename Line>
+BankSimulationBase::SavedState BasicBankSimulation<EventSet, Line>::saveState() const {
+    SavedState state;
+    state.simulationTime = simulationTime;
+    state.tellersOnDuty = tellersOnDuty;
+    state.tellersBusy = tellersBusy;
+    state.customerCount = customerCount;
+    state.cumulativeWaitTime = cumulativeWaitTime;
+    state.eventsProcessed = eventsProcessed;
+    state.nextStaffingChange = nextStaffingChange;
+    for (EventSet events = eventPriorityQueue; !events.isEmpty(); events.dequeue()) {
+        state.departureTimes.push_back(events.peek().getTime());
+    }
+    for (Line line = bankLine; !line.isEmpty(); line.dequeue()) {
+        state.bankLine.push_back(line.peek());
+    }
+    return state;
+}
+
+// restoreState
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::restoreState(const SavedState& state) {
+    simulationTime = state.simulationTime;
+    tellersOnDuty = state.tellersOnDuty;
+    tellersBusy = state.tellersBusy;
+    customerCount = state.customerCount;
+    cumulativeWaitTime = state.cumulativeWaitTime;
+    eventsProcessed = state.eventsProcessed;
+    nextStaffingChange = state.nextStaffingChange;
+    for (int time : state.departureTimes) {
+        if (!eventPriorityQueue.enqueue(Event(Event::EventType::DEPARTURE, time))) {
+            throw FullDataCollectionException("event set cannot hold the saved departures");
+        }
+    }
+    for (Event customer : state.bankLine) {
+        if (!bankLine.enqueue(customer)) {
+            throw FullDataCollectionException("bank line cannot hold the saved customers");
+        }
+    }
+    lineLength = static_cast<unsigned int>(state.bankLine.size());
+}
+
+// Getters
+
+template <typename EventSet, typename Line>
+std::size_t BasicBankSimulation<EventSet, Line>::getArrivalsStarted() const {
+    return nextArrival;
+}
+
+template <typename EventSet, typename Line>
+int BasicBankSimulation<EventSet, Line>::getSimulationTime() const {
+    return simulationTime;
+}
+
+template <typename EventSet, typename Line>
+int BasicBankSimulation<EventSet, Line>::getCustomerCount() const {
+    return customerCount;
+}
+
+template <typename EventSet, typename Line>
+long long BasicBankSimulation<EventSet, Line>::getCumulativeWaitTime() const {
+    return cumulativeWaitTime;
+}
+
+template <typename EventSet, typename Line>
+float BasicBankSimulation<EventSet, Line>::getAverageWaitTime() const {
+    return static_cast<float>(cumulativeWaitTime) / customerCount;
+}
+
+template <typename EventSet, typename Line>
+unsigned long long BasicBankSimulation<EventSet, Line>::getEventsProcessed() const {
+    return eventsProcessed;
+}
+
+// Utility method
+// Description: Creates the event set. Dynamically sized sets are given their initial capacity; the
+//              capacity of a fixed-capacity set is part of its type.
+template <typename EventSet, typename Line>
+EventSet BasicBankSimulation<EventSet, Line>::makeEventSet(unsigned int capacity) {
+    if constexpr (std::is_constructible<EventSet, unsigned int>::value) {
+        return EventSet(capacity);
+    } else {
+        return EventSet();
+    }
+}
+
+// Utility method
+// Description: Advances the simulation time to newEvent, logs it and processes it with the handler of its type.
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::processEvent(Event& newEvent) {
+    // Update the simulation time to the time of this event
+    simulationTime = newEvent.getTime();
+    if (intervals != nullptr) {
+        intervals->advanceTo(simulationTime);
+    }
+
+    if (logEvents) {
+        outputEventProcessing(newEvent, asyncLog);
+    }
+    const HandlerEntry& entry = handlers[static_cast<unsigned int>(newEvent.getType())];
+    entry.handler(*this, newEvent, entry.context);
+
+    if (intervals != nullptr) {
+        intervals->setState(lineLength, tellersBusy, tellersOnDuty);
+    }
+    // Trace files only know the built-in event types
+    if (trace != nullptr && newEvent.getType() <= Event::EventType::DEPARTURE) {
+        trace->record(newEvent.isArrival() ? TraceRecord::ARRIVAL : TraceRecord::DEPARTURE, simulationTime,
+                      newEvent.isArrival() ? newEvent.getLength() : 0, lineLength, tellersBusy);
+    }
+    eventsProcessed++;
+}
+
+// Utility method
+// Description: Processes an arrival event. If the bank line is empty and a teller is free, the customer
+//              is served immediately and a departure event is scheduled; otherwise the customer waits
+//              in the bank line.
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::processArrival(Event& newEvent) {
+    customerCount++;
+    if (intervals != nullptr) {
+        intervals->recordArrival();
+    }
+
+    if (bankLine.isEmpty() && tellersBusy < tellersOnDuty) {
+        startService(newEvent, simulationTime);
+    } else {
+        if (!bankLine.enqueue(newEvent)) {
+            throw FullDataCollectionException("bank line is full");
+        }
+        lineLength++;
+    }
+}
+
+// Utility method
+// Description: Processes a departure event. The freed teller serves the next customer in the bank line,
+//              unless the number of tellers on duty has been reduced below the number of busy tellers.
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::processDeparture(Event& newEvent) {
+    tellersBusy--;
+    if (intervals != nullptr) {
+        intervals->recordDeparture();
+    }
+
+    while (tellersBusy < tellersOnDuty && !bankLine.isEmpty()) {
+        Event customer = bankLine.peek();
+        bankLine.dequeue();
+        lineLength--;
+        startService(customer, simulationTime);
+    }
+}
+
+// Utility methods
+// Description: The handlers of the built-in event types, and of types without a handler.
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::handleArrival(BasicBankSimulation& simulation, Event& event, void*) {
+    simulation.processArrival(event);
+}
+
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::handleDeparture(BasicBankSimulation& simulation, Event& event, void*) {
+    simulation.processDeparture(event);
+}
+
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::handleUnknown(BasicBankSimulation&, Event& event, void*) {
+    throw std::logic_error(std::string("no handler for event type ") +
+                           EventTypeRegistry::getEntry(event.getType()).name);
+}
+
+// Utility method
+// Description: Starts serving customer at startTime: accumulates the customer's wait time and schedules
+//              the departure event.
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::startService(const Event& customer, int startTime) {
+    // Calculate the customer's wait time based on the service start time and their arrival time
+    cumulativeWaitTime += startTime - customer.getTime();
+    if (intervals != nullptr) {
+        intervals->recordServiceStart(startTime - customer.getTime());
+    }
+    if (records != nullptr) {
+        records->append(customer.getTime(), startTime, startTime + customer.getLength());
+    }
+
+    // Create the departure event for this customer and add it to the priority queue
+    Event newDepartureEvent(Event::EventType::DEPARTURE, startTime + customer.getLength());
+    if (!eventPriorityQueue.enqueue(newDepartureEvent)) {
+        throw FullDataCollectionException("event set is full");
+    }
+
+    tellersBusy++;
+    if (trace != nullptr) {
+        trace->record(TraceRecord::SERVICE_START, startTime, startTime - customer.getTime(), lineLength, tellersBusy);
+    }
+}
+
+// Utility method
+// Description: Applies every staffing change scheduled at or before upToTime. Tellers opening at time t
+//              immediately serve waiting customers at time t; when tellers close, busy tellers finish
+//              their current customer first.
+template <typename EventSet, typename Line>
+void BasicBankSimulation<EventSet, Line>::applyStaffingChanges(int upToTime) {
+    if (staffing == nullptr) {
+        return;
+    }
+
+    while (nextStaffingChange < staffing->size() && (*staffing)[nextStaffingChange].time <= upToTime) {
+        const StaffingChange& change = (*staffing)[nextStaffingChange++];
+        if (intervals != nullptr) {
+            intervals->advanceTo(change.time);
+        }
+        tellersOnDuty = change.tellers;
+
+        while (tellersBusy < tellersOnDuty && !bankLine.isEmpty()) {
+            Event customer = bankLine.peek();
+            bankLine.dequeue();
+            lineLength--;
+            startService(customer, change.time);
+        }
+
+        if (intervals != nullptr) {
+            intervals->setState(lineLength, tellersBusy, tellersOnDuty);
+        }
+        if (trace != nullptr) {
+            trace->record(TraceRecord::STAFFING, change.time, tellersOnDuty, lineLength, tellersBusy);
+        }
+
+        // A service started above may end before the next event seen so far
+        if (hasPendingEvents()) {
+            upToTime = std::min(upToTime, getNextEventTime());
+        }
+    }
+}
+
+// Utility method
+// Description: Returns true if the event priority queue, the arrival stream or the registered events still
+//              hold an event.
+template <typename EventSet, typename Line>
+bool BasicBankSimulation<EventSet, Line>::hasEvents() const {
+    return !eventPriorityQueue.isEmpty() || nextArrival < arrivals->size() || !registeredEvents.empty();
+}
+
+// Utility method
+// Description: In ArrivalMode::STREAM, returns true if the next arrival comes before (or at the same time
+//              as) every pending departure. Simultaneous arrivals are processed before departures.
+template <typename EventSet, typename Line>
+bool BasicBankSimulation<EventSet, Line>::nextArrivalIsDue() const {
+    if (nextArrival >= arrivals->size()) {
+        return false;
+    }
+    return eventPriorityQueue.isEmpty() || (*arrivals)[nextArrival].getTime() <= eventPriorityQueue.peek().getTime();
+}
+
+// Utility method
+// Description: Returns true if the earliest registered event comes before every arrival and departure left,
+//              so that the arrivals and departures of its time are processed first.
+template <typename EventSet, typename Line>
+bool BasicBankSimulation<EventSet, Line>::registeredEventIsDue() const {
+    if (registeredEvents.empty()) {
+        return false;
+    }
+    const int time = registeredEvents.begin()->first.first;
+    if (nextArrival < arrivals->size() && (*arrivals)[nextArrival].getTime() <= time) {
+        return false;
+    }
+    return eventPriorityQueue.isEmpty() || time < eventPriorityQueue.peek().getTime();
+}
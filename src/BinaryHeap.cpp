@@ -12,7 +12,16 @@
  *              automatically expanding when the number of elements exceeds the current capacity. 
  *              The class includes utility methods like `reHeapUp` and `reHeapDown` to restore the 
  *              heap order after insertions and deletions. The expandHeap method ensures that the 
- *              heap can grow as needed, doubling the capacity when required.
+ *              heap can grow as needed, doubling the capacity when required, and the shrinkHeap
+ *              method returns memory once the heap has drained.
+ *
+ *              The array is allocated with malloc and only the first elementCount slots hold
+ *              constructed elements: insert constructs the new element in place and remove destroys
+ *              the last slot. For trivially copyable elements the array is resized with realloc; for
+ *              large arrays this lets the C library move the pages instead of copying the elements, so
+ *              the old and new arrays never both occupy memory. Arrays given the large array advice are
+ *              allocated with aligned_alloc instead, and copied when resized, since realloc keeps no
+ *              alignment.
  *
  *              This implementation is designed for efficiency, with insertion and removal operations 
  *              having logarithmic time complexity O(log n), while retrieval and checking the element 
@@ -25,25 +34,75 @@
  *   its child nodes in a min-heap configuration.
  * - The root element is always the smallest element in the heap.
  * - The dynamic array used to store heap elements can expand as needed to accommodate more elements.
+ * - Exactly the first elementCount slots of the array hold constructed elements.
  * - If the heap is empty, attempts to retrieve or remove an element will throw an 
  *   EmptyDataCollectionException.
  *
  * Author: Kunpeng (Andy) Zhang
- * Last Modified: Sep. 2024
+ * Last Modified: Oct. 2026
  */
 
 #include "../include/BinaryHeap.h"
-#include <algorithm>  // For std::swap, std::copy
+#include <algorithm>    // For std::swap, std::max
+#include <cstddef>      // For std::max_align_t
+#include <cstdlib>      // For std::malloc, std::aligned_alloc, std::realloc and std::free
+#include <memory>       // For std::uninitialized_copy and std::uninitialized_move
+#include <new>          // For placement new and std::bad_alloc
+#include <type_traits>  // For std::is_trivially_copyable
+#include <utility>      // For std::move
+
+// No advice for large arrays unless setLargeArrayAdvice is called
+template<typename ElementType>
+void (*BinaryHeap<ElementType>::largeArrayAdvice)(void*, std::size_t) = nullptr;
+
+template<typename ElementType>
+std::size_t BinaryHeap<ElementType>::largeArrayThreshold = 0;
+
+template<typename ElementType>
+std::size_t BinaryHeap<ElementType>::largeArrayAlignment = 1;
+
+// Shrink to twice the element count once no more than a quarter of the array is used
+template<typename ElementType>
+unsigned int BinaryHeap<ElementType>::shrinkFactor = 4;
+
+template<typename ElementType>
+unsigned int BinaryHeap<ElementType>::shrinkMinimumCapacity = 1024;
 
 // Constructor to initialize array 
 template<typename ElementType>
 BinaryHeap<ElementType>::BinaryHeap(unsigned int capacity)
-    : elements(new ElementType[capacity]), capacity(capacity), elementCount(0) {}
+    : elements(allocateArray(capacity)), capacity(capacity), elementCount(0) {}
+
+// Copy constructor
+// Description: Copies the live elements of rhs into a new array of the same capacity.
+// Time efficiency: O(n)
+template<typename ElementType>
+BinaryHeap<ElementType>::BinaryHeap(const BinaryHeap& rhs)
+    : elements(allocateArray(rhs.capacity)), capacity(rhs.capacity), elementCount(rhs.elementCount) {
+    std::uninitialized_copy(rhs.elements, rhs.elements + rhs.elementCount, elements);
+}
+
+// Copy assignment operator
+// Description: Replaces the contents of this heap with a copy of rhs.
+// Time efficiency: O(n)
+template<typename ElementType>
+BinaryHeap<ElementType>& BinaryHeap<ElementType>::operator=(const BinaryHeap& rhs) {
+    if (this != &rhs) {
+        ElementType* newHeap = allocateArray(rhs.capacity);
+        std::uninitialized_copy(rhs.elements, rhs.elements + rhs.elementCount, newHeap);
+
+        releaseArray(elements, elementCount);
+        elements = newHeap;
+        capacity = rhs.capacity;
+        elementCount = rhs.elementCount;
+    }
+    return *this;
+}
 
 // Destructor
 template<typename ElementType>
 BinaryHeap<ElementType>::~BinaryHeap() {
-    delete[] elements;
+    releaseArray(elements, elementCount);
 }
 
 // Description: Returns the number of elements in the Binary Heap.
@@ -64,8 +123,8 @@ bool BinaryHeap<ElementType>::insert(const ElementType& newElement) {
         expandHeap();
     }
     
-    // Insert new element and reheap up to maintain heap property
-    elements[elementCount] = newElement;
+    // Construct the new element in the first free slot and reheap up to maintain heap property
+    new (elements + elementCount) ElementType(newElement);
     reHeapUp(elementCount);
     elementCount++;
     
@@ -95,12 +154,64 @@ void BinaryHeap<ElementType>::remove() {
         throw EmptyDataCollectionException();
     }
     
-    elements[0] = elements[elementCount - 1];
     elementCount--;
+    if (elementCount > 0) {
+        elements[0] = std::move(elements[elementCount]);
+    }
+    elements[elementCount].~ElementType();
     
     if (elementCount > 0) {
         reHeapDown(0);
     }
+
+    if (shrinkFactor != 0 && capacity > shrinkMinimumCapacity && elementCount <= capacity / shrinkFactor) {
+        shrinkHeap();
+    }
+}
+
+// Description: Removes all elements equal to the minimum element and appends them to group.
+//              Elements equal to the root form a subtree containing the root (every ancestor of such an
+//              element is no greater than it), which is found breadth-first. In heap indexing
+//              breadth-first order is ascending index order, so filling the holes from the highest
+//              index down means each hole is filled when the heap below it is already valid: moving the
+//              last element into it and re-heaping down restores its subtree.
+// Exceptions: Throws EmptyDataCollectionException if this Binary Heap is empty.
+// Time Efficiency: O(k log2 n) for k removed elements
+template<typename ElementType>
+void BinaryHeap<ElementType>::removeMinimumGroup(std::vector<ElementType>& group) {
+    if (elementCount == 0) {
+        throw EmptyDataCollectionException();
+    }
+
+    // Collect the indices of the elements equal to the root, in ascending order
+    groupIndices.clear();
+    groupIndices.push_back(0);
+    for (std::size_t next = 0; next < groupIndices.size(); next++) {
+        unsigned int index = groupIndices[next];
+        group.push_back(elements[index]);
+        for (unsigned int child = 2 * index + 1; child <= 2 * index + 2 && child < elementCount; child++) {
+            if (!(elements[0] < elements[child])) {
+                groupIndices.push_back(child);
+            }
+        }
+    }
+
+    // Fill the holes from the highest index down with the last element of the heap
+    for (std::size_t remaining = groupIndices.size(); remaining > 0; remaining--) {
+        unsigned int hole = groupIndices[remaining - 1];
+        elementCount--;
+        if (hole != elementCount) {
+            elements[hole] = std::move(elements[elementCount]);
+        }
+        elements[elementCount].~ElementType();
+        if (hole < elementCount) {
+            reHeapDown(hole);
+        }
+    }
+
+    if (shrinkFactor != 0 && capacity > shrinkMinimumCapacity && elementCount <= capacity / shrinkFactor) {
+        shrinkHeap();
+    }
 }
 
 // Utility method
@@ -146,12 +257,105 @@ void BinaryHeap<ElementType>::reHeapDown(unsigned int indexOfRoot) {
 // Time efficiency: O(n)
 template<typename ElementType>
 void BinaryHeap<ElementType>::expandHeap() {
-    capacity *= 2;
-    ElementType* newHeap = new ElementType[capacity];
-    
-    // Use std::copy for better readability and potential optimizations
-    std::copy(elements, elements + elementCount, newHeap);
-    
-    delete[] elements;
-    elements = newHeap;
+    unsigned int newCapacity = (capacity == 0) ? 1 : capacity * 2;
+    elements = resizeArray(elements, elementCount, newCapacity);
+    capacity = newCapacity;
+}
+
+// Description: Shrinks the array of a drained binary heap to twice its element count.
+// Postcondition: The capacity is reduced, but not below shrinkMinimumCapacity.
+// Time efficiency: O(n)
+template<typename ElementType>
+void BinaryHeap<ElementType>::shrinkHeap() {
+    unsigned int newCapacity = std::max(2 * elementCount, shrinkMinimumCapacity);
+    if (newCapacity < capacity) {
+        elements = resizeArray(elements, elementCount, newCapacity);
+        capacity = newCapacity;
+    }
+}
+
+// Description: Sets the advice applied to element arrays of at least thresholdBytes bytes.
+template<typename ElementType>
+void BinaryHeap<ElementType>::setLargeArrayAdvice(void (*advice)(void*, std::size_t), std::size_t thresholdBytes,
+                                                  std::size_t alignment) {
+    largeArrayAdvice = advice;
+    largeArrayThreshold = thresholdBytes;
+    largeArrayAlignment = advice == nullptr ? 1 : alignment;
+}
+
+// Description: Sets the shrink-on-drain policy of all heaps of this element type.
+template<typename ElementType>
+void BinaryHeap<ElementType>::setShrinkPolicy(unsigned int factor, unsigned int minimumCapacity) {
+    shrinkFactor = factor;
+    shrinkMinimumCapacity = minimumCapacity;
+}
+
+// Utility method
+// Description: Returns true if an array of the given size is given the large array advice.
+// Time efficiency: O(1)
+template<typename ElementType>
+bool BinaryHeap<ElementType>::isLargeArray(std::size_t bytes) {
+    return largeArrayAdvice != nullptr && bytes >= largeArrayThreshold;
+}
+
+// Utility method
+// Description: Allocates uninitialized room for count elements. A large array is aligned and rounded up to
+//              whole units of largeArrayAlignment, and the advice is given on the raw memory, so that it
+//              applies to every unit before any page is touched.
+// Exceptions: Throws std::bad_alloc if the memory cannot be allocated.
+// Time efficiency: O(1)
+template<typename ElementType>
+ElementType* BinaryHeap<ElementType>::allocateArray(unsigned int count) {
+    std::size_t bytes = static_cast<std::size_t>(count) * sizeof(ElementType);
+    ElementType* array;
+    if (isLargeArray(bytes) && largeArrayAlignment > alignof(std::max_align_t)) {
+        bytes = (bytes + largeArrayAlignment - 1) & ~(largeArrayAlignment - 1);
+        array = static_cast<ElementType*>(std::aligned_alloc(largeArrayAlignment, bytes));
+    } else {
+        array = static_cast<ElementType*>(std::malloc(bytes == 0 ? 1 : bytes));
+    }
+    if (array == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    if (isLargeArray(bytes)) {
+        largeArrayAdvice(array, bytes);
+    }
+    return array;
+}
+
+// Utility method
+// Description: Moves the first elementCount elements of array into room for newCount elements and
+//              returns the new array; array itself must no longer be used.
+// Exceptions: Throws std::bad_alloc if the memory cannot be allocated (array is then unchanged).
+// Time efficiency: O(n)
+template<typename ElementType>
+ElementType* BinaryHeap<ElementType>::resizeArray(ElementType* array, unsigned int elementCount, unsigned int newCount) {
+    std::size_t bytes = static_cast<std::size_t>(newCount) * sizeof(ElementType);
+    if constexpr (std::is_trivially_copyable<ElementType>::value) {
+        // realloc may extend or shrink the block in place, or remap its pages without copying them. It keeps
+        // no alignment, so a large array is allocated aligned and copied instead.
+        if (!isLargeArray(bytes)) {
+            ElementType* newArray = static_cast<ElementType*>(std::realloc(array, bytes == 0 ? 1 : bytes));
+            if (newArray == nullptr) {
+                throw std::bad_alloc();
+            }
+            return newArray;
+        }
+    }
+    ElementType* newArray = allocateArray(newCount);
+    std::uninitialized_move(array, array + elementCount, newArray);
+    releaseArray(array, elementCount);
+    return newArray;
+}
+
+// Utility method
+// Description: Destroys the first elementCount elements of array and frees it.
+// Time efficiency: O(n)
+template<typename ElementType>
+void BinaryHeap<ElementType>::releaseArray(ElementType* array, unsigned int elementCount) {
+    for (unsigned int index = 0; index < elementCount; index++) {
+        array[index].~ElementType();
+    }
+    std::free(array);
 }
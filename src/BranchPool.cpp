@@ -0,0 +1,212 @@
+/*
+ * BranchPool.cpp
+ *
+ * Description: This file implements the BranchPool class. The constructor groups the customers by branch
+ *              into the shared arrays; run() then sweeps over the active branches, advancing each one to
+ *              the sweep's time horizon with the same rules as BankSimulation in ArrivalMode::STREAM.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include <climits>
+#include <numeric>
+#include "../include/BranchPool.h"
+
+// Constructor
+// Description: Orders the customers by branch number and, within a branch, by time (keeping simultaneous
+//              arrivals in input order), and lays them out branch by branch.
+// Time Efficiency: O(n log n)
+BranchPool::BranchPool(const std::vector<int>& branches, const std::vector<Event>& arrivals, int tellers)
+    : tellers(tellers), sweepCount(0) {
+    std::vector<std::size_t> order(arrivals.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+        if (branches[lhs] != branches[rhs]) {
+            return branches[lhs] < branches[rhs];
+        }
+        return arrivals[lhs].getTime() < arrivals[rhs].getTime();
+    });
+
+    arrivalTime.reserve(order.size());
+    serviceLength.reserve(order.size());
+    for (std::size_t position = 0; position < order.size(); position++) {
+        std::size_t customer = order[position];
+        if (position == 0 || branches[customer] != branchNumbers.back()) {
+            branchNumbers.push_back(branches[customer]);
+            arrivalBegin.push_back(position);
+        }
+        arrivalTime.push_back(arrivals[customer].getTime());
+        serviceLength.push_back(arrivals[customer].getLength());
+    }
+    arrivalBegin.push_back(order.size());
+
+    const std::size_t branchCount = branchNumbers.size();
+    nextArrival.assign(arrivalBegin.begin(), arrivalBegin.end() - 1);
+    lineHead = nextArrival;
+    tellersBusy.assign(branchCount, 0);
+    departureTime.assign(branchCount * static_cast<std::size_t>(tellers), 0);
+    simulationTime.assign(branchCount, 0);
+    customerCount.assign(branchCount, 0);
+    cumulativeWaitTime.assign(branchCount, 0);
+    eventsProcessed.assign(branchCount, 0);
+}
+
+// run
+// Description: Each sweep starts at the earliest pending event of all active branches and advances every
+//              active branch to the end of the sweep. Branches that have finished are removed from the
+//              active list while it is traversed, so later sweeps only touch branches with work left.
+// Time Efficiency: O(n log t) for n events and t tellers, plus O(b) per sweep for the b active branches
+void BranchPool::run(int sweepLength) {
+    active.clear();
+    long long sweepStart = LLONG_MAX;
+    for (std::size_t branch = 0; branch < branchNumbers.size(); branch++) {
+        if (hasEvents(branch)) {
+            active.push_back(branch);
+            sweepStart = std::min(sweepStart, static_cast<long long>(nextEventTime(branch)));
+        }
+    }
+
+    while (!active.empty()) {
+        const long long horizon = sweepStart + sweepLength - 1;
+        sweepStart = LLONG_MAX;
+        std::size_t kept = 0;
+        for (std::size_t branch : active) {
+            advance(branch, horizon);
+            if (hasEvents(branch)) {
+                active[kept++] = branch;
+                sweepStart = std::min(sweepStart, static_cast<long long>(nextEventTime(branch)));
+            }
+        }
+        active.resize(kept);
+        sweepCount++;
+    }
+}
+
+// getBranchCount
+std::size_t BranchPool::getBranchCount() const {
+    return branchNumbers.size();
+}
+
+// getSweepCount
+unsigned int BranchPool::getSweepCount() const {
+    return sweepCount;
+}
+
+// getStatistics
+// Description: Collects the per-branch arrays into one record per branch.
+std::vector<BranchPool::BranchStatistics> BranchPool::getStatistics() const {
+    std::vector<BranchStatistics> statistics(branchNumbers.size());
+    for (std::size_t branch = 0; branch < branchNumbers.size(); branch++) {
+        BranchStatistics& entry = statistics[branch];
+        entry.branch = branchNumbers[branch];
+        entry.customerCount = customerCount[branch];
+        entry.cumulativeWaitTime = cumulativeWaitTime[branch];
+        entry.averageWaitTime = static_cast<float>(cumulativeWaitTime[branch]) / customerCount[branch];
+        entry.eventsProcessed = eventsProcessed[branch];
+        entry.lastEventTime = simulationTime[branch];
+    }
+    return statistics;
+}
+
+// Utility method
+// Description: Returns true if the branch has a customer still to arrive or a pending departure.
+bool BranchPool::hasEvents(std::size_t branch) const {
+    return nextArrival[branch] < arrivalBegin[branch + 1] || tellersBusy[branch] > 0;
+}
+
+// Utility method
+// Description: Returns the time of the branch's next event; an arrival comes before a simultaneous departure.
+// Precondition: hasEvents(branch) is true.
+int BranchPool::nextEventTime(std::size_t branch) const {
+    if (tellersBusy[branch] == 0) {
+        return arrivalTime[nextArrival[branch]];
+    }
+    const int departure = departureTime[branch * tellers];
+    if (nextArrival[branch] < arrivalBegin[branch + 1]) {
+        return std::min(arrivalTime[nextArrival[branch]], departure);
+    }
+    return departure;
+}
+
+// Utility method
+// Description: Processes the branch's events up to and including time horizon.
+void BranchPool::advance(std::size_t branch, long long horizon) {
+    const std::size_t end = arrivalBegin[branch + 1];
+    const std::size_t heap = branch * tellers;
+
+    while (true) {
+        const bool arrivalLeft = nextArrival[branch] < end;
+        if (arrivalLeft && (tellersBusy[branch] == 0 || arrivalTime[nextArrival[branch]] <= departureTime[heap])) {
+            const int time = arrivalTime[nextArrival[branch]];
+            if (time > horizon) {
+                return;
+            }
+            simulationTime[branch] = time;
+            customerCount[branch]++;
+            // The line is empty if the arriving customer is the next one to be served
+            const bool lineEmpty = (lineHead[branch] == nextArrival[branch]);
+            nextArrival[branch]++;
+            if (lineEmpty && tellersBusy[branch] < tellers) {
+                serveNext(branch, time);
+            }
+        } else if (tellersBusy[branch] > 0) {
+            const int time = departureTime[heap];
+            if (time > horizon) {
+                return;
+            }
+            simulationTime[branch] = time;
+            popDeparture(branch);
+            while (tellersBusy[branch] < tellers && lineHead[branch] < nextArrival[branch]) {
+                serveNext(branch, time);
+            }
+        } else {
+            return;
+        }
+        eventsProcessed[branch]++;
+    }
+}
+
+// Utility method
+// Description: Starts serving the customer at the head of the branch's bank line at startTime.
+void BranchPool::serveNext(std::size_t branch, int startTime) {
+    const std::size_t customer = lineHead[branch]++;
+    cumulativeWaitTime[branch] += startTime - arrivalTime[customer];
+    pushDeparture(branch, startTime + serviceLength[customer]);
+}
+
+// Utility method
+// Description: Adds a departure to the branch's heap slice (sift up).
+// Time Efficiency: O(log t)
+void BranchPool::pushDeparture(std::size_t branch, int time) {
+    int* heap = &departureTime[branch * tellers];
+    int index = tellersBusy[branch]++;
+    while (index > 0 && heap[(index - 1) / 2] > time) {
+        heap[index] = heap[(index - 1) / 2];
+        index = (index - 1) / 2;
+    }
+    heap[index] = time;
+}
+
+// Utility method
+// Description: Removes the earliest departure from the branch's heap slice (sift down).
+// Time Efficiency: O(log t)
+void BranchPool::popDeparture(std::size_t branch) {
+    int* heap = &departureTime[branch * tellers];
+    const int count = --tellersBusy[branch];
+    const int last = heap[count];
+    int index = 0;
+    while (2 * index + 1 < count) {
+        int child = 2 * index + 1;
+        if (child + 1 < count && heap[child + 1] < heap[child]) {
+            child++;
+        }
+        if (heap[child] >= last) {
+            break;
+        }
+        heap[index] = heap[child];
+        index = child;
+    }
+    heap[index] = last;
+}
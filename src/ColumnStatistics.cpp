@@ -0,0 +1,292 @@
+/*
+ * ColumnStatistics.cpp
+ *
+ * Description: This file implements the single-pass column reduction kernels and their run-time dispatch.
+ *              Every kernel keeps, for each "greater than" limit (the threshold and each histogram
+ *              boundary minus one), a count of the values above it. The vector kernels keep these counts
+ *              and the other accumulators in vector registers and fold them into 64-bit totals after every
+ *              chunk of values, so that the 32-bit lane counters cannot overflow.
+ *
+ *              The AVX2 and AVX-512 kernels use the GCC/Clang target attribute, so this file needs no
+ *              special compiler flags; they are only called after the CPU has been checked.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include <climits>
+#include "../include/ColumnStatistics.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define COLUMN_STATISTICS_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Values folded into the totals at a time by the vector kernels (keeps each 32-bit lane count below 2^24)
+const std::size_t CHUNK_SIZE = std::size_t(1) << 24;
+
+// Structure: Partial
+// Purpose: The accumulators shared by all kernels.
+struct Partial {
+    long long sum = 0;
+    double squaredDeviations = 0;
+    int minimum = INT_MAX;
+    int maximum = INT_MIN;
+    unsigned long long above[MAX_HISTOGRAM_BINS] = {};  // above[j]: values greater than limits[j]
+};
+
+// Function: scalarKernel
+// Purpose: Accumulates values[0, count) into partial one value at a time.
+void scalarKernel(const int* values, std::size_t count, const int* limits, unsigned int limitCount,
+                  double shift, Partial& partial) {
+    for (std::size_t i = 0; i < count; i++) {
+        const int value = values[i];
+        partial.sum += value;
+        const double deviation = value - shift;
+        partial.squaredDeviations += deviation * deviation;
+        partial.minimum = std::min(partial.minimum, value);
+        partial.maximum = std::max(partial.maximum, value);
+        for (unsigned int j = 0; j < limitCount; j++) {
+            partial.above[j] += (value > limits[j]) ? 1 : 0;
+        }
+    }
+}
+
+#ifdef COLUMN_STATISTICS_X86
+
+// Function: avx2Kernel
+// Purpose: Accumulates values[0, count) into partial eight values at a time; the remainder is scalar.
+__attribute__((target("avx2")))
+void avx2Kernel(const int* values, std::size_t count, const int* limits, unsigned int limitCount,
+                double shift, Partial& partial) {
+    __m256i limitVectors[MAX_HISTOGRAM_BINS];
+    for (unsigned int j = 0; j < limitCount; j++) {
+        limitVectors[j] = _mm256_set1_epi32(limits[j]);
+    }
+    const __m256d shiftVector = _mm256_set1_pd(shift);
+
+    std::size_t i = 0;
+    while (count - i >= 8) {
+        const std::size_t chunkEnd = i + std::min((count - i) / 8 * 8, CHUNK_SIZE);
+        __m256i sums = _mm256_setzero_si256();
+        __m256d squares = _mm256_setzero_pd();
+        __m256i minima = _mm256_set1_epi32(INT_MAX);
+        __m256i maxima = _mm256_set1_epi32(INT_MIN);
+        __m256i counts[MAX_HISTOGRAM_BINS];
+        for (unsigned int j = 0; j < limitCount; j++) {
+            counts[j] = _mm256_setzero_si256();
+        }
+
+        for (; i < chunkEnd; i += 8) {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+            const __m128i low = _mm256_castsi256_si128(block);
+            const __m128i high = _mm256_extracti128_si256(block, 1);
+            sums = _mm256_add_epi64(sums, _mm256_cvtepi32_epi64(low));
+            sums = _mm256_add_epi64(sums, _mm256_cvtepi32_epi64(high));
+            const __m256d lowDeviations = _mm256_sub_pd(_mm256_cvtepi32_pd(low), shiftVector);
+            const __m256d highDeviations = _mm256_sub_pd(_mm256_cvtepi32_pd(high), shiftVector);
+            squares = _mm256_add_pd(squares, _mm256_mul_pd(lowDeviations, lowDeviations));
+            squares = _mm256_add_pd(squares, _mm256_mul_pd(highDeviations, highDeviations));
+            minima = _mm256_min_epi32(minima, block);
+            maxima = _mm256_max_epi32(maxima, block);
+            // A true comparison is -1 in every bit, so subtracting it counts the value
+            for (unsigned int j = 0; j < limitCount; j++) {
+                counts[j] = _mm256_sub_epi32(counts[j], _mm256_cmpgt_epi32(block, limitVectors[j]));
+            }
+        }
+
+        alignas(32) long long sumLanes[4];
+        alignas(32) double squareLanes[4];
+        alignas(32) int lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(sumLanes), sums);
+        _mm256_store_pd(squareLanes, squares);
+        for (int lane = 0; lane < 4; lane++) {
+            partial.sum += sumLanes[lane];
+            partial.squaredDeviations += squareLanes[lane];
+        }
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), minima);
+        partial.minimum = std::min(partial.minimum, *std::min_element(lanes, lanes + 8));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), maxima);
+        partial.maximum = std::max(partial.maximum, *std::max_element(lanes, lanes + 8));
+        for (unsigned int j = 0; j < limitCount; j++) {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), counts[j]);
+            for (int lane = 0; lane < 8; lane++) {
+                partial.above[j] += static_cast<unsigned int>(lanes[lane]);
+            }
+        }
+    }
+    scalarKernel(values + i, count - i, limits, limitCount, shift, partial);
+}
+
+// GCC reports the deliberately undefined upper halves inside its AVX-512 extract and reduce intrinsics as
+// maybe uninitialized once they are inlined at -O2
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// Function: avx512Kernel
+// Purpose: Accumulates values[0, count) into partial sixteen values at a time; the remainder is scalar.
+__attribute__((target("avx512f")))
+void avx512Kernel(const int* values, std::size_t count, const int* limits, unsigned int limitCount,
+                  double shift, Partial& partial) {
+    __m512i limitVectors[MAX_HISTOGRAM_BINS];
+    for (unsigned int j = 0; j < limitCount; j++) {
+        limitVectors[j] = _mm512_set1_epi32(limits[j]);
+    }
+    const __m512d shiftVector = _mm512_set1_pd(shift);
+    const __m512i ones = _mm512_set1_epi32(1);
+
+    std::size_t i = 0;
+    while (count - i >= 16) {
+        const std::size_t chunkEnd = i + std::min((count - i) / 16 * 16, CHUNK_SIZE);
+        __m512i sums = _mm512_setzero_si512();
+        __m512d squares = _mm512_setzero_pd();
+        __m512i minima = _mm512_set1_epi32(INT_MAX);
+        __m512i maxima = _mm512_set1_epi32(INT_MIN);
+        __m512i counts[MAX_HISTOGRAM_BINS];
+        for (unsigned int j = 0; j < limitCount; j++) {
+            counts[j] = _mm512_setzero_si512();
+        }
+
+        for (; i < chunkEnd; i += 16) {
+            const __m512i block = _mm512_loadu_si512(values + i);
+            const __m256i low = _mm512_castsi512_si256(block);
+            const __m256i high = _mm512_extracti64x4_epi64(block, 1);
+            sums = _mm512_add_epi64(sums, _mm512_cvtepi32_epi64(low));
+            sums = _mm512_add_epi64(sums, _mm512_cvtepi32_epi64(high));
+            const __m512d lowDeviations = _mm512_sub_pd(_mm512_cvtepi32_pd(low), shiftVector);
+            const __m512d highDeviations = _mm512_sub_pd(_mm512_cvtepi32_pd(high), shiftVector);
+            squares = _mm512_add_pd(squares, _mm512_mul_pd(lowDeviations, lowDeviations));
+            squares = _mm512_add_pd(squares, _mm512_mul_pd(highDeviations, highDeviations));
+            minima = _mm512_min_epi32(minima, block);
+            maxima = _mm512_max_epi32(maxima, block);
+            for (unsigned int j = 0; j < limitCount; j++) {
+                const __mmask16 greater = _mm512_cmpgt_epi32_mask(block, limitVectors[j]);
+                counts[j] = _mm512_mask_add_epi32(counts[j], greater, counts[j], ones);
+            }
+        }
+
+        partial.sum += _mm512_reduce_add_epi64(sums);
+        partial.squaredDeviations += _mm512_reduce_add_pd(squares);
+        partial.minimum = std::min(partial.minimum, _mm512_reduce_min_epi32(minima));
+        partial.maximum = std::max(partial.maximum, _mm512_reduce_max_epi32(maxima));
+        for (unsigned int j = 0; j < limitCount; j++) {
+            partial.above[j] += static_cast<unsigned int>(_mm512_reduce_add_epi32(counts[j]));
+        }
+    }
+    scalarKernel(values + i, count - i, limits, limitCount, shift, partial);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+}  // namespace
+
+// mean
+double ColumnSummary::mean() const {
+    return (count > 0) ? static_cast<double>(sum) / count : 0.0;
+}
+
+// variance
+// Description: Uses the deviations from the first value, which keeps the subtraction well conditioned.
+double ColumnSummary::variance() const {
+    if (count < 2) {
+        return 0.0;
+    }
+    const double meanDeviation = mean() - shift;
+    return (squaredDeviations - count * meanDeviation * meanDeviation) / (count - 1);
+}
+
+// isKernelSupported
+bool isKernelSupported(StatisticsKernel kernel) {
+    switch (kernel) {
+#ifdef COLUMN_STATISTICS_X86
+    case StatisticsKernel::AVX2:
+        return __builtin_cpu_supports("avx2");
+    case StatisticsKernel::AVX512:
+        return __builtin_cpu_supports("avx512f");
+#endif
+    case StatisticsKernel::SCALAR:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// bestKernel
+StatisticsKernel bestKernel() {
+    if (isKernelSupported(StatisticsKernel::AVX512)) {
+        return StatisticsKernel::AVX512;
+    }
+    if (isKernelSupported(StatisticsKernel::AVX2)) {
+        return StatisticsKernel::AVX2;
+    }
+    return StatisticsKernel::SCALAR;
+}
+
+// kernelName
+const char* kernelName(StatisticsKernel kernel) {
+    switch (kernel) {
+    case StatisticsKernel::AVX2:
+        return "avx2";
+    case StatisticsKernel::AVX512:
+        return "avx512";
+    default:
+        return "scalar";
+    }
+}
+
+// summarizeColumn
+// Description: Turns the histogram boundaries into "greater than" limits, runs the kernel and converts the
+//              counts above each boundary into bins.
+ColumnSummary summarizeColumn(const int* values, std::size_t count, int threshold, int binWidth,
+                              unsigned int binCount, StatisticsKernel kernel) {
+    // limits[0] is the threshold; limits[k] = k * binWidth - 1 for the boundaries k = 1 .. binCount - 1
+    int limits[MAX_HISTOGRAM_BINS];
+    limits[0] = threshold;
+    for (unsigned int k = 1; k < binCount; k++) {
+        limits[k] = static_cast<int>(std::min<long long>(static_cast<long long>(k) * binWidth - 1, INT_MAX));
+    }
+
+    ColumnSummary summary;
+    summary.count = count;
+    summary.binCount = binCount;
+    summary.shift = (count > 0) ? values[0] : 0;
+
+    Partial partial;
+    switch (kernel) {
+#ifdef COLUMN_STATISTICS_X86
+    case StatisticsKernel::AVX2:
+        avx2Kernel(values, count, limits, binCount, summary.shift, partial);
+        break;
+    case StatisticsKernel::AVX512:
+        avx512Kernel(values, count, limits, binCount, summary.shift, partial);
+        break;
+#endif
+    default:
+        scalarKernel(values, count, limits, binCount, summary.shift, partial);
+        break;
+    }
+
+    summary.sum = partial.sum;
+    summary.squaredDeviations = partial.squaredDeviations;
+    if (count > 0) {
+        summary.minimum = partial.minimum;
+        summary.maximum = partial.maximum;
+    }
+    summary.aboveThreshold = partial.above[0];
+    // partial.above[k] (k >= 1) counts the values at or above boundary k
+    for (unsigned int k = 0; k < binCount; k++) {
+        unsigned long long atOrAbove = (k == 0) ? count : partial.above[k];
+        unsigned long long aboveNext = (k + 1 < binCount) ? partial.above[k + 1] : 0;
+        summary.histogram[k] = atOrAbove - aboveNext;
+    }
+    return summary;
+}
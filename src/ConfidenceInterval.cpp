@@ -0,0 +1,44 @@
+/*
+ * ConfidenceInterval.cpp
+ *
+ * Description: This file implements meanWithConfidence().
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <cmath>
+#include <cstddef>
+#include "../include/ConfidenceInterval.h"
+
+namespace {
+
+// Description: Returns the 0.975 quantile of Student's t distribution with the given degrees of freedom
+//              (the normal quantile beyond 30).
+double studentQuantile(std::size_t degrees) {
+    static const double quantiles[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                       2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                       2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    return degrees <= 30 ? quantiles[degrees - 1] : 1.96;
+}
+
+}
+
+// meanWithConfidence
+MeanWithConfidence meanWithConfidence(const std::vector<double>& values) {
+    double sum = 0;
+    for (double value : values) {
+        sum += value;
+    }
+    MeanWithConfidence result{sum / values.size(), 0.0, 0.0};
+    if (values.size() < 2) {
+        return result;
+    }
+    double squares = 0;
+    for (double value : values) {
+        squares += (value - result.mean) * (value - result.mean);
+    }
+    result.variance = squares / (values.size() - 1);
+    result.halfWidth = studentQuantile(values.size() - 1) * std::sqrt(result.variance / values.size());
+    return result;
+}
@@ -0,0 +1,50 @@
+/*
+ * CustomerRecords.cpp
+ *
+ * Description: This file implements the CustomerRecords class, the per-customer columns collected during
+ *              a simulation run.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include "../include/CustomerRecords.h"
+
+// reserve
+void CustomerRecords::reserve(std::size_t count) {
+    arrivals.reserve(count);
+    starts.reserve(count);
+    departures.reserve(count);
+    waits.reserve(count);
+}
+
+// append
+void CustomerRecords::append(int arrival, int start, int departure) {
+    arrivals.push_back(arrival);
+    starts.push_back(start);
+    departures.push_back(departure);
+    waits.push_back(start - arrival);
+}
+
+// size
+std::size_t CustomerRecords::size() const {
+    return waits.size();
+}
+
+// Columns
+
+const std::vector<int>& CustomerRecords::getArrivals() const {
+    return arrivals;
+}
+
+const std::vector<int>& CustomerRecords::getStarts() const {
+    return starts;
+}
+
+const std::vector<int>& CustomerRecords::getDepartures() const {
+    return departures;
+}
+
+const std::vector<int>& CustomerRecords::getWaits() const {
+    return waits;
+}
@@ -14,6 +14,7 @@
 
 #include <iostream>
 #include "../include/Event.h"
+#include "../include/EventTypeRegistry.h"
 
 // Default Constructor
 // Description: Initializes an Event object as an arrival event occurring at time 0 with a transaction length of 0.
@@ -29,9 +30,9 @@ Event::Event(EventType aType, int aTime) : type(aType), time(aTime), length(0) {
 // Constructor with EventType, time, and length
 // Description: Initializes an Event object with a specified type, time, and length. 
 //              This constructor is typically used for arrival events where the transaction length is known.
-// Postcondition: The event is set to the specified type, time, and length (if the type is ARRIVAL).
+// Postcondition: The event is set to the specified type, time, and length (0 if the type is DEPARTURE).
 Event::Event(EventType aType, int aTime, int aLength) 
-    : type(aType), time(aTime), length((aType == EventType::ARRIVAL) ? aLength : 0) { }
+    : type(aType), time(aTime), length((aType == EventType::DEPARTURE) ? 0 : aLength) { }
 
 // Getters
 
@@ -76,9 +77,9 @@ void Event::setTime(int aTime) {
 // setLength
 // Description: Sets the transaction length for the event. 
 //              The length is only relevant for arrival events, and will be set to 0 for departure events.
-// Postcondition: If the event is an ARRIVAL, the length is updated to the specified value. Otherwise, it is set to 0.
+// Postcondition: Unless the event is a DEPARTURE, the length is updated to the specified value. Otherwise, it is set to 0.
 void Event::setLength(int aLength) {
-   length = (type == EventType::ARRIVAL) ? aLength : 0;
+   length = (type == EventType::DEPARTURE) ? 0 : aLength;
 }
 
 // isArrival
@@ -92,12 +93,12 @@ bool Event::isArrival() const {
 
 // operator<=
 // Description: Compares two Event objects based on their time. 
-//              If the times are equal, ARRIVAL events are considered less than DEPARTURE events.
+//              If the times are equal, the events are ordered by type ID: ARRIVAL, DEPARTURE, then registered types.
 // Postcondition: Returns true if this event occurs before or at the same time as the rhs event. 
-//                If times are equal, ARRIVAL events are considered earlier than DEPARTURE events.
+//                If times are equal, it returns true if this event's type ID is not greater than rhs's.
 bool Event::operator<=(const Event& rhs) const {
    if (time == rhs.getTime()) {
-      return (type == rhs.getType()) || (type == EventType::ARRIVAL && rhs.getType() == EventType::DEPARTURE);
+      return static_cast<int>(type) <= static_cast<int>(rhs.getType());
    } else {
       return time < rhs.getTime();
    }
@@ -107,12 +108,16 @@ bool Event::operator<=(const Event& rhs) const {
 
 // print
 // Description: Outputs the details of the event to the console for debugging and verification.
-//              This includes the event type (as "Arrival" or "Departure"), the time, and the length if applicable.
+//              This includes the event type (as "Arrival", "Departure" or the registered name), the time, and the
+//              length if applicable.
 // Postcondition: The event details are printed to the console.
 void Event::print() const {
-   std::cout << "Event - Type: " << (type == EventType::ARRIVAL ? "Arrival" : "Departure") 
+   const char* name = type == EventType::ARRIVAL     ? "Arrival"
+                      : type == EventType::DEPARTURE ? "Departure"
+                                                     : EventTypeRegistry::getEntry(type).name;
+   std::cout << "Event - Type: " << name
              << ", Time: " << time 
-             << ((type == EventType::ARRIVAL) ? (", Length: " + std::to_string(length)) : "") 
+             << ((type != EventType::DEPARTURE) ? (", Length: " + std::to_string(length)) : "") 
              << std::endl;
 }
 
@@ -0,0 +1,208 @@
+/*
+ * EventLogWriter.cpp
+ *
+ * Description: This file implements the EventLogWriter class, which formats and writes the
+ *              per-event simulation log on a dedicated writer thread. The simulation thread only
+ *              stores a compact (type, time) record in a lock-free single-producer/single-consumer
+ *              ring buffer; the writer thread turns the records into text with the layout of their type in
+ *              the EventTypeRegistry, like outputEventProcessing, and writes the text in large blocks.
+ *
+ *              The ring indices are free-running counters: a slot is free while tail - head is
+ *              smaller than the ring size. The producer publishes a record with a release store of
+ *              tail and the consumer releases the slot with a release store of head, so neither side
+ *              ever takes a lock.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include "../include/EventLogWriter.h"
+#include "../include/EventTypeRegistry.h"
+
+namespace {
+
+// Longest formatted line of any event type
+const std::size_t MAX_LINE_LENGTH = EventTypeRegistry::MAX_LINE_LENGTH;
+
+// Rounds value up to the next power of two (minimum 2)
+std::size_t roundUpToPowerOfTwo(std::size_t value) {
+    std::size_t result = 2;
+    while (result < value) {
+        result *= 2;
+    }
+    return result;
+}
+
+}  // namespace
+
+// Constructor
+// Description: Allocates the ring and the text block, then starts the writer thread.
+EventLogWriter::EventLogWriter(std::FILE* out, OverflowPolicy policy, std::size_t ringCapacity, std::size_t blockSize)
+    : out(out), policy(policy), ring(roundUpToPowerOfTwo(ringCapacity)), mask(ring.size() - 1),
+      block(blockSize < 2 * MAX_LINE_LENGTH ? 2 * MAX_LINE_LENGTH : blockSize),
+      head(0), tail(0), stopping(false), droppedCount(0), finished(false) {
+    writer = std::thread(&EventLogWriter::run, this);
+}
+
+// Destructor
+// Description: Makes sure the writer thread is joined and the log is flushed.
+EventLogWriter::~EventLogWriter() {
+    finish();
+}
+
+// append
+// Description: Queues the record of event for the writer thread.
+//              Under OverflowPolicy::BLOCK the caller waits while the ring is full; under
+//              OverflowPolicy::DROP the record is discarded and counted instead.
+// Time Efficiency: O(1)
+bool EventLogWriter::append(const Event& event) {
+    std::size_t slot = tail.load(std::memory_order_relaxed);
+
+    while (slot - head.load(std::memory_order_acquire) > mask) {
+        if (policy == OverflowPolicy::DROP) {
+            droppedCount++;
+            return false;
+        }
+        std::this_thread::yield();
+    }
+
+    ring[slot & mask].time = event.getTime();
+    ring[slot & mask].type = event.getType();
+    tail.store(slot + 1, std::memory_order_release);
+    return true;
+}
+
+// finish
+// Description: Signals the writer thread that no more records will be appended, waits for it to
+//              drain the ring and flush the output stream.
+void EventLogWriter::finish() {
+    if (finished) {
+        return;
+    }
+    stopping.store(true, std::memory_order_release);
+    writer.join();
+    finished = true;
+}
+
+// getDroppedCount
+// Description: Returns the number of records discarded under OverflowPolicy::DROP.
+unsigned long long EventLogWriter::getDroppedCount() const {
+    return droppedCount;
+}
+
+// Utility method
+// Description: Body of the writer thread. Drains the ring into the text block, writing the block
+//              whenever it cannot hold another line, until finish() is called and the ring is empty.
+void EventLogWriter::run() {
+    std::size_t used = 0;
+    unsigned int idleRounds = 0;
+
+    while (true) {
+        // Read stopping before tail so that no record published before finish() is missed
+        bool lastRound = stopping.load(std::memory_order_acquire);
+        std::size_t current = head.load(std::memory_order_relaxed);
+        std::size_t available = tail.load(std::memory_order_acquire);
+
+        if (current == available) {
+            if (lastRound) {
+                break;
+            }
+            // Nothing to format: write out what we have so the log does not lag, then back off
+            if (used > 0) {
+                writeBlock(used);
+                used = 0;
+            }
+            if (++idleRounds < 64) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+            continue;
+        }
+
+        idleRounds = 0;
+        while (current != available) {
+            if (block.size() - used < MAX_LINE_LENGTH) {
+                writeBlock(used);
+                used = 0;
+            }
+            used += formatRecord(ring[current & mask], &block[used]);
+            current++;
+            // Release slots in batches so the producer sees progress without a store per record
+            if ((current & 255) == 0) {
+                head.store(current, std::memory_order_release);
+            }
+        }
+        head.store(current, std::memory_order_release);
+    }
+
+    if (used > 0) {
+        writeBlock(used);
+    }
+    std::fflush(out);
+}
+
+// Utility method
+// Description: Formats record into buffer using the layout of its type, as outputEventProcessing does.
+//              Returns the number of characters written (including the newline).
+std::size_t EventLogWriter::formatRecord(const Record& record, char* buffer) const {
+    const EventTypeRegistry::Entry& layout = EventTypeRegistry::getEntry(record.type);
+    const int width = layout.timeWidth;
+
+    std::memcpy(buffer, layout.prefix, layout.prefixLength);
+    char* cursor = buffer + layout.prefixLength;
+
+    // Convert the time to digits (least significant first), then right-align them like std::setw
+    char digits[12];
+    int digitCount = 0;
+    long long value = record.time;
+    bool negative = value < 0;
+    if (negative) {
+        value = -value;
+    }
+    do {
+        digits[digitCount++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    if (negative) {
+        digits[digitCount++] = '-';
+    }
+
+    for (int pad = width - digitCount; pad > 0; pad--) {
+        *cursor++ = ' ';
+    }
+    while (digitCount > 0) {
+        *cursor++ = digits[--digitCount];
+    }
+    *cursor++ = '\n';
+
+    return static_cast<std::size_t>(cursor - buffer);
+}
+
+// Utility method
+// Description: Writes the first length characters of the text block to the output stream.
+void EventLogWriter::writeBlock(std::size_t length) {
+    std::fwrite(block.data(), 1, length, out);
+}
+
+// Function: outputEventProcessing
+// Purpose: This helper function outputs a message indicating that an event is being processed. It formats
+//          the output to align the event times consistently, with the layout registered for the event's type
+//          (looked up by its ID, see EventTypeRegistry).
+//          When an asynchronous writer is given, only a compact record is queued and the writer thread
+//          produces the same text.
+// Parameters:
+//   - event: The event being processed.
+//   - asyncLog: The asynchronous event log writer, or nullptr to write the line directly.
+void outputEventProcessing(const Event& event, EventLogWriter* asyncLog) {
+    if (asyncLog != nullptr) {
+        asyncLog->append(event);
+    } else {
+        const EventTypeRegistry::Entry& layout = EventTypeRegistry::getEntry(event.getType());
+        std::cout << layout.prefix << std::setw(layout.timeWidth) << event.getTime() << std::endl;
+    }
+}
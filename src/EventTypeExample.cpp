@@ -0,0 +1,183 @@
+/*
+ * EventTypeExample.cpp
+ *
+ * Description:
+ * This file implements the EventTypeExample tool, an example of a registered event type that also checks the
+ * extension points it uses (EventTypeRegistry::add, BasicBankSimulation::setEventHandler and scheduleEvent):
+ *
+ *     EventTypeExample
+ *
+ * The tool registers an "audit" event type: an audit at time t with a payload of p reads the customers who have
+ * arrived and their total wait so far and, if p is positive, schedules the next audit at time t + p. It simulates a small day with audits
+ * one event at a time (step) and in groups of simultaneous events (stepBatch), for preloaded and streamed
+ * arrivals, and checks that:
+ * - every audit is processed, and writes the log line registered for its type;
+ * - simultaneous events are processed arrivals first, then departures, then audits;
+ * - an event of a registered type without a handler throws std::logic_error naming the type (handleUnknown).
+ *
+ * Each failed check is reported, and the tool then exits with status 1 (make test runs it).
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm> // For std::count, used to find the log lines of the built-in events
+#include <iostream>
+#include <sstream> // For std::ostringstream and std::istringstream, which capture and split the event log
+#include <stdexcept> // For std::logic_error, thrown for events without a handler
+#include <string>
+#include <vector>
+#include "../include/BankSimulation.h" // Include the simulation whose event types are extended
+#include "../include/EventTypeRegistry.h" // Include the registry of event types
+
+using std::cout;
+using std::cerr;
+using std::endl;
+using std::string;
+using std::vector;
+
+// The registered types: audits, and a type no simulation has a handler for
+static const Event::EventType AUDIT = EventTypeRegistry::add("audit", "Processing an audit event at time:", 6);
+static const Event::EventType UNHANDLED =
+    EventTypeRegistry::add("unhandled", "Processing an unhandled event at time:", 4);
+
+// Structure: AuditLog
+// Purpose: The context of the audit handler: the audits processed, in order, and what each one read.
+struct AuditLog {
+    vector<Event> processed;
+    vector<int> customers;
+    vector<long long> waits;
+};
+
+// Function: audit
+// Purpose: Handles an audit: records the customers and their wait so far and schedules the next audit a payload
+//          later.
+void audit(BankSimulation& simulation, Event& event, void* context) {
+    AuditLog& log = *static_cast<AuditLog*>(context);
+    log.processed.push_back(event);
+    log.customers.push_back(simulation.getCustomerCount());
+    log.waits.push_back(simulation.getCumulativeWaitTime());
+    if (event.getLength() > 0) {
+        simulation.scheduleEvent(Event(AUDIT, event.getTime() + event.getLength(), 0));
+    }
+}
+
+// Function: check
+// Purpose: Reports a failed check of the given run.
+// Returns: 1 if the check failed, otherwise 0.
+int check(bool passed, const string& run, const string& what) {
+    if (!passed) {
+        cerr << run << ": " << what << endl;
+    }
+    return passed ? 0 : 1;
+}
+
+// Function: checkDay
+// Purpose: Simulates a day with audits at times 0 and 3 (the second scheduling a third at time 5) and checks
+//          the audits, their log lines and the order of simultaneous events.
+// Returns: The number of failed checks.
+int checkDay(BankSimulation::ArrivalMode mode, bool batch, const string& run) {
+    // The first customer departs at time 3, when the third arrives, so time 3 has all three types
+    const vector<Event> arrivals = {Event(Event::EventType::ARRIVAL, 0, 3), Event(Event::EventType::ARRIVAL, 1, 4),
+                                    Event(Event::EventType::ARRIVAL, 3, 1)};
+    BankSimulation simulation(arrivals, 1, mode);
+    AuditLog log;
+    simulation.setEventHandler(AUDIT, audit, &log);
+    simulation.scheduleEvent(Event(AUDIT, 3, 2));
+    simulation.scheduleEvent(Event(AUDIT, 0, 0));
+
+    // Every event type records itself in the order processed, through the event log
+    std::ostringstream captured;
+    std::streambuf* standardOutput = cout.rdbuf(captured.rdbuf());
+    simulation.setEventLog(true);
+    try {
+        while (batch ? simulation.stepBatch() : simulation.step()) {
+        }
+    } catch (...) {
+        cout.rdbuf(standardOutput);
+        throw;
+    }
+    cout.rdbuf(standardOutput);
+
+    int failures = 0;
+    failures += check(log.processed.size() == 3, run,
+                      "expected 3 audits, got " + std::to_string(log.processed.size()));
+    if (log.processed.size() == 3) {
+        failures += check(log.processed[0].getTime() == 0 && log.processed[1].getTime() == 3 &&
+                          log.processed[2].getTime() == 5, run, "audits processed at the wrong times");
+        // The audit at time 3 comes after the arrival and the departure of time 3, which started the second
+        // customer's service after a wait of 2
+        failures += check(log.customers[0] == 1 && log.customers[1] == 3 && log.customers[2] == 3, run,
+                          "audits saw the wrong customer counts");
+        failures += check(log.waits[0] == 0 && log.waits[1] == 2 && log.waits[2] == 2, run,
+                          "audits saw the wrong waits");
+    }
+
+    // Preloaded arrivals keep the legacy order of an arrival and a departure at the same time, so the log is
+    // compared line by line in order only for the audits: each comes after every other event of its time
+    const vector<string> expected = {"Processing an arrival event at time:    0",
+                                     "Processing an audit event at time:     0",
+                                     "Processing an arrival event at time:    1",
+                                     "Processing an arrival event at time:    3",
+                                     "Processing a departure event at time:   3",
+                                     "Processing an audit event at time:     3",
+                                     "Processing an audit event at time:     5",
+                                     "Processing a departure event at time:   7",
+                                     "Processing a departure event at time:   8"};
+    vector<string> lines;
+    std::istringstream logged(captured.str());
+    for (string line; std::getline(logged, line);) {
+        lines.push_back(line);
+    }
+    bool ordered = lines.size() == expected.size();
+    for (std::size_t i = 0; ordered && i < lines.size(); i++) {
+        const bool isAudit = expected[i].find("audit") != string::npos;
+        ordered = isAudit ? lines[i] == expected[i]
+                          : std::count(expected.begin(), expected.end(), lines[i]) == 1 &&
+                                lines[i].substr(lines[i].size() - 2) == expected[i].substr(expected[i].size() - 2);
+    }
+    failures += check(ordered, run, "event log differs:\n" + captured.str());
+    failures += check(simulation.getCustomerCount() == 3 && simulation.getAverageWaitTime() == 2.0f, run,
+                      "audits changed the statistics");
+    return failures;
+}
+
+// Function: checkUnhandled
+// Purpose: Checks that an event of a registered type without a handler throws a std::logic_error naming it.
+// Returns: The number of failed checks.
+int checkUnhandled() {
+    const vector<Event> arrivals = {Event(Event::EventType::ARRIVAL, 0, 1)};
+    BankSimulation simulation(arrivals, 1, BankSimulation::ArrivalMode::STREAM);
+    simulation.scheduleEvent(Event(UNHANDLED, 2, 0));
+    try {
+        simulation.run();
+    } catch (const std::logic_error& error) {
+        return check(string(error.what()) == "no handler for event type unhandled", "unhandled",
+                     string("unexpected message: ") + error.what());
+    }
+    return check(false, "unhandled", "an event without a handler was processed");
+}
+
+// Function: main
+// Purpose: Runs every check and reports the result.
+// Returns: 0 if every check passed, otherwise 1.
+int main() {
+    int failures = 0;
+    try {
+        failures += checkDay(BankSimulation::ArrivalMode::PRELOAD, false, "preload, step");
+        failures += checkDay(BankSimulation::ArrivalMode::PRELOAD, true, "preload, stepBatch");
+        failures += checkDay(BankSimulation::ArrivalMode::STREAM, false, "stream, step");
+        failures += checkDay(BankSimulation::ArrivalMode::STREAM, true, "stream, stepBatch");
+        failures += checkUnhandled();
+    } catch (const std::exception& error) {
+        cerr << "unexpected exception: " << error.what() << endl;
+        failures++;
+    }
+
+    if (failures > 0) {
+        cerr << failures << " check(s) failed" << endl;
+        return 1;
+    }
+    cout << "All event type checks passed" << endl;
+    return 0;
+}
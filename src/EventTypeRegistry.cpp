@@ -0,0 +1,68 @@
+/*
+ * EventTypeRegistry.cpp
+ *
+ * Description: This file implements the EventTypeRegistry class. The entries are a fixed array of plain data
+ *              whose built-in types are constant-initialized, so the registry is complete before any static
+ *              constructor runs and a type can be registered from one.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include "../include/EventTypeRegistry.h"
+#include "../include/FullDataCollectionException.h"
+
+namespace {
+
+EventTypeRegistry::Entry entries[EventTypeRegistry::MAX_TYPES] = {
+    {"arrival", "Processing an arrival event at time:", 36, 5},
+    {"departure", "Processing a departure event at time:", 37, 4}};
+
+unsigned int count = 2;
+
+}
+
+// add
+Event::EventType EventTypeRegistry::add(const char* name, const char* logPrefix, int timeWidth) {
+    Event::EventType existing;
+    if (*name == '\0' || std::strlen(name) > MAX_NAME_LENGTH || std::strlen(logPrefix) > MAX_PREFIX_LENGTH ||
+        timeWidth < 0 || timeWidth > MAX_TIME_WIDTH) {
+        throw std::invalid_argument(std::string("invalid event type: ") + name);
+    }
+    if (find(name, existing)) {
+        throw std::invalid_argument(std::string("event type registered twice: ") + name);
+    }
+    if (count == MAX_TYPES) {
+        throw FullDataCollectionException("event type registry is full");
+    }
+    Entry& entry = entries[count];
+    std::strcpy(entry.name, name);
+    std::strcpy(entry.prefix, logPrefix);
+    entry.prefixLength = std::strlen(logPrefix);
+    entry.timeWidth = timeWidth;
+    return static_cast<Event::EventType>(count++);
+}
+
+// find
+bool EventTypeRegistry::find(const char* name, Event::EventType& type) {
+    for (unsigned int id = 0; id < count; id++) {
+        if (std::strcmp(entries[id].name, name) == 0) {
+            type = static_cast<Event::EventType>(id);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Getters
+
+unsigned int EventTypeRegistry::getCount() {
+    return count;
+}
+
+const EventTypeRegistry::Entry& EventTypeRegistry::getEntry(Event::EventType type) {
+    return entries[static_cast<unsigned int>(type)];
+}
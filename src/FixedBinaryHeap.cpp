@@ -0,0 +1,162 @@
+/*
+ * FixedBinaryHeap.cpp
+ *
+ * Description: This file implements the FixedBinaryHeap class, a min-heap with a compile-time capacity
+ *              whose elements live in a std::array inside the object. The algorithms are those of
+ *              BinaryHeap; reHeapDown is iterative and elements are swapped by hand so that every
+ *              operation can be evaluated in a constant expression.
+ *
+ * Class Invariant:
+ * - The binary heap maintains the heap property, where each parent node is less than or equal to
+ *   its child nodes in a min-heap configuration.
+ * - The heap never holds more than Capacity elements.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include "../include/FixedBinaryHeap.h"
+
+// Constructor
+// Description: Creates an empty heap. The storage is value-initialized so the object is a constant
+//              expression for literal element types.
+template<typename ElementType, unsigned int Capacity>
+constexpr FixedBinaryHeap<ElementType, Capacity>::FixedBinaryHeap() : elements{}, elementCount(0) {}
+
+// Description: Returns the number of elements in the Binary Heap.
+// Time Efficiency: O(1)
+template<typename ElementType, unsigned int Capacity>
+constexpr unsigned int FixedBinaryHeap<ElementType, Capacity>::getElementCount() const {
+    return elementCount;
+}
+
+// Description: Returns the compile-time capacity.
+// Time Efficiency: O(1)
+template<typename ElementType, unsigned int Capacity>
+constexpr unsigned int FixedBinaryHeap<ElementType, Capacity>::getCapacity() {
+    return Capacity;
+}
+
+// Description: Inserts newElement into the Binary Heap, or returns false if it is full.
+// Time Efficiency: O(log2 n)
+template<typename ElementType, unsigned int Capacity>
+constexpr bool FixedBinaryHeap<ElementType, Capacity>::insert(const ElementType& newElement) {
+    if (elementCount == Capacity) {
+        return false;
+    }
+
+    // Insert new element and reheap up to maintain heap property
+    elements[elementCount] = newElement;
+    reHeapUp(elementCount);
+    elementCount++;
+
+    return true;
+}
+
+// Description: Retrieves (but does not remove) the necessary element.
+// Exceptions: Throws EmptyDataCollectionException if this Binary Heap is empty.
+// Time Efficiency: O(1)
+template<typename ElementType, unsigned int Capacity>
+constexpr const ElementType& FixedBinaryHeap<ElementType, Capacity>::retrieve() const {
+    if (elementCount == 0) {
+        throw EmptyDataCollectionException();
+    }
+    return elements[0];
+}
+
+// Description: Removes (but does not return) the necessary element.
+// Exceptions: Throws EmptyDataCollectionException if this Binary Heap is empty.
+// Time Efficiency: O(log2 n)
+template<typename ElementType, unsigned int Capacity>
+constexpr void FixedBinaryHeap<ElementType, Capacity>::remove() {
+    if (elementCount == 0) {
+        throw EmptyDataCollectionException();
+    }
+
+    elements[0] = elements[elementCount - 1];
+    elementCount--;
+
+    if (elementCount > 0) {
+        reHeapDown(0);
+    }
+}
+
+// Description: Removes all elements equal to the minimum element and appends them to group.
+//              The elements equal to the root are found breadth-first (ascending index order), then the
+//              holes are filled from the highest index down, as in BinaryHeap::removeMinimumGroup.
+// Exceptions: Throws EmptyDataCollectionException if this Binary Heap is empty.
+// Time Efficiency: O(k log2 n) for k removed elements
+template<typename ElementType, unsigned int Capacity>
+void FixedBinaryHeap<ElementType, Capacity>::removeMinimumGroup(std::vector<ElementType>& group) {
+    if (elementCount == 0) {
+        throw EmptyDataCollectionException();
+    }
+
+    std::array<unsigned int, Capacity> holes;
+    unsigned int holeCount = 0;
+    holes[holeCount++] = 0;
+    for (unsigned int next = 0; next < holeCount; next++) {
+        unsigned int index = holes[next];
+        group.push_back(elements[index]);
+        for (unsigned int child = 2 * index + 1; child <= 2 * index + 2 && child < elementCount; child++) {
+            if (!(elements[0] < elements[child])) {
+                holes[holeCount++] = child;
+            }
+        }
+    }
+
+    while (holeCount > 0) {
+        unsigned int hole = holes[--holeCount];
+        elementCount--;
+        if (hole < elementCount) {
+            elements[hole] = elements[elementCount];
+            reHeapDown(hole);
+        }
+    }
+}
+
+// Utility method
+// Description: Moves the element at indexOfChild up until its parent is not greater.
+// Time efficiency: O(log2 n)
+template<typename ElementType, unsigned int Capacity>
+constexpr void FixedBinaryHeap<ElementType, Capacity>::reHeapUp(unsigned int indexOfChild) {
+    while (indexOfChild > 0) {
+        unsigned int indexOfParent = (indexOfChild - 1) / 2;
+        if (!(elements[indexOfParent] > elements[indexOfChild])) {
+            break;
+        }
+        ElementType parent = elements[indexOfParent];
+        elements[indexOfParent] = elements[indexOfChild];
+        elements[indexOfChild] = parent;
+        indexOfChild = indexOfParent;
+    }
+}
+
+// Utility method
+// Description: Moves the element at indexOfRoot down until no child is smaller.
+// Time efficiency: O(log2 n)
+template<typename ElementType, unsigned int Capacity>
+constexpr void FixedBinaryHeap<ElementType, Capacity>::reHeapDown(unsigned int indexOfRoot) {
+    while (true) {
+        unsigned int indexOfMinChild = indexOfRoot;
+        unsigned int indexOfLeftChild = 2 * indexOfRoot + 1;
+        unsigned int indexOfRightChild = 2 * indexOfRoot + 2;
+
+        if (indexOfLeftChild < elementCount && elements[indexOfLeftChild] < elements[indexOfMinChild]) {
+            indexOfMinChild = indexOfLeftChild;
+        }
+
+        if (indexOfRightChild < elementCount && elements[indexOfRightChild] < elements[indexOfMinChild]) {
+            indexOfMinChild = indexOfRightChild;
+        }
+
+        if (indexOfMinChild == indexOfRoot) {
+            return;
+        }
+
+        ElementType root = elements[indexOfRoot];
+        elements[indexOfRoot] = elements[indexOfMinChild];
+        elements[indexOfMinChild] = root;
+        indexOfRoot = indexOfMinChild;
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * FixedPriorityQueue.cpp
+ *
+ * Description: This file implements the FixedPriorityQueue class, a priority queue with a compile-time
+ *              capacity backed by a FixedBinaryHeap. Every operation forwards to the heap; no memory is
+ *              ever allocated.
+ *
+ * Class Invariant:
+ * - The FixedPriorityQueue maintains the heap property of its FixedBinaryHeap.
+ * - If the FixedPriorityQueue is empty, attempting to dequeue or peek throws an
+ *   EmptyDataCollectionException.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include "../include/FixedPriorityQueue.h"
+
+// Constructor
+template <typename ElementType, unsigned int Capacity>
+constexpr FixedPriorityQueue<ElementType, Capacity>::FixedPriorityQueue() : minheap() {
+    // No additional initialization needed
+}
+
+// Description: Returns true if this Priority Queue is empty, otherwise false.
+// Time Efficiency: O(1)
+template <typename ElementType, unsigned int Capacity>
+constexpr bool FixedPriorityQueue<ElementType, Capacity>::isEmpty() const {
+    return minheap.getElementCount() == 0;
+}
+
+// Description: Returns the number of elements in this Priority Queue.
+// Time Efficiency: O(1)
+template <typename ElementType, unsigned int Capacity>
+constexpr unsigned int FixedPriorityQueue<ElementType, Capacity>::getElementCount() const {
+    return minheap.getElementCount();
+}
+
+// Description: Inserts newElement, or returns false if the queue is full.
+// Time Efficiency: O(log2 n)
+template <typename ElementType, unsigned int Capacity>
+constexpr bool FixedPriorityQueue<ElementType, Capacity>::enqueue(const ElementType& newElement) {
+    return minheap.insert(newElement);
+}
+
+// Description: Removes (but does not return) the element with the next "highest" priority value.
+// Exception: Throws EmptyDataCollectionException if Priority Queue is empty.
+// Time Efficiency: O(log2 n)
+template <typename ElementType, unsigned int Capacity>
+constexpr void FixedPriorityQueue<ElementType, Capacity>::dequeue() {
+    if (isEmpty()) {
+        throw EmptyDataCollectionException();
+    }
+    minheap.remove();
+}
+
+// Description: Removes all elements equal to the front element and appends them to group.
+// Exception: Throws EmptyDataCollectionException if Priority Queue is empty.
+// Time Efficiency: O(k log2 n) for k removed elements
+template <typename ElementType, unsigned int Capacity>
+void FixedPriorityQueue<ElementType, Capacity>::dequeueGroup(std::vector<ElementType>& group) {
+    if (isEmpty()) {
+        throw EmptyDataCollectionException();
+    }
+    minheap.removeMinimumGroup(group);
+}
+
+// Description: Returns (but does not remove) the element with the next "highest" priority value.
+// Exception: Throws EmptyDataCollectionException if this Priority Queue is empty.
+// Time Efficiency: O(1)
+template <typename ElementType, unsigned int Capacity>
+constexpr const ElementType& FixedPriorityQueue<ElementType, Capacity>::peek() const {
+    if (isEmpty()) {
+        throw EmptyDataCollectionException();
+    }
+    return minheap.retrieve();
+}
+
+// Function: fixedPriorityQueueDrainsInOrder
+// Purpose: Fills a queue out of order past its capacity and drains it, in a constant expression.
+// Returns: true if the extra element was refused and the elements came out in increasing order.
+constexpr bool fixedPriorityQueueDrainsInOrder() {
+    FixedPriorityQueue<int, 8> queue;
+    const int values[] = {5, 3, 8, 1, 9, 2, 7, 4};
+    for (int value : values) {
+        queue.enqueue(value);
+    }
+    if (queue.enqueue(6) || queue.getElementCount() != 8) {
+        return false;
+    }
+    const int expected[] = {1, 2, 3, 4, 5, 7, 8, 9};
+    for (int value : expected) {
+        if (queue.isEmpty() || queue.peek() != value) {
+            return false;
+        }
+        queue.dequeue();
+    }
+    return queue.isEmpty();
+}
+
+static_assert(fixedPriorityQueueDrainsInOrder(), "FixedPriorityQueue must work in constant expressions");
@@ -0,0 +1,110 @@
+/*
+ * FixedQueue.cpp
+ *
+ * Description: This file implements the FixedQueue class, a FIFO queue stored in a circular buffer with
+ *              a compile-time capacity. Elements are enqueued at index (front + size) % Capacity and
+ *              dequeued at index front; no memory is allocated or freed.
+ *
+ * Class Invariant:
+ * - The queue is maintained in FIFO order.
+ * - The queue never holds more than Capacity elements.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Date: Oct. 2026
+ */
+
+#include "../include/FixedQueue.h"
+
+template<typename ElementType, unsigned int Capacity>
+constexpr FixedQueue<ElementType, Capacity>::FixedQueue() : elements{}, front(0), size(0) {
+    // Constructor body is empty because initialization is done using initializer list
+}
+
+// isEmpty
+// Description: Returns true if the Queue is empty, otherwise false.
+template<typename ElementType, unsigned int Capacity>
+constexpr bool FixedQueue<ElementType, Capacity>::isEmpty() const {
+    return size == 0;
+}
+
+// getElementCount
+// Description: Returns the number of elements in the Queue.
+template<typename ElementType, unsigned int Capacity>
+constexpr unsigned int FixedQueue<ElementType, Capacity>::getElementCount() const {
+    return size;
+}
+
+// enqueue
+// Description: Inserts newElement at the back of the Queue, or returns false if it is full.
+// Time Efficiency: O(1)
+template<typename ElementType, unsigned int Capacity>
+constexpr bool FixedQueue<ElementType, Capacity>::enqueue(const ElementType& newElement) {
+    if (size == Capacity) {
+        return false;
+    }
+
+    unsigned int back = front + size;
+    if (back >= Capacity) {
+        back -= Capacity;
+    }
+    elements[back] = newElement;
+    ++size;
+    return true;  // Successful insertion
+}
+
+// dequeue
+// Description: Removes the element at the front of the Queue.
+// Exception: Throws EmptyDataCollectionException if the Queue is empty.
+// Time Efficiency: O(1)
+template<typename ElementType, unsigned int Capacity>
+constexpr void FixedQueue<ElementType, Capacity>::dequeue() {
+    if (isEmpty()) {
+        throw EmptyDataCollectionException();
+    }
+
+    ++front;
+    if (front == Capacity) {
+        front = 0;
+    }
+    --size;
+}
+
+// peek
+// Description: Returns the element at the front of the Queue without removing it.
+// Exception: Throws EmptyDataCollectionException if the Queue is empty.
+// Time Efficiency: O(1)
+template<typename ElementType, unsigned int Capacity>
+constexpr const ElementType& FixedQueue<ElementType, Capacity>::peek() const {
+    if (isEmpty()) {
+        throw EmptyDataCollectionException();
+    }
+
+    return elements[front];
+}
+
+// Function: fixedQueueDrainsInOrder
+// Purpose: Fills a queue past its capacity, wraps its elements around the end of the array and drains it,
+//          in a constant expression.
+// Returns: true if the extra element was refused and the elements came out in the order they went in.
+constexpr bool fixedQueueDrainsInOrder() {
+    FixedQueue<int, 4> queue;
+    for (int value = 1; value <= 4; value++) {
+        queue.enqueue(value);
+    }
+    if (queue.enqueue(5)) {
+        return false;
+    }
+    queue.dequeue();
+    queue.dequeue();
+    queue.enqueue(5);
+    queue.enqueue(6);
+    for (int value = 3; value <= 6; value++) {
+        if (queue.isEmpty() || queue.peek() != value) {
+            return false;
+        }
+        queue.dequeue();
+    }
+    return queue.isEmpty();
+}
+
+static_assert(fixedQueueDrainsInOrder(), "FixedQueue must work in constant expressions");
@@ -0,0 +1,212 @@
+/*
+ * FluidApproximation.cpp
+ *
+ * Description: This file implements the FluidApproximation class: the tables of the stationary utilization,
+ *              the right-hand side of the equation and its integration with the Dormand-Prince 5(4) pair.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "../include/FluidApproximation.h"
+#include "../include/AnalyticModel.h"
+
+namespace {
+
+// Entries of the utilization table of a teller count; entry j is at rho = 1 - (1 - j / TABLE_SIZE)^3, dense
+// near 1 where the line grows fast
+const int TABLE_SIZE = 512;
+
+// Dormand-Prince 5(4) coefficients: the nodes' weights A, the fifth-order weights B (also the last row of A)
+// and the differences E between the fifth- and the fourth-order weights
+const double A[6][6] = {
+    {1.0 / 5},
+    {3.0 / 40, 9.0 / 40},
+    {44.0 / 45, -56.0 / 15, 32.0 / 9},
+    {19372.0 / 6561, -25360.0 / 2187, 64448.0 / 6561, -212.0 / 729},
+    {9017.0 / 3168, -355.0 / 33, 46732.0 / 5247, 49.0 / 176, -5103.0 / 18656},
+    {35.0 / 384, 0, 500.0 / 1113, 125.0 / 192, -2187.0 / 6784, 11.0 / 84}};
+const double E[7] = {71.0 / 57600, 0, -71.0 / 16695, 71.0 / 1920, -17253.0 / 339200, 22.0 / 525, -1.0 / 40};
+
+}
+
+// Constructor
+FluidApproximation::FluidApproximation(int tellers, const std::vector<StaffingChange>& staffing,
+                                       const Options& options)
+    : tellers(tellers), staffing(staffing), options(options), customers(0), lengthSum(0), lengthSquares(0),
+      serviceRate(0), instantService(false), lineFactor(1) {}
+
+// addCustomer
+void FluidApproximation::addCustomer(int arrival, int length) {
+    std::size_t bin = arrival < 0 ? 0 : static_cast<std::size_t>(arrival / options.binWidth);
+    if (bin >= counts.size()) {
+        counts.resize(bin + 1, 0.0);
+    }
+    counts[bin]++;
+    customers++;
+    lengthSum += length;
+    lengthSquares += static_cast<double>(length) * length;
+}
+
+// run
+// Description: Walks the bins (continuing with empty ones once the arrivals are over), integrates each bin
+//              piece by piece between staffing changes, and samples the bank at its end.
+FluidApproximation::Result FluidApproximation::run() {
+    double meanLength = lengthSum / customers;
+    double variance = std::max(0.0, lengthSquares / customers - meanLength * meanLength);
+    instantService = !(meanLength >= INSTANT_SERVICE * options.binWidth);
+    serviceRate = instantService ? 0 : 1 / meanLength;
+    lineFactor = meanLength > 0 ? (1 + variance / (meanLength * meanLength)) / 2 : 1;
+
+    Result result;
+    result.customers = customers * options.scale;
+    result.peakLineLength = 0;
+    result.peakTime = 0;
+    result.acceptedSteps = 0;
+    result.rejectedSteps = 0;
+
+    double inBank = 0, area = 0, step = options.binWidth, time = 0;
+    std::size_t nextChange = 0;
+    int onDuty = tellers;
+    for (std::size_t bin = 0;; bin++) {
+        while (nextChange < staffing.size() && staffing[nextChange].time <= time) {
+            onDuty = staffing[nextChange++].tellers;
+        }
+        bool arriving = bin < counts.size();
+        if (!arriving && (inBank < DRAINED || (onDuty == 0 && nextChange == staffing.size()))) {
+            break;
+        }
+        double arrivalRate = arriving ? counts[bin] * options.scale / options.binWidth : 0;
+        double end = static_cast<double>(bin + 1) * options.binWidth;
+        while (time < end) {
+            double to = nextChange < staffing.size() ? std::min<double>(end, staffing[nextChange].time) : end;
+            if (instantService && onDuty > 0) {
+                inBank = 0;  // Every customer is served on arrival and leaves at once
+            } else {
+                integrate(inBank, area, step, time, to, arrivalRate, onDuty * options.scale, result);
+            }
+            time = to;
+            while (nextChange < staffing.size() && staffing[nextChange].time <= time) {
+                onDuty = staffing[nextChange++].tellers;
+            }
+        }
+        int c = onDuty * options.scale;
+        double line = lineLength(inBank, c);
+        double throughput = serviceRate * c * utilization(inBank, c);
+        result.trajectory.push_back(
+            Sample{time, arrivalRate, c, inBank, line, throughput > 0 ? line / throughput : 0.0});
+    }
+
+    result.drainedAt = time;
+    result.averageWait = result.customers > 0 ? area / result.customers : 0;
+    result.averageLineLength = time > 0 ? area / time : 0;
+    return result;
+}
+
+// Utility method
+// Description: Returns the utilization table of c tellers, building it on first use.
+const FluidApproximation::Table& FluidApproximation::tableFor(int c) const {
+    std::map<int, Table>::iterator found = tables.find(c);
+    if (found != tables.end()) {
+        return found->second;
+    }
+    Table& table = tables[c];
+    for (int j = 0; j < TABLE_SIZE; j++) {
+        double rho = 1 - std::pow(1 - static_cast<double>(j) / TABLE_SIZE, 3);
+        double line = rho > 0 ? lineFactor * AnalyticModel::erlangC(c, c * rho) * rho / (1 - rho) : 0;
+        table.rho.push_back(rho);
+        table.inBank.push_back(c * rho + line);
+    }
+    return table;
+}
+
+// Utility method
+// Description: Inverts x(rho) = c * rho + line(rho). Beyond the table the line is lineFactor * rho / (1 - rho)
+//              (every customer waits), and x(rho) = x is a quadratic equation in rho.
+double FluidApproximation::utilization(double inBank, int c) const {
+    if (c <= 0 || inBank <= 0) {
+        return 0;
+    }
+    const Table& table = tableFor(c);
+    if (inBank >= table.inBank.back()) {
+        double b = c + lineFactor + inBank;
+        return (b - std::sqrt(b * b - 4.0 * c * inBank)) / (2.0 * c);
+    }
+    std::size_t high = static_cast<std::size_t>(
+        std::upper_bound(table.inBank.begin(), table.inBank.end(), inBank) - table.inBank.begin());
+    std::size_t low = high - 1;
+    double fraction = (inBank - table.inBank[low]) / (table.inBank[high] - table.inBank[low]);
+    return table.rho[low] + fraction * (table.rho[high] - table.rho[low]);
+}
+
+// Utility method
+// Description: The right-hand side of the equation, dx/dt.
+double FluidApproximation::inflow(double inBank, double arrivalRate, int c) const {
+    return arrivalRate - serviceRate * c * utilization(inBank, c);
+}
+
+// Utility method
+double FluidApproximation::lineLength(double inBank, int c) const {
+    return std::max(0.0, inBank - c * utilization(inBank, c));
+}
+
+// Utility method
+// Description: Integrates the bank and the area under its line from time from to time to, with constant
+//              arrival rate and tellers. step is the step size to try first and receives the one to try next.
+//              The error of a step is its estimate relative to tolerance * (1 + the larger value) of each
+//              component; steps are resized by 0.9 * error^(-1/5), within a factor of 5 either way.
+void FluidApproximation::integrate(double& inBank, double& area, double& step, double from, double to,
+                                   double arrivalRate, int c, Result& result) const {
+    double time = from;
+    while (time < to) {
+        double h = std::min(step, to - time);
+        bool last = h == to - time;
+
+        // Stages of x and of the area (whose derivative is the line length at the stage's x)
+        double dx[7], da[7];
+        for (int stage = 0; stage < 7; stage++) {
+            double x = inBank;
+            for (int k = 0; k < stage; k++) {
+                x += h * A[stage - 1][k] * dx[k];
+            }
+            x = std::max(0.0, x);
+            dx[stage] = inflow(x, arrivalRate, c);
+            da[stage] = lineLength(x, c);
+        }
+        double nextInBank = inBank, nextArea = area, errorInBank = 0, errorArea = 0;
+        for (int k = 0; k < 6; k++) {
+            nextInBank += h * A[5][k] * dx[k];
+            nextArea += h * A[5][k] * da[k];
+        }
+        for (int k = 0; k < 7; k++) {
+            errorInBank += h * E[k] * dx[k];
+            errorArea += h * E[k] * da[k];
+        }
+        nextInBank = std::max(0.0, nextInBank);
+        double error = std::max(
+            std::fabs(errorInBank) / (options.tolerance * (1 + std::max(inBank, nextInBank))),
+            std::fabs(errorArea) / (options.tolerance * (1 + std::max(area, nextArea))));
+
+        double factor = error > 0 ? 0.9 * std::pow(error, -0.2) : 5;
+        factor = std::min(5.0, std::max(0.2, factor));
+        if (error > 1 && h > 1e-9 * (1 + to)) {
+            result.rejectedSteps++;
+            step = h * factor;
+            continue;
+        }
+        result.acceptedSteps++;
+        time = last ? to : time + h;
+        inBank = nextInBank;
+        area = nextArea;
+        double line = lineLength(inBank, c);
+        if (line > result.peakLineLength) {
+            result.peakLineLength = line;
+            result.peakTime = time;
+        }
+        if (!last || factor > 1) {
+            step = h * factor;
+        }
+    }
+}
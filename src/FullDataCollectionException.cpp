@@ -0,0 +1,14 @@
+/*
+ * FullDataCollectionException.cpp
+ *
+ * Class Description: Defines the exception that is thrown when a fixed-capacity data collection is full.
+ *
+ * Author: Inspired from our textbook's authors Frank M. Carrano and Tim Henry.
+ *         Copyright (c) 2013 __Pearson Education__. All rights reserved.
+ */
+ 
+#include "../include/FullDataCollectionException.h"  
+
+// Constructor
+FullDataCollectionException::FullDataCollectionException(const string& message): 
+logic_error("FullDataCollectionException: " + message) {}
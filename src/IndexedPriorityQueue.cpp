@@ -0,0 +1,150 @@
+/*
+ * IndexedPriorityQueue.cpp
+ *
+ * Description: This file implements the IndexedPriorityQueue class, a binary min-heap of slots with a
+ *              position map. Every move of a slot in the heap array also updates its position, so an
+ *              element can be found, re-keyed or removed without searching for it.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include "../include/IndexedPriorityQueue.h"
+
+// Constructor
+template <typename ElementType>
+IndexedPriorityQueue<ElementType>::IndexedPriorityQueue(unsigned int slotCount)
+    : elementCount(0), elements(slotCount), heap(slotCount), position(slotCount, NOT_QUEUED) {}
+
+// isEmpty
+template <typename ElementType>
+bool IndexedPriorityQueue<ElementType>::isEmpty() const {
+    return elementCount == 0;
+}
+
+// getElementCount
+template <typename ElementType>
+unsigned int IndexedPriorityQueue<ElementType>::getElementCount() const {
+    return elementCount;
+}
+
+// contains
+template <typename ElementType>
+bool IndexedPriorityQueue<ElementType>::contains(unsigned int slot) const {
+    return position[slot] != NOT_QUEUED;
+}
+
+// update
+// Description: A new slot is appended and moved up; a re-keyed slot moves up or down from where it is.
+template <typename ElementType>
+void IndexedPriorityQueue<ElementType>::update(unsigned int slot, const ElementType& newElement) {
+    elements[slot] = newElement;
+    if (position[slot] == NOT_QUEUED) {
+        place(elementCount++, slot);
+        reHeapUp(elementCount - 1);
+    } else {
+        reHeapUp(position[slot]);
+        reHeapDown(position[slot]);
+    }
+}
+
+// remove
+// Description: The last slot of the heap array takes the removed slot's place and moves up or down.
+template <typename ElementType>
+void IndexedPriorityQueue<ElementType>::remove(unsigned int slot) {
+    unsigned int index = position[slot];
+    if (index == NOT_QUEUED) {
+        return;
+    }
+    position[slot] = NOT_QUEUED;
+    elementCount--;
+    if (index < elementCount) {
+        unsigned int moved = heap[elementCount];
+        place(index, moved);
+        reHeapUp(index);
+        reHeapDown(position[moved]);
+    }
+}
+
+// dequeue
+template <typename ElementType>
+void IndexedPriorityQueue<ElementType>::dequeue() {
+    if (isEmpty()) {
+        throw EmptyDataCollectionException();
+    }
+    remove(heap[0]);
+}
+
+// peek
+template <typename ElementType>
+const ElementType& IndexedPriorityQueue<ElementType>::peek() const {
+    if (isEmpty()) {
+        throw EmptyDataCollectionException();
+    }
+    return elements[heap[0]];
+}
+
+// peekSlot
+template <typename ElementType>
+unsigned int IndexedPriorityQueue<ElementType>::peekSlot() const {
+    if (isEmpty()) {
+        throw EmptyDataCollectionException();
+    }
+    return heap[0];
+}
+
+// Utility method
+// Description: Returns true if the element of slot leaves the queue before the element of other.
+template <typename ElementType>
+bool IndexedPriorityQueue<ElementType>::precedes(unsigned int slot, unsigned int other) const {
+    if (elements[slot] < elements[other]) {
+        return true;
+    }
+    return !(elements[other] < elements[slot]) && slot < other;
+}
+
+// Utility method
+// Description: Stores slot at heap[index] and records its position.
+template <typename ElementType>
+void IndexedPriorityQueue<ElementType>::place(unsigned int index, unsigned int slot) {
+    heap[index] = slot;
+    position[slot] = index;
+}
+
+// Utility method
+// Description: Moves the slot at index up while it precedes its parent.
+template <typename ElementType>
+void IndexedPriorityQueue<ElementType>::reHeapUp(unsigned int index) {
+    unsigned int slot = heap[index];
+    while (index > 0) {
+        unsigned int parent = (index - 1) / 2;
+        if (!precedes(slot, heap[parent])) {
+            break;
+        }
+        place(index, heap[parent]);
+        index = parent;
+    }
+    place(index, slot);
+}
+
+// Utility method
+// Description: Moves the slot at index down while one of its children precedes it.
+template <typename ElementType>
+void IndexedPriorityQueue<ElementType>::reHeapDown(unsigned int index) {
+    unsigned int slot = heap[index];
+    while (true) {
+        unsigned int child = 2 * index + 1;
+        if (child >= elementCount) {
+            break;
+        }
+        if (child + 1 < elementCount && precedes(heap[child + 1], heap[child])) {
+            child++;
+        }
+        if (!precedes(heap[child], slot)) {
+            break;
+        }
+        place(index, heap[child]);
+        index = child;
+    }
+    place(index, slot);
+}
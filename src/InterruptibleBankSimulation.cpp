@@ -0,0 +1,307 @@
+/*
+ * InterruptibleBankSimulation.cpp
+ *
+ * Description: This file implements the InterruptibleBankSimulation class. The next event is the earliest of
+ *              the next arrival, the earliest departure and the earliest availability change; each of the
+ *              two queues is keyed by teller, so interrupting a teller only touches that teller's slots.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include "../include/InterruptibleBankSimulation.h"
+
+namespace {
+
+// Longest random up or repair time drawn
+const int LONGEST_DRAW = INT_MAX / 4;
+
+// Description: Returns the mean of an exponential time that has the given mean (greater than 1) once rounded
+//              up to a whole time unit, where it is geometric with mean 1 / (1 - exp(-1 / m)).
+double roundedUpMean(double mean) {
+    return -1.0 / std::log1p(-1.0 / mean);
+}
+
+// Description: Returns the time a nonnegative delay after time, or INT_MAX if that is later, so that the result
+//              is never before time. The bound is checked before adding, so the sum cannot overflow.
+int later(int time, int delay) {
+    return time > INT_MAX - delay ? INT_MAX : time + delay;
+}
+
+}  // namespace
+
+// Constructor
+InterruptibleBankSimulation::InterruptibleBankSimulation(const std::vector<Event>& arrivals, int tellers, Policy policy)
+    : arrivals(&arrivals), tellers(tellers), policy(policy), scheduleEnd(tellers, 0), failures(false),
+      meanTimeBetweenFailures(0), meanTimeToRepair(0), remaining(arrivals.size()), enqueuedAt(arrivals.size()),
+      serviceStart(arrivals.size()), waitTime(arrivals.size(), 0), nextArrival(0), customer(tellers, NO_CUSTOMER),
+      down(tellers, 0), downSince(tellers, 0), pendingDuration(tellers, 0), nextScheduled(tellers, 0),
+      nextFailure(tellers, INT_MAX), idleCount(tellers), departures(tellers), transitions(tellers),
+      simulationTime(0), customerCount(0), cumulativeWaitTime(0), longestWait(0), eventsProcessed(0),
+      scheduledInterruptions(0), randomInterruptions(0), preemptions(0), lostServiceTime(0), unavailableTime(0) {}
+
+// setSchedule
+// Description: Sorts the interruptions by teller and time and records where each teller's slice ends.
+void InterruptibleBankSimulation::setSchedule(const std::vector<Interruption>& interruptions) {
+    schedule = interruptions;
+    std::stable_sort(schedule.begin(), schedule.end(), [](const Interruption& lhs, const Interruption& rhs) {
+        return lhs.teller < rhs.teller || (lhs.teller == rhs.teller && lhs.time < rhs.time);
+    });
+    std::size_t index = 0;
+    for (int teller = 0; teller < tellers; teller++) {
+        nextScheduled[teller] = index;
+        while (index < schedule.size() && schedule[index].teller == teller) {
+            index++;
+        }
+        scheduleEnd[teller] = index;
+    }
+}
+
+// setFailures
+void InterruptibleBankSimulation::setFailures(double meanTimeBetweenFailures, double meanTimeToRepair,
+                                              unsigned long long seed) {
+    failures = true;
+    this->meanTimeBetweenFailures = meanTimeBetweenFailures;
+    this->meanTimeToRepair = meanTimeToRepair;
+    generator.seed(seed);
+}
+
+// run
+// Description: Schedules the first interruption of every teller, then processes the earliest event until
+//              no customer is left. Arrivals win ties against departures, departures against availability
+//              changes.
+void InterruptibleBankSimulation::run() {
+    for (int teller = 0; teller < tellers; teller++) {
+        if (failures) {
+            nextFailure[teller] = draw(meanTimeBetweenFailures);
+        }
+        scheduleNextInterruption(teller);
+    }
+
+    while (nextArrival < arrivals->size() || !departures.isEmpty() || !bankLine.empty()) {
+        const bool arrivalLeft = nextArrival < arrivals->size();
+        const int arrivalTime = arrivalLeft ? (*arrivals)[nextArrival].getTime() : INT_MAX;
+        const int departureTime = departures.isEmpty() ? INT_MAX : departures.peek();
+        const int transitionTime = transitions.isEmpty() ? INT_MAX : transitions.peek();
+        if (arrivalLeft && arrivalTime <= departureTime && arrivalTime <= transitionTime) {
+            processArrival();
+        } else if (!departures.isEmpty() && departureTime <= transitionTime) {
+            processDeparture();
+        } else {
+            processTransition();
+        }
+        eventsProcessed++;
+    }
+
+    // Interruptions still going on when the last customer leaves count up to that time
+    for (int teller = 0; teller < tellers; teller++) {
+        if (down[teller]) {
+            unavailableTime += simulationTime - downSince[teller];
+        }
+    }
+}
+
+// Getters
+
+int InterruptibleBankSimulation::getSimulationTime() const {
+    return simulationTime;
+}
+
+int InterruptibleBankSimulation::getCustomerCount() const {
+    return customerCount;
+}
+
+long long InterruptibleBankSimulation::getCumulativeWaitTime() const {
+    return cumulativeWaitTime;
+}
+
+float InterruptibleBankSimulation::getAverageWaitTime() const {
+    return static_cast<float>(cumulativeWaitTime) / customerCount;
+}
+
+long long InterruptibleBankSimulation::getLongestWait() const {
+    return longestWait;
+}
+
+unsigned long long InterruptibleBankSimulation::getEventsProcessed() const {
+    return eventsProcessed;
+}
+
+unsigned long long InterruptibleBankSimulation::getScheduledInterruptions() const {
+    return scheduledInterruptions;
+}
+
+unsigned long long InterruptibleBankSimulation::getRandomInterruptions() const {
+    return randomInterruptions;
+}
+
+unsigned long long InterruptibleBankSimulation::getPreemptions() const {
+    return preemptions;
+}
+
+long long InterruptibleBankSimulation::getLostServiceTime() const {
+    return lostServiceTime;
+}
+
+long long InterruptibleBankSimulation::getUnavailableTime() const {
+    return unavailableTime;
+}
+
+// Utility method
+// Description: Draws an exponentially distributed time rounded up to whole time units, so that its mean after
+//              rounding is the given mean; a mean of at most 1 always gives 1.
+int InterruptibleBankSimulation::draw(double mean) {
+    if (mean <= 1) {
+        return 1;
+    }
+    std::exponential_distribution<double> distribution(1.0 / roundedUpMean(mean));
+    double value = std::ceil(distribution(generator));
+    return static_cast<int>(std::min(std::max(value, 1.0), static_cast<double>(LONGEST_DRAW)));
+}
+
+// Utility method
+// Description: Queues the next interruption of an available teller: its next scheduled interruption or its
+//              next random failure, whichever comes first.
+void InterruptibleBankSimulation::scheduleNextInterruption(int teller) {
+    int next = nextFailure[teller];
+    if (nextScheduled[teller] < scheduleEnd[teller]) {
+        next = std::min(next, schedule[nextScheduled[teller]].time);
+    }
+    if (next != INT_MAX) {
+        transitions.update(teller, next);
+    }
+}
+
+// Utility method
+// Description: The arriving customer joins the end of the bank line and is served at once if a teller is free.
+void InterruptibleBankSimulation::processArrival() {
+    const Event& arrival = (*arrivals)[nextArrival];
+    std::size_t newCustomer = nextArrival++;
+    simulationTime = arrival.getTime();
+    customerCount++;
+    remaining[newCustomer] = arrival.getLength();
+    enqueuedAt[newCustomer] = simulationTime;
+    bankLine.push_back(newCustomer);
+    serveWaiting(simulationTime);
+}
+
+// Utility method
+// Description: The customer of the earliest departure leaves. The freed teller starts an interruption that
+//              waited for this customer, or serves the next customer in the bank line.
+void InterruptibleBankSimulation::processDeparture() {
+    int teller = static_cast<int>(departures.peekSlot());
+    simulationTime = departures.peek();
+    departures.dequeue();
+    longestWait = std::max(longestWait, waitTime[customer[teller]]);
+    customer[teller] = NO_CUSTOMER;
+
+    if (pendingDuration[teller] > 0) {
+        int duration = pendingDuration[teller];
+        pendingDuration[teller] = 0;
+        goDown(teller, simulationTime, duration);
+    } else {
+        idleCount++;
+        serveWaiting(simulationTime);
+    }
+}
+
+// Utility method
+// Description: A teller that is down comes back and serves the bank line; a teller that is up is interrupted
+//              by its next scheduled interruption or random failure, whichever is due.
+void InterruptibleBankSimulation::processTransition() {
+    int teller = static_cast<int>(transitions.peekSlot());
+    simulationTime = transitions.peek();
+    transitions.dequeue();
+
+    if (down[teller]) {
+        down[teller] = 0;
+        unavailableTime += simulationTime - downSince[teller];
+        if (failures) {
+            // Up times are memoryless, so a failure clock that ran during a break is simply redrawn
+            nextFailure[teller] = later(simulationTime, draw(meanTimeBetweenFailures));
+        }
+        scheduleNextInterruption(teller);
+        idleCount++;
+        serveWaiting(simulationTime);
+        return;
+    }
+
+    int duration;
+    if (nextScheduled[teller] < scheduleEnd[teller] && schedule[nextScheduled[teller]].time <= nextFailure[teller]) {
+        duration = schedule[nextScheduled[teller]++].duration;
+        scheduledInterruptions++;
+    } else {
+        duration = draw(meanTimeToRepair);
+        nextFailure[teller] = INT_MAX;
+        randomInterruptions++;
+    }
+    interrupt(teller, simulationTime, duration);
+}
+
+// Utility method
+// Description: Interrupts teller at time. With FINISH_CURRENT a busy teller only remembers the interruption;
+//              otherwise its departure is removed and its customer returns to the head of the bank line,
+//              where a free teller (if any) takes over.
+void InterruptibleBankSimulation::interrupt(int teller, int time, int duration) {
+    std::size_t current = customer[teller];
+    if (current == NO_CUSTOMER) {
+        idleCount--;
+        goDown(teller, time, duration);
+        return;
+    }
+    if (policy == Policy::FINISH_CURRENT) {
+        pendingDuration[teller] = std::max(pendingDuration[teller], duration);
+        return;
+    }
+
+    departures.remove(teller);
+    int served = time - serviceStart[current];
+    if (policy == Policy::PREEMPT_RESUME) {
+        remaining[current] -= served;
+    } else {
+        lostServiceTime += served;
+    }
+    customer[teller] = NO_CUSTOMER;
+    enqueuedAt[current] = time;
+    bankLine.push_front(current);
+    preemptions++;
+    goDown(teller, time, duration);
+    serveWaiting(time);
+}
+
+// Utility method
+// Description: Takes teller down from time for duration. Scheduled interruptions of the teller that start
+//              before it is back are merged into this one.
+void InterruptibleBankSimulation::goDown(int teller, int time, int duration) {
+    down[teller] = 1;
+    downSince[teller] = time;
+    int until = later(time, duration);
+    while (nextScheduled[teller] < scheduleEnd[teller] && schedule[nextScheduled[teller]].time <= until) {
+        const Interruption& merged = schedule[nextScheduled[teller]++];
+        until = std::max(until, later(merged.time, merged.duration));
+        scheduledInterruptions++;
+    }
+    transitions.update(teller, until);
+}
+
+// Utility method
+// Description: Free tellers, lowest number first, serve the customers at the head of the bank line.
+void InterruptibleBankSimulation::serveWaiting(int time) {
+    int teller = 0;
+    while (idleCount > 0 && !bankLine.empty()) {
+        while (down[teller] || customer[teller] != NO_CUSTOMER) {
+            teller++;
+        }
+        std::size_t next = bankLine.front();
+        bankLine.pop_front();
+        waitTime[next] += time - enqueuedAt[next];
+        cumulativeWaitTime += time - enqueuedAt[next];
+        serviceStart[next] = time;
+        customer[teller] = next;
+        departures.update(teller, time + remaining[next]);
+        idleCount--;
+    }
+}
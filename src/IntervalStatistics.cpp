@@ -0,0 +1,194 @@
+/*
+ * IntervalStatistics.cpp
+ *
+ * Description: This file implements the IntervalStatistics class, which accumulates per-interval
+ *              statistics while a simulation runs and writes one row per interval. Between two calls to
+ *              advanceTo the state of the simulation (bank line length, busy tellers, tellers on duty) is
+ *              constant, so the time integrals grow by state * elapsed time; starting a new interval
+ *              only resets the counters.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include "../include/IntervalStatistics.h"
+
+namespace {
+
+// Longest CSV row: ten numbers of at most 16 characters, the separators and the newline
+const std::size_t MAX_ROW_LENGTH = 192;
+
+// Header line of the CSV format, naming the columns in the order of Row
+const char CSV_HEADER[] = "start,end,arrivals,departures,served,mean_wait,max_wait,mean_queue,max_queue,utilization\n";
+
+// Returns the start of the interval of the given length containing time (rounding towards minus infinity)
+int intervalStartOf(int time, int intervalLength) {
+    int start = (time / intervalLength) * intervalLength;
+    return (start > time) ? start - intervalLength : start;
+}
+
+}  // namespace
+
+static_assert(sizeof(IntervalStatistics::Row) == 40, "The binary row layout must not contain padding");
+
+// Constructor
+// Description: Allocates the write buffer and, for CSV output, queues the header line.
+IntervalStatistics::IntervalStatistics(std::FILE* out, int intervalLength, Format format, std::size_t blockSize)
+    : out(out), format(format), intervalLength(intervalLength),
+      block(std::max(blockSize, 2 * MAX_ROW_LENGTH)), used(0), rowCount(0),
+      started(false), finished(false), intervalStart(0), lastTime(0),
+      queueLength(0), tellersBusy(0), tellersOnDuty(0),
+      arrivals(0), departures(0), served(0), waitSum(0), maxWait(0), maxQueue(0),
+      queueArea(0), busyArea(0), dutyArea(0) {
+    if (format == Format::CSV) {
+        std::copy(CSV_HEADER, CSV_HEADER + sizeof(CSV_HEADER) - 1, block.begin());
+        used = sizeof(CSV_HEADER) - 1;
+    }
+}
+
+// Destructor
+IntervalStatistics::~IntervalStatistics() {
+    finish();
+}
+
+// advanceTo
+// Description: Integrates the state up to time, closing (and writing) every interval that ends on the way.
+//              Times before the last time seen are ignored.
+// Time Efficiency: O(1) plus O(1) per interval closed
+void IntervalStatistics::advanceTo(int time) {
+    if (!started) {
+        started = true;
+        intervalStart = intervalStartOf(time, intervalLength);
+        lastTime = intervalStart;
+    }
+
+    while (time - intervalStart >= intervalLength) {
+        integrate(intervalStart + intervalLength);
+        closeInterval(intervalStart + intervalLength);
+        intervalStart += intervalLength;
+    }
+    integrate(time);
+}
+
+// recordArrival
+void IntervalStatistics::recordArrival() {
+    arrivals++;
+}
+
+// recordDeparture
+void IntervalStatistics::recordDeparture() {
+    departures++;
+}
+
+// recordServiceStart
+void IntervalStatistics::recordServiceStart(int wait) {
+    served++;
+    waitSum += wait;
+    maxWait = std::max(maxWait, wait);
+}
+
+// setState
+// Description: Stores the state that holds from the current time until the next call to advanceTo.
+void IntervalStatistics::setState(unsigned int queueLength, int tellersBusy, int tellersOnDuty) {
+    this->queueLength = queueLength;
+    this->tellersBusy = tellersBusy;
+    this->tellersOnDuty = tellersOnDuty;
+    maxQueue = std::max(maxQueue, queueLength);
+}
+
+// finish
+// Description: Writes the row of the current interval, cut at the last time seen, and flushes the output.
+void IntervalStatistics::finish() {
+    if (finished) {
+        return;
+    }
+    if (started) {
+        closeInterval(lastTime);
+    }
+    writeBlock();
+    std::fflush(out);
+    finished = true;
+}
+
+// getRowCount
+unsigned long long IntervalStatistics::getRowCount() const {
+    return rowCount;
+}
+
+// Utility method
+// Description: Adds the area under the state from lastTime to time to the integrals.
+// Time Efficiency: O(1)
+void IntervalStatistics::integrate(int time) {
+    if (time <= lastTime) {
+        return;
+    }
+    long long elapsed = static_cast<long long>(time) - lastTime;
+    queueArea += elapsed * queueLength;
+    busyArea += elapsed * tellersBusy;
+    dutyArea += elapsed * tellersOnDuty;
+    lastTime = time;
+}
+
+// Utility method
+// Description: Writes the row of the current interval, ending at end, and resets the accumulators. The
+//              bank line at the start of the next interval counts towards its maximum.
+// Time Efficiency: O(1)
+void IntervalStatistics::closeInterval(int end) {
+    Row row;
+    row.start = intervalStart;
+    row.end = end;
+    row.arrivals = arrivals;
+    row.departures = departures;
+    row.served = served;
+    row.maxWait = maxWait;
+    row.maxQueue = maxQueue;
+    row.meanWait = (served > 0) ? static_cast<float>(waitSum) / served : 0.0f;
+    row.meanQueue = (end > intervalStart) ? static_cast<float>(queueArea) / (end - intervalStart)
+                                          : static_cast<float>(queueLength);
+    row.utilization = (dutyArea > 0) ? static_cast<float>(busyArea) / dutyArea : 0.0f;
+    writeRow(row);
+
+    arrivals = 0;
+    departures = 0;
+    served = 0;
+    waitSum = 0;
+    maxWait = 0;
+    maxQueue = queueLength;
+    queueArea = 0;
+    busyArea = 0;
+    dutyArea = 0;
+}
+
+// Utility method
+// Description: Appends row to the write buffer in the output format, writing the buffer first if the row
+//              might not fit.
+void IntervalStatistics::writeRow(const Row& row) {
+    if (block.size() - used < MAX_ROW_LENGTH) {
+        writeBlock();
+    }
+
+    if (format == Format::BINARY) {
+        const char* bytes = reinterpret_cast<const char*>(&row);
+        std::copy(bytes, bytes + sizeof(Row), block.begin() + used);
+        used += sizeof(Row);
+    } else {
+        int length = std::snprintf(&block[used], block.size() - used, "%d,%d,%u,%u,%u,%g,%d,%g,%u,%g\n",
+                                   static_cast<int>(row.start), static_cast<int>(row.end),
+                                   static_cast<unsigned int>(row.arrivals), static_cast<unsigned int>(row.departures),
+                                   static_cast<unsigned int>(row.served), row.meanWait,
+                                   static_cast<int>(row.maxWait), row.meanQueue,
+                                   static_cast<unsigned int>(row.maxQueue), row.utilization);
+        used += static_cast<std::size_t>(length);
+    }
+    rowCount++;
+}
+
+// Utility method
+// Description: Writes the used part of the buffer to the output stream.
+void IntervalStatistics::writeBlock() {
+    if (used > 0) {
+        std::fwrite(block.data(), 1, used, out);
+        used = 0;
+    }
+}
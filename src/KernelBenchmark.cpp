@@ -0,0 +1,330 @@
+/*
+ * KernelBenchmark.cpp
+ *
+ * Description:
+ * This file implements the KernelBench tool, which measures what the policy-based SimulationKernel costs compared
+ * with the same event loop written by hand:
+ *
+ *     KernelBench [--customers=N] [--tellers=N] [--load=R] [--repetitions=N] [--seed=N]
+ *
+ * The tool generates one random day (exponential interarrival and transaction times, rounded to whole time units,
+ * with the tellers busy a fraction R of the time) and simulates it with:
+ * - Hand-written loops: the loop of the bank written out for int times with the dynamically sized containers
+ *   (PriorityQueue and Queue) and with the fixed-capacity ones, statistics kept in local variables.
+ * - The kernels with the same containers, int times and WaitStatistics, whose time per event is reported relative
+ *   to the hand-written loop.
+ * - Further kernels (loser tree, double and long long times, other statistics policies), for comparison.
+ *
+ * Each configuration is run --repetitions times, alternating with the others, and the fastest run is reported in
+ * nanoseconds per event. Every run must process the same events and give the same statistics as the hand-written
+ * loop; otherwise the tool reports the configuration and exits with status 1.
+ *
+ * The tool is built with optimization (see the makefile), since the question it answers is whether the compiler
+ * removes the abstraction.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <iostream>
+#include <iomanip> // For std::setw, used to align the results table
+#include <chrono> // For std::chrono::steady_clock, used to time the runs
+#include <cmath> // For std::llround, used to round the random times
+#include <cstdlib> // For std::strtol, std::strtoull and std::strtod, used to parse command-line options
+#include <cstring> // For std::strncmp, used to parse command-line options
+#include <limits> // For std::numeric_limits, the initial best time
+#include <memory> // For std::unique_ptr, which keeps the large fixed-capacity containers off the stack
+#include <random> // For std::mt19937_64, used to generate the day
+#include <type_traits> // For std::is_base_of, used to read the statistics a kernel keeps
+#include <vector>
+#include "../include/FullDataCollectionException.h" // Include the exception class for full fixed-capacity collections
+#include "../include/LoserTree.h" // Include the loser tree event set
+#include "../include/SimulationKernel.h" // Include the policy-based simulation kernel
+
+using std::cout;
+using std::cerr;
+using std::endl;
+using std::setw;
+
+// Capacities of the fixed-capacity containers: pending departures (one per teller) and waiting customers
+const unsigned int FIXED_EVENT_CAPACITY = 64;
+const unsigned int FIXED_LINE_CAPACITY = 1u << 16;
+
+// Mean interarrival time of the generated day
+const double MEAN_INTERARRIVAL_TIME = 10;
+
+// Structure: BenchmarkOptions
+// Purpose: Holds the command-line options of the tool.
+struct BenchmarkOptions {
+    int customers = 1000000;       // --customers=N customers of the day
+    int tellers = 4;               // --tellers=N tellers on duty
+    double load = 0.9;             // --load=R fraction of the time the tellers are busy
+    int repetitions = 5;           // --repetitions=N runs of every configuration
+    unsigned long long seed = 1;   // --seed=N seeds the day
+};
+
+// Structure: RunResult
+// Purpose: What a run computed, which must be the same for every configuration.
+struct RunResult {
+    unsigned long long events = 0;  // Events processed
+    int customers = 0;              // Customers who arrived (0 if the statistics policy keeps none)
+    long long totalWait = 0;        // Sum of the waits (0 if the statistics policy keeps none)
+};
+
+// Structure: Measurement
+// Purpose: The result and the best time of one configuration.
+struct Measurement {
+    const char* name;                                           // Description of the configuration
+    int baseline;                                               // Index of the hand-written loop it is compared with, or -1
+    bool keepsStatistics;                                       // Whether result.customers and result.totalWait are kept
+    RunResult result;                                           // What the last run computed
+    double bestSeconds = std::numeric_limits<double>::max();    // Time of the fastest run
+};
+
+// Function: printUsage
+// Purpose: Prints the supported command-line options to standard error.
+void printUsage(const char* program) {
+    cerr << "Usage: " << program << " [options]" << endl
+         << "  --customers=N             Customers of the generated day (default 1000000)" << endl
+         << "  --tellers=N               Tellers on duty (default 4, at most " << FIXED_EVENT_CAPACITY - 1 << ")" << endl
+         << "  --load=R                  Fraction of the time the tellers are busy, below 1 (default 0.9)" << endl
+         << "  --repetitions=N           Runs of every configuration; the fastest is reported (default 5)" << endl
+         << "  --seed=N                  Seed of the generated day (default 1)" << endl;
+}
+
+// Function: parseArguments
+// Purpose: Fills options from the command-line arguments.
+// Returns: false if an argument is unknown or out of range.
+bool parseArguments(int argc, char* argv[], BenchmarkOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        char* end = nullptr;
+        if (std::strncmp(arg, "--customers=", 12) == 0) {
+            options.customers = static_cast<int>(std::strtol(arg + 12, &end, 10));
+        } else if (std::strncmp(arg, "--tellers=", 10) == 0) {
+            options.tellers = static_cast<int>(std::strtol(arg + 10, &end, 10));
+        } else if (std::strncmp(arg, "--load=", 7) == 0) {
+            options.load = std::strtod(arg + 7, &end);
+        } else if (std::strncmp(arg, "--repetitions=", 14) == 0) {
+            options.repetitions = static_cast<int>(std::strtol(arg + 14, &end, 10));
+        } else if (std::strncmp(arg, "--seed=", 7) == 0) {
+            options.seed = std::strtoull(arg + 7, &end, 10);
+        } else {
+            return false;
+        }
+        if (*end != '\0') {
+            return false;
+        }
+    }
+    return options.customers >= 1 && options.tellers >= 1 &&
+           options.tellers < static_cast<int>(FIXED_EVENT_CAPACITY) && options.load > 0 && options.load < 1 &&
+           options.repetitions >= 1;
+}
+
+// Function: generateDay
+// Purpose: Returns the arrivals of a random day, sorted by time: exponential interarrival times and transaction
+//          lengths, rounded to whole time units (transactions take at least one).
+std::vector<KernelEvent<int>> generateDay(const BenchmarkOptions& options) {
+    std::mt19937_64 generator(options.seed);
+    std::exponential_distribution<double> interarrival(1.0 / MEAN_INTERARRIVAL_TIME);
+    std::exponential_distribution<double> service(1.0 / (MEAN_INTERARRIVAL_TIME * options.tellers * options.load));
+
+    std::vector<KernelEvent<int>> arrivals;
+    arrivals.reserve(static_cast<std::size_t>(options.customers));
+    double time = 0;
+    for (int customer = 0; customer < options.customers; customer++) {
+        time += interarrival(generator);
+        long long length = std::llround(service(generator));
+        arrivals.push_back(KernelEvent<int>{static_cast<int>(std::llround(time)), static_cast<int>(length < 1 ? 1 : length)});
+    }
+    return arrivals;
+}
+
+// Function: convertDay
+// Purpose: Returns the arrivals with times of another type.
+template <typename Time>
+std::vector<KernelEvent<Time>> convertDay(const std::vector<KernelEvent<int>>& arrivals) {
+    std::vector<KernelEvent<Time>> converted;
+    converted.reserve(arrivals.size());
+    for (const KernelEvent<int>& arrival : arrivals) {
+        converted.push_back(KernelEvent<Time>{static_cast<Time>(arrival.time), static_cast<Time>(arrival.length)});
+    }
+    return converted;
+}
+
+// Function: runHandWritten
+// Purpose: The bank's event loop written out for int times, without policies: arrivals are read in time order,
+//          departures kept in the given (empty) containers, and the statistics in local variables.
+template <typename Departures, typename BankLine>
+RunResult runHandWritten(const std::vector<KernelEvent<int>>& arrivals, int tellers, Departures& departures,
+                         BankLine& bankLine) {
+    RunResult result;
+    std::size_t nextArrival = 0;
+    unsigned int lineLength = 0;
+    int tellersBusy = 0;
+    int now = 0;
+
+    while (true) {
+        if (nextArrival < arrivals.size() &&
+            (departures.isEmpty() || arrivals[nextArrival].time <= departures.peek().time)) {
+            // Arrival: serve the customer at once if a teller is free, otherwise join the line
+            const KernelEvent<int>& arrival = arrivals[nextArrival++];
+            now = arrival.time;
+            result.customers++;
+            if (lineLength == 0 && tellersBusy < tellers) {
+                if (!departures.enqueue(KernelEvent<int>{now + arrival.length, 0})) {
+                    throw FullDataCollectionException("event set is full");
+                }
+                tellersBusy++;
+            } else {
+                KernelEvent<int> customer = arrival;
+                if (!bankLine.enqueue(customer)) {
+                    throw FullDataCollectionException("bank line is full");
+                }
+                lineLength++;
+            }
+        } else if (!departures.isEmpty()) {
+            // Departure: the freed teller serves the next customer in line
+            now = departures.peek().time;
+            departures.dequeue();
+            tellersBusy--;
+            if (lineLength > 0) {
+                KernelEvent<int> customer = bankLine.peek();
+                bankLine.dequeue();
+                lineLength--;
+                result.totalWait += now - customer.time;
+                if (!departures.enqueue(KernelEvent<int>{now + customer.length, 0})) {
+                    throw FullDataCollectionException("event set is full");
+                }
+                tellersBusy++;
+            }
+        } else {
+            break;
+        }
+        result.events++;
+    }
+    return result;
+}
+
+// Function: runKernel
+// Purpose: Simulates arrivals with the Kernel and returns what it computed. The kernel is allocated on the heap,
+//          since fixed-capacity kernels hold their containers.
+template <typename Kernel, typename Time>
+RunResult runKernel(const std::vector<KernelEvent<Time>>& arrivals, int tellers) {
+    std::unique_ptr<Kernel> kernel(new Kernel(arrivals, tellers));
+    kernel->run();
+    RunResult result;
+    result.events = kernel->getEventsProcessed();
+    if constexpr (std::is_base_of<WaitStatistics<Time>, typename std::decay<decltype(kernel->getStatistics())>::type>::value) {
+        result.customers = kernel->getStatistics().getCustomerCount();
+        result.totalWait = static_cast<long long>(kernel->getStatistics().getCumulativeWaitTime());
+    }
+    return result;
+}
+
+// Function: measure
+// Purpose: Runs one configuration once and keeps its result and its best time.
+template <typename Run>
+void measure(Measurement& measurement, Run run) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    measurement.result = run();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (seconds < measurement.bestSeconds) {
+        measurement.bestSeconds = seconds;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    BenchmarkOptions options;
+    if (!parseArguments(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    const std::vector<KernelEvent<int>> arrivals = generateDay(options);
+    const std::vector<KernelEvent<long long>> longArrivals = convertDay<long long>(arrivals);
+    const std::vector<KernelEvent<double>> doubleArrivals = convertDay<double>(arrivals);
+    const int tellers = options.tellers;
+
+    typedef FixedCapacity<FIXED_EVENT_CAPACITY> FixedEvents;
+    typedef FixedCapacity<FIXED_LINE_CAPACITY> FixedLine;
+
+    // The configurations, in the order of the table; kernels are compared with the hand-written loop on the same
+    // containers
+    std::vector<Measurement> measurements = {
+        {"hand-written: heap, list, int", -1, true},
+        {"kernel: heap, list, int, wait", 0, true},
+        {"hand-written: fixed, int", -1, true},
+        {"kernel: fixed, int, wait", 2, true},
+        {"kernel: loser tree, list, int, wait", -1, true},
+        {"kernel: heap, list, long long, extremes", -1, true},
+        {"kernel: heap, list, double, wait", -1, true},
+        {"kernel: heap, list, int, none", -1, false},
+    };
+
+    try {
+        for (int repetition = 0; repetition < options.repetitions; repetition++) {
+            measure(measurements[0], [&]() {
+                PriorityQueue<KernelEvent<int>> departures(static_cast<unsigned int>(tellers + 1));
+                Queue<KernelEvent<int>> bankLine;
+                return runHandWritten(arrivals, tellers, departures, bankLine);
+            });
+            measure(measurements[1], [&]() {
+                return runKernel<SimulationKernel<PriorityQueue, Queue, int, WaitStatistics>>(arrivals, tellers);
+            });
+            measure(measurements[2], [&]() {
+                std::unique_ptr<FixedEvents::PriorityQueue<KernelEvent<int>>> departures(
+                    new FixedEvents::PriorityQueue<KernelEvent<int>>());
+                std::unique_ptr<FixedLine::Queue<KernelEvent<int>>> bankLine(new FixedLine::Queue<KernelEvent<int>>());
+                return runHandWritten(arrivals, tellers, *departures, *bankLine);
+            });
+            measure(measurements[3], [&]() {
+                return runKernel<SimulationKernel<FixedEvents::PriorityQueue, FixedLine::Queue, int, WaitStatistics>>(
+                    arrivals, tellers);
+            });
+            measure(measurements[4], [&]() {
+                return runKernel<SimulationKernel<LoserTree, Queue, int, WaitStatistics>>(arrivals, tellers);
+            });
+            measure(measurements[5], [&]() {
+                return runKernel<SimulationKernel<PriorityQueue, Queue, long long, WaitExtremeStatistics>>(
+                    longArrivals, tellers);
+            });
+            measure(measurements[6], [&]() {
+                return runKernel<SimulationKernel<PriorityQueue, Queue, double, WaitStatistics>>(doubleArrivals, tellers);
+            });
+            measure(measurements[7], [&]() {
+                return runKernel<SimulationKernel<PriorityQueue, Queue, int, NoStatistics>>(arrivals, tellers);
+            });
+        }
+    } catch (const FullDataCollectionException& exception) {
+        cerr << exception.what() << " (the line holds at most " << FIXED_LINE_CAPACITY
+             << " customers; try a lower --load)" << endl;
+        return 1;
+    }
+
+    cout << "Kernel Benchmark: " << options.customers << " customers, " << tellers << " tellers, load "
+         << options.load << ", fastest of " << options.repetitions << " runs" << endl << endl;
+    cout << "    " << std::left << setw(42) << "Configuration" << std::right << setw(12) << "ns/event" << setw(18)
+         << "vs hand-written" << endl;
+
+    const RunResult& reference = measurements[0].result;
+    bool agree = true;
+    for (const Measurement& measurement : measurements) {
+        double nanoseconds = measurement.bestSeconds * 1e9 / static_cast<double>(measurement.result.events);
+        cout << "    " << std::left << setw(42) << measurement.name << std::right << std::fixed << std::setprecision(2)
+             << setw(12) << nanoseconds;
+        if (measurement.baseline >= 0) {
+            cout << setw(17) << measurement.bestSeconds / measurements[measurement.baseline].bestSeconds << "x";
+        }
+        cout << endl;
+
+        if (measurement.result.events != reference.events ||
+            (measurement.keepsStatistics && (measurement.result.customers != reference.customers ||
+                                             measurement.result.totalWait != reference.totalWait))) {
+            cerr << measurement.name << " disagrees with the hand-written loop" << endl;
+            agree = false;
+        }
+    }
+    cout << endl << "    Events per run: " << reference.events << ", total wait: " << reference.totalWait << endl;
+    return agree ? 0 : 1;
+}
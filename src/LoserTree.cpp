@@ -0,0 +1,210 @@
+/*
+ * LoserTree.cpp
+ *
+ * Description: This file implements the LoserTree class, an event set that merges single-element sources
+ *              with a tournament tree. Internal node n has the children 2n and 2n + 1; node indices of
+ *              leafCount and above denote the leaves (slot = index - leafCount).
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include "../include/LoserTree.h"
+
+// Constructor
+// Description: Creates a tree with at least capacity slots, all free.
+template <typename ElementType>
+LoserTree<ElementType>::LoserTree(unsigned int capacity)
+    : leafCount(2), elementCount(0), pendingSlot(NO_SLOT) {
+    while (leafCount < capacity) {
+        leafCount *= 2;
+    }
+    elements.resize(leafCount);
+    occupied.assign(leafCount, 0);
+    winners.resize(leafCount);
+    losers.resize(leafCount);
+    for (unsigned int slot = leafCount; slot > 0; slot--) {
+        freeSlots.push_back(slot - 1);
+    }
+    for (unsigned int node = leafCount - 1; node > 0; node--) {
+        playMatch(node);
+    }
+}
+
+// isEmpty
+template <typename ElementType>
+bool LoserTree<ElementType>::isEmpty() const {
+    return elementCount == 0;
+}
+
+// getElementCount
+template <typename ElementType>
+unsigned int LoserTree<ElementType>::getElementCount() const {
+    return elementCount;
+}
+
+// enqueue
+// Description: Refilling the slot vacated by the last dequeue replays the winner's path against the stored
+//              losers; any other free slot replays its path against the sibling winners.
+template <typename ElementType>
+bool LoserTree<ElementType>::enqueue(const ElementType& newElement) {
+    if (pendingSlot != NO_SLOT) {
+        unsigned int slot = pendingSlot;
+        pendingSlot = NO_SLOT;
+        elements[slot] = newElement;
+        occupied[slot] = 1;
+        elementCount++;
+        replayWinner(slot);
+        return true;
+    }
+
+    if (freeSlots.empty()) {
+        grow();
+    }
+    unsigned int slot = freeSlots.back();
+    freeSlots.pop_back();
+    elements[slot] = newElement;
+    occupied[slot] = 1;
+    elementCount++;
+    replayPath(slot);
+    return true;
+}
+
+// dequeue
+// Description: Empties the winner's slot and reserves it for the next enqueue.
+template <typename ElementType>
+void LoserTree<ElementType>::dequeue() {
+    if (isEmpty()) {
+        throw EmptyDataCollectionException();
+    }
+    settle();
+    unsigned int slot = winners[1];
+    occupied[slot] = 0;
+    elementCount--;
+    pendingSlot = slot;
+}
+
+// dequeueGroup
+// Description: Removes winners while they are equal to the first one.
+template <typename ElementType>
+void LoserTree<ElementType>::dequeueGroup(std::vector<ElementType>& group) {
+    if (isEmpty()) {
+        throw EmptyDataCollectionException();
+    }
+    settle();
+    const ElementType first = elements[winners[1]];
+    while (elementCount > 0) {
+        settle();
+        if (first < elements[winners[1]]) {
+            break;
+        }
+        group.push_back(elements[winners[1]]);
+        dequeue();
+    }
+}
+
+// peek
+template <typename ElementType>
+const ElementType& LoserTree<ElementType>::peek() const {
+    if (isEmpty()) {
+        throw EmptyDataCollectionException();
+    }
+    settle();
+    return elements[winners[1]];
+}
+
+// Utility method
+// Description: Returns true if slot wins the match against other: an occupied slot beats an empty one,
+//              a smaller element beats a larger one, and equal elements are ordered by slot.
+template <typename ElementType>
+bool LoserTree<ElementType>::beats(unsigned int slot, unsigned int other) const {
+    if (!occupied[slot] || !occupied[other]) {
+        return occupied[slot] && !occupied[other];
+    }
+    if (elements[slot] < elements[other]) {
+        return true;
+    }
+    return !(elements[other] < elements[slot]) && slot < other;
+}
+
+// Utility method
+// Description: Returns the winning slot of the subtree rooted at node (a leaf is its own winner).
+template <typename ElementType>
+unsigned int LoserTree<ElementType>::winnerOf(unsigned int node) const {
+    return (node >= leafCount) ? node - leafCount : winners[node];
+}
+
+// Utility method
+// Description: Replays the matches on the path of slot, the previous overall winner, against the losers
+//              stored on that path. At each node the stored loser is the winner of the other subtree.
+// Time Efficiency: O(log2 c), one comparison per level
+template <typename ElementType>
+void LoserTree<ElementType>::replayWinner(unsigned int slot) const {
+    unsigned int candidate = slot;
+    for (unsigned int node = (leafCount + slot) / 2; node > 0; node /= 2) {
+        if (beats(losers[node], candidate)) {
+            unsigned int loser = candidate;
+            candidate = losers[node];
+            losers[node] = loser;
+        }
+        winners[node] = candidate;
+    }
+}
+
+// Utility method
+// Description: Replays the matches on the path of slot (any slot) against the winners of the sibling subtrees.
+// Time Efficiency: O(log2 c), one comparison per level
+template <typename ElementType>
+void LoserTree<ElementType>::replayPath(unsigned int slot) const {
+    for (unsigned int node = (leafCount + slot) / 2; node > 0; node /= 2) {
+        playMatch(node);
+    }
+}
+
+// Utility method
+// Description: Plays the match at internal node between the winners of its two subtrees.
+template <typename ElementType>
+void LoserTree<ElementType>::playMatch(unsigned int node) const {
+    unsigned int left = winnerOf(2 * node);
+    unsigned int right = winnerOf(2 * node + 1);
+    if (beats(right, left)) {
+        winners[node] = right;
+        losers[node] = left;
+    } else {
+        winners[node] = left;
+        losers[node] = right;
+    }
+}
+
+// Utility method
+// Description: Completes a dequeue that was not followed by an enqueue: the vacated slot loses its matches
+//              and becomes a free slot.
+template <typename ElementType>
+void LoserTree<ElementType>::settle() const {
+    if (pendingSlot != NO_SLOT) {
+        unsigned int slot = pendingSlot;
+        pendingSlot = NO_SLOT;
+        replayWinner(slot);
+        freeSlots.push_back(slot);
+    }
+}
+
+// Utility method
+// Description: Doubles the number of slots and replays every match.
+// Time Efficiency: O(c)
+template <typename ElementType>
+void LoserTree<ElementType>::grow() {
+    settle();
+    unsigned int oldLeafCount = leafCount;
+    leafCount *= 2;
+    elements.resize(leafCount);
+    occupied.resize(leafCount, 0);
+    winners.resize(leafCount);
+    losers.resize(leafCount);
+    for (unsigned int slot = leafCount; slot > oldLeafCount; slot--) {
+        freeSlots.push_back(slot - 1);
+    }
+    for (unsigned int node = leafCount - 1; node > 0; node--) {
+        playMatch(node);
+    }
+}
@@ -0,0 +1,154 @@
+/*
+ * NumaTopology.cpp
+ *
+ * Description: This file implements the NUMA helpers declared in NumaTopology.h using the Linux sysfs node
+ *              directory, pthread CPU affinity and madvise(MADV_HUGEPAGE). No NUMA library is needed.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "../include/NumaTopology.h"
+
+#ifdef __linux__
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Parses a Linux CPU list such as "0-3,8-11" into individual CPU numbers
+std::vector<int> parseCpuList(const std::string& text) {
+    std::vector<int> cpus;
+    std::stringstream ranges(text);
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        std::size_t dash = range.find('-');
+        int first = std::atoi(range.c_str());
+        int last = (dash == std::string::npos) ? first : std::atoi(range.c_str() + dash + 1);
+        for (int cpu = first; cpu <= last; cpu++) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+// Returns the CPUs the process may run on
+std::vector<int> allowedCpus() {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    if (cpus.empty()) {
+        unsigned int count = std::thread::hardware_concurrency();
+        for (unsigned int cpu = 0; cpu < std::max(count, 1u); cpu++) {
+            cpus.push_back(static_cast<int>(cpu));
+        }
+    }
+    return cpus;
+}
+
+}  // namespace
+
+// Function: discoverNumaNodes
+// Description: Reads /sys/devices/system/node/node<N>/cpulist for every node and keeps the allowed CPUs.
+//              Falls back to a single node 0 holding every allowed CPU.
+std::vector<NumaNode> discoverNumaNodes() {
+    std::vector<int> allowed = allowedCpus();
+    std::vector<NumaNode> nodes;
+
+#ifdef __linux__
+    const char* nodeDirectory = "/sys/devices/system/node";
+    DIR* directory = opendir(nodeDirectory);
+    if (directory != nullptr) {
+        while (dirent* entry = readdir(directory)) {
+            std::string name = entry->d_name;
+            if (name.compare(0, 4, "node") != 0 || name.size() == 4 ||
+                name.find_first_not_of("0123456789", 4) != std::string::npos) {
+                continue;
+            }
+            std::ifstream cpulist(std::string(nodeDirectory) + "/" + name + "/cpulist");
+            std::string text;
+            std::getline(cpulist, text);
+
+            NumaNode node;
+            node.id = std::atoi(name.c_str() + 4);
+            for (int cpu : parseCpuList(text)) {
+                if (std::find(allowed.begin(), allowed.end(), cpu) != allowed.end()) {
+                    node.cpus.push_back(cpu);
+                }
+            }
+            if (!node.cpus.empty()) {
+                nodes.push_back(node);
+            }
+        }
+        closedir(directory);
+    }
+#endif
+
+    if (nodes.empty()) {
+        NumaNode node;
+        node.id = 0;
+        node.cpus = allowed;
+        nodes.push_back(node);
+    }
+
+    std::sort(nodes.begin(), nodes.end(), [](const NumaNode& lhs, const NumaNode& rhs) { return lhs.id < rhs.id; });
+    return nodes;
+}
+
+// Function: pinCurrentThread
+// Description: Sets the CPU affinity of the calling thread to the single CPU cpu.
+bool pinCurrentThread(int cpu) {
+#ifdef __linux__
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void) cpu;
+    return false;
+#endif
+}
+
+// Function: adviseHugePages
+// Description: Rounds the range inwards to whole pages and applies MADV_HUGEPAGE to it.
+void adviseHugePages(void* address, std::size_t bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    const std::uintptr_t pageSize = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(address);
+    std::uintptr_t end = begin + bytes;
+    begin = (begin + pageSize - 1) & ~(pageSize - 1);
+    end &= ~(pageSize - 1);
+    if (end > begin) {
+        madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+    }
+#else
+    (void) address;
+    (void) bytes;
+#endif
+}
@@ -42,6 +42,13 @@ PriorityQueue<ElementType>::PriorityQueue() : minheap(2) {
     // No additional initialization needed
 }
 
+// Constructor with initial capacity
+// Initializes the Priority Queue with room for capacity elements (at least 2)
+template <typename ElementType>
+PriorityQueue<ElementType>::PriorityQueue(unsigned int capacity) : minheap(capacity < 2 ? 2 : capacity) {
+    // No additional initialization needed
+}
+
 // Destructor
 template <typename ElementType>
 PriorityQueue<ElementType>::~PriorityQueue() {
@@ -77,6 +84,18 @@ void PriorityQueue<ElementType>::dequeue() {
     minheap.remove();
 }
 
+// Description: Removes all elements equal to the front element and appends them to group.
+// Precondition: This Priority Queue is not empty.
+// Exception: Throws EmptyDataCollectionException if Priority Queue is empty.
+// Time Efficiency: O(k log2 n) for k removed elements
+template <typename ElementType>
+void PriorityQueue<ElementType>::dequeueGroup(std::vector<ElementType>& group) {
+    if (isEmpty()) {
+        throw EmptyDataCollectionException();
+    }
+    minheap.removeMinimumGroup(group);
+}
+
 // Description: Returns (but does not remove) the element with the next 
 //              "highest" priority value from the Priority Queue.
 // Precondition: This Priority Queue is not empty.
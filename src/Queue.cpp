@@ -36,6 +36,32 @@ Queue<ElementType>::Queue() : size(0), head(nullptr), tail(nullptr) {
     // Constructor body is empty because initialization is done using initializer list
 }
 
+// Copy constructor
+// Description: Creates a copy of rhs by enqueuing each of its elements from front to back.
+// Time Efficiency: O(n)
+template<typename ElementType>
+Queue<ElementType>::Queue(const Queue& rhs) : size(0), head(nullptr), tail(nullptr) {
+    for (Node* current = rhs.head; current != nullptr; current = current->next) {
+        enqueue(current->data);
+    }
+}
+
+// Copy assignment operator
+// Description: Frees the nodes of this Queue, then copies the elements of rhs from front to back.
+// Time Efficiency: O(n)
+template<typename ElementType>
+Queue<ElementType>& Queue<ElementType>::operator=(const Queue& rhs) {
+    if (this != &rhs) {
+        while (!isEmpty()) {
+            dequeue();
+        }
+        for (Node* current = rhs.head; current != nullptr; current = current->next) {
+            enqueue(current->data);
+        }
+    }
+    return *this;
+}
+
 // Destructor
 // Description: Frees memory associated with the nodes in the linked list.
 template<typename ElementType>
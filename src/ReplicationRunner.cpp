@@ -0,0 +1,159 @@
+/*
+ * ReplicationRunner.cpp
+ *
+ * Description: This file implements the ReplicationRunner class. Worker threads take replication numbers
+ *              from a shared atomic counter until all replications are done; each replication builds and
+ *              runs its own BankSimulation. A worker keeps its results in its own local variables and stores
+ *              them into its slot of the shared results once, when it is done; the slots are merged per NUMA
+ *              node after the workers have been joined. Slots of neighbouring workers may share a cache line,
+ *              but no worker writes to the shared results while the others are running replications.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "../include/BinaryHeap.h"
+#include "../include/NumaTopology.h"
+#include "../include/ReplicationRunner.h"
+
+namespace {
+
+// Size of a transparent huge page (x86-64 and most AArch64 kernels). Heap arrays of at least this size are
+// aligned to it and backed by huge pages when requested; a huge page can only back an aligned 2 MiB range.
+const std::size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+// Structure: WorkerResult
+// Purpose: What one worker thread did, written only by that worker and only once, at its end.
+struct WorkerResult {
+    unsigned int nodeIndex = 0;
+    unsigned int replications = 0;
+    unsigned long long events = 0;
+    double busySeconds = 0;
+    bool haveStatistics = false;
+    int customerCount = 0;
+    long long cumulativeWaitTime = 0;
+    float averageWaitTime = 0;
+    bool consistent = true;
+};
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+// Constructor
+ReplicationRunner::ReplicationRunner(const std::vector<Event>& arrivals, int tellers,
+                                     const std::vector<StaffingChange>& staffing)
+    : arrivals(arrivals), tellers(tellers), staffing(staffing) {}
+
+// run
+// Description: Starts the worker threads, waits for them and merges their results per NUMA node.
+ReplicationRunner::Report ReplicationRunner::run(const Options& options) const {
+    std::vector<NumaNode> nodes;
+    if (options.numaAware) {
+        nodes = discoverNumaNodes();
+    } else {
+        nodes.push_back(NumaNode());
+        nodes.back().id = 0;
+    }
+
+    if (options.hugePages) {
+        BinaryHeap<Event>::setLargeArrayAdvice(adviseHugePages, HUGE_PAGE_SIZE, HUGE_PAGE_SIZE);
+    }
+
+    unsigned int threadCount = options.threads == 0 ? 1 : options.threads;
+    std::atomic<unsigned int> nextReplication(0);
+    std::vector<WorkerResult> results(threadCount);
+    std::vector<std::thread> workers;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (unsigned int worker = 0; worker < threadCount; worker++) {
+        workers.push_back(std::thread([&, worker]() {
+            WorkerResult result;
+            result.nodeIndex = worker % nodes.size();
+
+            // Pin first, then copy the input: the copy's pages are first touched on the local node
+            std::vector<Event> localArrivals;
+            std::vector<StaffingChange> localStaffing;
+            const std::vector<Event>* input = &arrivals;
+            const std::vector<StaffingChange>* schedule = &staffing;
+            if (options.numaAware) {
+                const std::vector<int>& cpus = nodes[result.nodeIndex].cpus;
+                pinCurrentThread(cpus[(worker / nodes.size()) % cpus.size()]);
+                localArrivals = arrivals;
+                localStaffing = staffing;
+                input = &localArrivals;
+                schedule = &localStaffing;
+            }
+
+            std::chrono::steady_clock::time_point busyStart = std::chrono::steady_clock::now();
+            while (nextReplication.fetch_add(1) < options.replications) {
+                BankSimulation simulation(*input, tellers, options.arrivalMode);
+                simulation.setStaffingSchedule(schedule);
+                simulation.run();
+
+                result.replications++;
+                result.events += simulation.getEventsProcessed();
+                if (!result.haveStatistics) {
+                    result.haveStatistics = true;
+                    result.customerCount = simulation.getCustomerCount();
+                    result.cumulativeWaitTime = simulation.getCumulativeWaitTime();
+                    result.averageWaitTime = simulation.getAverageWaitTime();
+                } else if (result.customerCount != simulation.getCustomerCount() ||
+                           result.cumulativeWaitTime != simulation.getCumulativeWaitTime()) {
+                    result.consistent = false;
+                }
+            }
+            result.busySeconds = secondsSince(busyStart);
+            results[worker] = result;
+        }));
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    Report report;
+    report.wallSeconds = secondsSince(start);
+    report.events = 0;
+    report.customerCount = 0;
+    report.averageWaitTime = 0;
+    report.consistent = true;
+
+    if (options.hugePages) {
+        BinaryHeap<Event>::setLargeArrayAdvice(nullptr, 0, 1);
+    }
+
+    for (const NumaNode& node : nodes) {
+        NodeReport nodeReport = { node.id, 0, 0, 0, 0.0 };
+        report.nodes.push_back(nodeReport);
+    }
+
+    const WorkerResult* reference = nullptr;
+    for (const WorkerResult& result : results) {
+        NodeReport& nodeReport = report.nodes[result.nodeIndex];
+        nodeReport.threads++;
+        nodeReport.replications += result.replications;
+        nodeReport.events += result.events;
+        nodeReport.busySeconds += result.busySeconds;
+        report.events += result.events;
+
+        if (!result.haveStatistics) {
+            continue;
+        }
+        if (reference == nullptr) {
+            reference = &result;
+            report.customerCount = result.customerCount;
+            report.averageWaitTime = result.averageWaitTime;
+        }
+        if (!result.consistent || result.customerCount != reference->customerCount ||
+            result.cumulativeWaitTime != reference->cumulativeWaitTime) {
+            report.consistent = false;
+        }
+    }
+
+    return report;
+}
@@ -0,0 +1,302 @@
+/*
+ * ResultCache.cpp
+ *
+ * Description: This file implements the key hashing, the entry files and the eviction of the result cache,
+ *              and the OutputRecorder stream buffer. Files are handled with POSIX calls: rename() for the
+ *              atomic replacement of entries and utime() to mark them as recently used.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <vector>
+#include "../include/ResultCache.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+
+namespace {
+
+// First bytes of every entry file, with the version of the entry format
+const char ENTRY_MAGIC[8] = {'B', 'S', 'C', 'A', 'C', 'H', 'E', '1'};
+
+// Suffix of entry files; temporary files have ".part" and a unique suffix instead
+const char* const ENTRY_SUFFIX = ".entry";
+const char* const PART_SUFFIX = ".part.";
+
+// Seconds after which a temporary file is taken for the leftover of a process that died while writing
+const std::time_t STALE_PART_SECONDS = 3600;
+
+// Structure: EntryHeader
+// Purpose: The fixed-size start of an entry file; the output and the errors follow.
+struct EntryHeader {
+    char magic[8];
+    std::uint64_t high;
+    std::uint64_t low;
+    std::uint64_t outputLength;
+    std::uint64_t errorLength;
+    std::uint64_t checksum;             // Of the output and the errors
+};
+
+// Description: The SplitMix64 finalizer, a bijective mix of all bits of x.
+std::uint64_t mix(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Description: Returns true if text ends with suffix.
+bool endsWith(const std::string& text, const char* suffix) {
+    std::size_t length = std::strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+std::uint64_t checksumOf(const ResultCache::Entry& entry) {
+    ResultCache::KeyBuilder builder;
+    builder.add(entry.output);
+    builder.add(entry.errors);
+    return builder.finish().low;
+}
+
+}
+
+// KeyBuilder constructor
+ResultCache::KeyBuilder::KeyBuilder() : high(0x6A09E667F3BCC908ULL), low(0xBB67AE8584CAA73BULL) {}
+
+// add
+// Description: Hashes the length, then the bytes as little-endian 8-byte words, the last one padded with
+//              zeros. The halves chain the words through different combinations so that they stay independent.
+void ResultCache::KeyBuilder::add(const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    std::uint64_t word = size;
+    std::size_t offset = 0;
+    while (true) {
+        high = mix(high ^ word);
+        low = mix(((low << 29) | (low >> 35)) + word);
+        if (offset >= size) {
+            break;
+        }
+        word = 0;
+        std::memcpy(&word, bytes + offset, std::min<std::size_t>(8, size - offset));
+        offset += 8;
+    }
+}
+
+void ResultCache::KeyBuilder::add(const std::string& text) {
+    add(text.data(), text.size());
+}
+
+// addFile
+bool ResultCache::KeyBuilder::addFile(const char* path) {
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr) {
+        add("<unreadable>");
+        return false;
+    }
+    std::string contents;
+    char block[65536];
+    std::size_t read;
+    while ((read = std::fread(block, 1, sizeof(block), file)) > 0) {
+        contents.append(block, read);
+    }
+    bool failed = std::ferror(file) != 0;
+    std::fclose(file);
+    add(failed ? std::string("<unreadable>") : contents);
+    return !failed;
+}
+
+// finish
+ResultCache::Key ResultCache::KeyBuilder::finish() const {
+    return Key{mix(high ^ low), mix(low + 0x3C6EF372FE94F82BULL)};
+}
+
+// Constructor
+ResultCache::ResultCache(const std::string& directory, std::uint64_t capacity)
+    : directory(directory), capacity(capacity) {
+    mkdir(directory.c_str(), 0777);
+}
+
+// lookup
+// Description: A file that is not a whole entry of key is deleted, so that the next run stores a good one.
+bool ResultCache::lookup(const Key& key, Entry& entry) const {
+    std::string path = pathOf(key);
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    EntryHeader header;
+    bool valid = std::fread(&header, sizeof(header), 1, file) == 1 &&
+                 std::memcmp(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC)) == 0 && header.high == key.high &&
+                 header.low == key.low && header.outputLength <= capacity && header.errorLength <= capacity;
+    if (valid) {
+        entry.output.resize(header.outputLength);
+        entry.errors.resize(header.errorLength);
+        valid = std::fread(&entry.output[0], 1, entry.output.size(), file) == entry.output.size() &&
+                std::fread(&entry.errors[0], 1, entry.errors.size(), file) == entry.errors.size() &&
+                std::fgetc(file) == EOF && checksumOf(entry) == header.checksum;
+    }
+    std::fclose(file);
+    if (!valid) {
+        unlink(path.c_str());
+        return false;
+    }
+    utime(path.c_str(), nullptr);
+    return true;
+}
+
+// store
+// Description: Writes the entry to a temporary file named uniquely after the process, then renames it over
+//              the entry file.
+bool ResultCache::store(const Key& key, const Entry& entry) const {
+    if (entry.output.size() > capacity || entry.errors.size() > capacity ||
+        sizeof(EntryHeader) + entry.output.size() + entry.errors.size() > capacity) {
+        return true;
+    }
+    static unsigned int stores = 0;
+    std::string path = pathOf(key);
+    std::string part = path.substr(0, path.size() - std::strlen(ENTRY_SUFFIX)) + PART_SUFFIX +
+                       std::to_string(getpid()) + "." + std::to_string(stores++);
+
+    EntryHeader header;
+    std::memcpy(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC));
+    header.high = key.high;
+    header.low = key.low;
+    header.outputLength = entry.output.size();
+    header.errorLength = entry.errors.size();
+    header.checksum = checksumOf(entry);
+
+    std::FILE* file = std::fopen(part.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool written = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   std::fwrite(entry.output.data(), 1, entry.output.size(), file) == entry.output.size() &&
+                   std::fwrite(entry.errors.data(), 1, entry.errors.size(), file) == entry.errors.size();
+    written = std::fclose(file) == 0 && written;
+    if (!written || std::rename(part.c_str(), path.c_str()) != 0) {
+        unlink(part.c_str());
+        return false;
+    }
+    evict();
+    return true;
+}
+
+// Utility method
+// Description: Returns the path of the entry file of key: the key in hexadecimal.
+std::string ResultCache::pathOf(const Key& key) const {
+    char name[40];
+    std::snprintf(name, sizeof(name), "%016llx%016llx", static_cast<unsigned long long>(key.high),
+                  static_cast<unsigned long long>(key.low));
+    return directory + "/" + name + ENTRY_SUFFIX;
+}
+
+// Utility method
+// Description: Lists the entry files, deletes stale temporary files, and deletes entries from the least
+//              recently used on while the entries use more than the capacity. Files that another process
+//              deleted in the meantime are skipped.
+void ResultCache::evict() const {
+    struct File {
+        std::string path;
+        std::time_t used;
+        std::uint64_t size;
+    };
+    DIR* handle = opendir(directory.c_str());
+    if (handle == nullptr) {
+        return;
+    }
+    std::vector<File> entries;
+    std::uint64_t total = 0;
+    std::time_t now = std::time(nullptr);
+    while (dirent* item = readdir(handle)) {
+        std::string name = item->d_name;
+        std::string path = directory + "/" + name;
+        struct stat status;
+        bool isEntry = endsWith(name, ENTRY_SUFFIX);
+        bool isPart = name.find(PART_SUFFIX) != std::string::npos;
+        if ((!isEntry && !isPart) || stat(path.c_str(), &status) != 0) {
+            continue;
+        }
+        if (isPart) {
+            if (now - status.st_mtime > STALE_PART_SECONDS) {
+                unlink(path.c_str());
+            }
+            continue;
+        }
+        entries.push_back(File{path, status.st_mtime, static_cast<std::uint64_t>(status.st_size)});
+        total += static_cast<std::uint64_t>(status.st_size);
+    }
+    closedir(handle);
+
+    if (total <= capacity) {
+        return;
+    }
+    std::sort(entries.begin(), entries.end(), [](const File& a, const File& b) {
+        return a.used != b.used ? a.used < b.used : a.path < b.path;
+    });
+    for (const File& file : entries) {
+        if (total <= capacity) {
+            break;
+        }
+        unlink(file.path.c_str());
+        total -= file.size;
+    }
+}
+
+// OutputRecorder constructor
+OutputRecorder::OutputRecorder(std::streambuf* target, std::size_t limit)
+    : target(target), limit(limit), truncated(false) {
+    setp(buffer, buffer + sizeof(buffer));
+}
+
+// getRecorded
+const std::string& OutputRecorder::getRecorded() {
+    flushBuffer();
+    return recorded;
+}
+
+// isTruncated
+bool OutputRecorder::isTruncated() {
+    flushBuffer();
+    return truncated;
+}
+
+// overflow
+// Description: Called when the buffer is full: empties it, then buffers c.
+OutputRecorder::int_type OutputRecorder::overflow(int_type c) {
+    if (!flushBuffer()) {
+        return traits_type::eof();
+    }
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+    }
+    return traits_type::not_eof(c);
+}
+
+// sync
+// Description: Called on flush (e.g. std::endl): empties the buffer and flushes target.
+int OutputRecorder::sync() {
+    return flushBuffer() && target->pubsync() == 0 ? 0 : -1;
+}
+
+// Utility method
+bool OutputRecorder::flushBuffer() {
+    std::streamsize length = pptr() - pbase();
+    if (!truncated && static_cast<std::size_t>(length) > limit - recorded.size()) {
+        truncated = true;
+        std::string().swap(recorded);
+    }
+    if (!truncated) {
+        recorded.append(pbase(), static_cast<std::size_t>(length));
+    }
+    bool passed = target->sputn(pbase(), length) == length;
+    setp(buffer, buffer + sizeof(buffer));
+    return passed;
+}
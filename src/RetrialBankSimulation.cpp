@@ -0,0 +1,210 @@
+/*
+ * RetrialBankSimulation.cpp
+ *
+ * Description: This file implements the RetrialBankSimulation class. The next event is the earliest of the
+ *              next retrial, the next first arrival and the first pending departure, in that order for ties.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include "../include/RetrialBankSimulation.h"
+
+// Constructor
+RetrialBankSimulation::RetrialBankSimulation(const std::vector<Event>& arrivals, int tellers, int capacity,
+                                             double meanRetrialDelay, unsigned long long seed)
+    : arrivals(&arrivals), tellers(tellers), capacity(capacity), meanRetrialDelay(meanRetrialDelay),
+      generator(seed), nextArrival(0), departures(static_cast<unsigned int>(tellers + 1)), lineLength(0),
+      tellersBusy(0), nextRetrialAt(0), simulationTime(0), eventsProcessed(0), customerCount(0),
+      cumulativeWaitTime(0), longestWait(0), blockedArrivals(0), retrials(0), blockedRetrials(0),
+      largestOrbit(0), orbitArea(0), orbitAreaTime(arrivals.empty() ? 0 : arrivals[0].getTime()) {}
+
+// run
+// Description: Processes events until none is left. A retrial that would take effect after INT_MAX never
+//              comes, so the customers still in the orbit then stay unserved.
+void RetrialBankSimulation::run() {
+    while (nextArrival < arrivals->size() || !departures.isEmpty() || retrialPending()) {
+        int arrivalTime = nextArrival < arrivals->size() ? (*arrivals)[nextArrival].getTime() : INT_MAX;
+        int departureTime = departures.isEmpty() ? INT_MAX : departures.peek().getTime();
+        if (retrialPending() && nextRetrialTime() <= arrivalTime && nextRetrialTime() <= departureTime) {
+            processRetrial();
+        } else if (nextArrival < arrivals->size() && arrivalTime <= departureTime) {
+            processArrival();
+        } else {
+            processDeparture();
+        }
+        eventsProcessed++;
+    }
+    accumulateOrbit(simulationTime);
+}
+
+// Getters
+
+int RetrialBankSimulation::getSimulationTime() const {
+    return simulationTime;
+}
+
+unsigned long long RetrialBankSimulation::getEventsProcessed() const {
+    return eventsProcessed;
+}
+
+int RetrialBankSimulation::getCustomerCount() const {
+    return customerCount;
+}
+
+float RetrialBankSimulation::getAverageWaitTime() const {
+    return static_cast<float>(cumulativeWaitTime) / customerCount;
+}
+
+int RetrialBankSimulation::getLongestWait() const {
+    return longestWait;
+}
+
+unsigned long long RetrialBankSimulation::getBlockedArrivals() const {
+    return blockedArrivals;
+}
+
+unsigned long long RetrialBankSimulation::getRetrials() const {
+    return retrials;
+}
+
+unsigned long long RetrialBankSimulation::getBlockedRetrials() const {
+    return blockedRetrials;
+}
+
+std::size_t RetrialBankSimulation::getLargestOrbit() const {
+    return largestOrbit;
+}
+
+std::size_t RetrialBankSimulation::getUnservedCustomers() const {
+    return orbit.size();
+}
+
+// getBlockingProbability
+double RetrialBankSimulation::getBlockingProbability() const {
+    return arrivals->empty() ? 0.0 : static_cast<double>(blockedArrivals) / arrivals->size();
+}
+
+// getAverageOrbitSize
+double RetrialBankSimulation::getAverageOrbitSize() const {
+    int day = arrivals->empty() ? 0 : simulationTime - (*arrivals)[0].getTime();
+    return day > 0 ? orbitArea / day : 0.0;
+}
+
+// Utility method
+// Description: The customer, arriving for the first time or retrying, is served if a teller is free, waits
+//              if the line has room, and is otherwise blocked and joins the orbit, whose next retrial is then
+//              drawn from the continuous time from. Returns true if the customer was blocked.
+bool RetrialBankSimulation::admit(std::size_t customer, bool retrial, double from) {
+    if (tellersBusy < tellers) {
+        startService(customer);
+        return false;
+    }
+    if (lineLength < capacity) {
+        line.enqueue(customer);
+        lineLength++;
+        return false;
+    }
+    (retrial ? blockedRetrials : blockedArrivals)++;
+    joinOrbit(customer, from);
+    return true;
+}
+
+// Utility method
+// Description: Admits the next customer of the input.
+void RetrialBankSimulation::processArrival() {
+    std::size_t customer = nextArrival++;
+    simulationTime = (*arrivals)[customer].getTime();
+    admit(customer, false, simulationTime);
+}
+
+// Utility method
+// Description: A uniformly chosen orbit customer leaves the orbit and tries again. The next retrial is drawn
+//              from the continuous time of this one.
+void RetrialBankSimulation::processRetrial() {
+    simulationTime = std::max(simulationTime, nextRetrialTime());
+    accumulateOrbit(simulationTime);
+    std::size_t slot = std::uniform_int_distribution<std::size_t>(0, orbit.size() - 1)(generator);
+    std::size_t customer = orbit[slot];
+    orbit[slot] = orbit.back();
+    orbit.pop_back();
+    retrials++;
+
+    if (!admit(customer, true, nextRetrialAt)) {
+        drawNextRetrial(nextRetrialAt);
+    }
+}
+
+// Utility method
+// Description: The freed teller serves the head of the line, if any.
+void RetrialBankSimulation::processDeparture() {
+    simulationTime = departures.peek().getTime();
+    departures.dequeue();
+    tellersBusy--;
+    if (lineLength > 0) {
+        std::size_t customer = line.peek();
+        line.dequeue();
+        lineLength--;
+        startService(customer);
+    }
+}
+
+// Utility method
+// Description: Starts serving customer now: records the wait since the first arrival and schedules the
+//              departure.
+void RetrialBankSimulation::startService(std::size_t customer) {
+    const Event& arrival = (*arrivals)[customer];
+    int wait = simulationTime - arrival.getTime();
+    cumulativeWaitTime += wait;
+    longestWait = std::max(longestWait, wait);
+    customerCount++;
+
+    Event departure(Event::EventType::DEPARTURE, simulationTime + arrival.getLength());
+    departures.enqueue(departure);
+    tellersBusy++;
+}
+
+// Utility method
+// Description: Adds customer to the orbit and redraws the next retrial from the continuous time from. A
+//              pending retrial is forgotten, which memorylessness allows.
+void RetrialBankSimulation::joinOrbit(std::size_t customer, double from) {
+    accumulateOrbit(simulationTime);
+    orbit.push_back(customer);
+    largestOrbit = std::max(largestOrbit, orbit.size());
+    drawNextRetrial(from);
+}
+
+// Utility method
+// Description: Draws the continuous time of the next retrial of any orbit customer, an exponential time
+//              with mean meanRetrialDelay / n after from.
+void RetrialBankSimulation::drawNextRetrial(double from) {
+    if (orbit.empty()) {
+        return;
+    }
+    std::exponential_distribution<double> distribution(orbit.size() / meanRetrialDelay);
+    nextRetrialAt = from + distribution(generator);
+}
+
+// Utility method
+// Description: Adds the orbit size times the time elapsed since the last change to orbitArea.
+void RetrialBankSimulation::accumulateOrbit(int time) {
+    if (time > orbitAreaTime) {
+        orbitArea += static_cast<double>(orbit.size()) * (time - orbitAreaTime);
+        orbitAreaTime = time;
+    }
+}
+
+// Utility method
+// Description: Returns true if the orbit is not empty and its next retrial takes effect by INT_MAX.
+bool RetrialBankSimulation::retrialPending() const {
+    return !orbit.empty() && nextRetrialAt <= static_cast<double>(INT_MAX);
+}
+
+// Utility method
+// Description: Returns the time unit in which the next retrial takes effect; only valid while retrialPending().
+int RetrialBankSimulation::nextRetrialTime() const {
+    return static_cast<int>(std::ceil(nextRetrialAt));
+}
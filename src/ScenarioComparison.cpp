@@ -0,0 +1,149 @@
+/*
+ * ScenarioComparison.cpp
+ *
+ * Description: This file implements the counter-based random substreams and the comparison of staffing
+ *              scenarios built on them.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "../include/ScenarioComparison.h"
+#include "../include/ConfidenceInterval.h"
+
+namespace {
+
+// Description: The SplitMix64 finalizer, a bijective mix of all bits of x.
+std::uint64_t mix(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Description: Returns the exponential variate with the given mean for the uniform u, by inversion, so that
+//              1 - u gives the antithetic variate.
+double exponential(double mean, double u) {
+    return -mean * std::log(u);
+}
+
+// Description: Returns the transaction length for the uniform u: an exponential variate rounded up, drawn with
+//              the mean m for which ceil(Exp(m)), a geometric length of mean 1 / (1 - exp(-1 / m)), averages
+//              meanLength. A mean length of at most 1 gives lengths of 1.
+int roundedUpLength(double meanLength, double u) {
+    if (meanLength <= 1) {
+        return 1;
+    }
+    return std::max(1, static_cast<int>(std::ceil(exponential(-1.0 / std::log1p(-1.0 / meanLength), u))));
+}
+
+}
+
+// RandomStreams constructor
+RandomStreams::RandomStreams(std::uint64_t seed) : seed(mix(seed)) {}
+
+// uniform
+// Description: Hashes the key one component at a time and keeps the top 53 bits, offset by half a step so
+//              that neither 0 nor 1 is returned.
+double RandomStreams::uniform(std::uint64_t stream, std::uint64_t replication, std::uint64_t customer,
+                              Variate variate) const {
+    std::uint64_t key = mix(seed ^ stream);
+    key = mix(key ^ replication);
+    key = mix(key ^ customer);
+    key = mix(key ^ static_cast<std::uint64_t>(variate));
+    return (static_cast<double>(key >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+// ScenarioComparison constructor
+ScenarioComparison::ScenarioComparison(const Model& model, const std::vector<Scenario>& scenarios)
+    : model(model), scenarios(scenarios) {}
+
+// run
+// Description: Simulates every (replication, scenario) pair, then summarizes the observations: the
+//              replications, or the means of the antithetic pairs.
+ScenarioComparison::Report ScenarioComparison::run(const Options& options) const {
+    RandomStreams streams(options.seed);
+    std::size_t count = scenarios.size();
+    std::vector<std::vector<double>> waits(count, std::vector<double>(options.replications));
+    std::vector<Event> arrivals;
+    Report report;
+    report.events = 0;
+
+    for (unsigned int replication = 0; replication < options.replications; replication++) {
+        unsigned int day = options.antithetic ? replication / 2 * 2 : replication;
+        bool antithetic = options.antithetic && replication % 2 == 1;
+        for (std::size_t s = 0; s < count; s++) {
+            if (s == 0 || !options.commonRandomNumbers) {
+                generateDay(streams, options.commonRandomNumbers ? 0 : s + 1, day, antithetic, arrivals);
+            }
+            waits[s][replication] = simulate(scenarios[s], arrivals, report.events);
+        }
+    }
+
+    std::vector<std::vector<double>> observations = waits;
+    if (options.antithetic) {
+        for (std::size_t s = 0; s < count; s++) {
+            observations[s].clear();
+            for (unsigned int replication = 0; replication + 1 < options.replications; replication += 2) {
+                observations[s].push_back((waits[s][replication] + waits[s][replication + 1]) / 2);
+            }
+        }
+    }
+    report.observations = static_cast<unsigned int>(observations[0].size());
+
+    for (std::size_t s = 0; s < count; s++) {
+        MeanWithConfidence wait = meanWithConfidence(observations[s]);
+        report.scenarios.push_back(ScenarioSummary{wait.mean, wait.halfWidth});
+    }
+    double baselineVariance = meanWithConfidence(waits[0]).variance;
+    for (std::size_t s = 1; s < count; s++) {
+        std::vector<double> differences(report.observations);
+        for (unsigned int k = 0; k < report.observations; k++) {
+            differences[k] = observations[s][k] - observations[0][k];
+        }
+        MeanWithConfidence difference = meanWithConfidence(differences);
+        double variance = difference.variance / report.observations;
+        double independentVariance = (meanWithConfidence(waits[s]).variance + baselineVariance) / options.replications;
+        report.differences.push_back(DifferenceSummary{difference.mean, difference.halfWidth, variance,
+                                                       independentVariance,
+                                                       variance > 0 ? independentVariance / variance : 0.0});
+    }
+    return report;
+}
+
+// Utility method
+// Description: Fills arrivals with the day of the given replication of stream, sorted by arrival time.
+//              Times are rounded down and transaction lengths up, so that every transaction takes at least
+//              one time unit; the lengths are drawn so that their mean after rounding is the model's.
+void ScenarioComparison::generateDay(const RandomStreams& streams, std::uint64_t stream, std::uint64_t replication,
+                                     bool antithetic, std::vector<Event>& arrivals) const {
+    arrivals.clear();
+    double clock = 0;
+    for (int customer = 0; customer < model.customers; customer++) {
+        double u = streams.uniform(stream, replication, customer, RandomStreams::Variate::INTERARRIVAL);
+        double v = streams.uniform(stream, replication, customer, RandomStreams::Variate::SERVICE);
+        if (antithetic) {
+            u = 1 - u;
+            v = 1 - v;
+        }
+        clock += exponential(model.meanInterarrivalTime, u);
+        int length = roundedUpLength(model.meanServiceTime, v);
+        arrivals.push_back(Event(Event::EventType::ARRIVAL, static_cast<int>(clock), length));
+    }
+}
+
+// Utility method
+// Description: Simulates the day under scenario in stream order and returns the average wait.
+double ScenarioComparison::simulate(const Scenario& scenario, const std::vector<Event>& arrivals,
+                                    unsigned long long& events) const {
+    BankSimulation simulation(arrivals, scenario.tellers, BankSimulation::ArrivalMode::STREAM);
+    simulation.setEventLog(false);
+    if (!scenario.staffing.empty()) {
+        simulation.setStaffingSchedule(&scenario.staffing);
+    }
+    simulation.run();
+    events += simulation.getEventsProcessed();
+    return simulation.getAverageWaitTime();
+}
@@ -0,0 +1,365 @@
+/*
+ * ServiceNetwork.cpp
+ *
+ * Description: This file implements the ServiceNetwork class. The next event is the earlier of the next
+ *              arrival at the entrance and the first pending departure; a departure frees a server of its
+ *              station for the head of that station's line and then moves its customer on.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include "../include/ServiceNetwork.h"
+
+namespace {
+
+// Routes from one station may add up to slightly more than 1 through rounding in the configuration.
+constexpr double PROBABILITY_TOLERANCE = 1e-9;
+
+// Transaction lengths drawn for randomly routed visits are capped to keep times well inside an int.
+constexpr double LONGEST_DRAWN_SERVICE = 1e8;
+
+// Description: Returns the mean of the exponential distribution whose values rounded up have the given mean
+//              (greater than 1). Rounded up, an exponential of mean m is geometric with mean
+//              1 / (1 - exp(-1 / m)), which is solved for m.
+double roundedUpMean(double mean) {
+    return -1.0 / std::log1p(-1.0 / mean);
+}
+
+// Description: Returns the total number of servers of stations, the most services that can be pending.
+unsigned int totalServers(const std::vector<ServiceNetwork::Station>& stations) {
+    unsigned int total = 0;
+    for (const ServiceNetwork::Station& station : stations) {
+        total += static_cast<unsigned int>(station.servers);
+    }
+    return total + 1;
+}
+
+}
+
+// averageWaitTime
+float ServiceNetwork::StationStatistics::averageWaitTime() const {
+    return visits == 0 ? 0.0f : static_cast<float>(cumulativeWaitTime) / visits;
+}
+
+// Departure comparison operators
+bool ServiceNetwork::Departure::operator<(const Departure& rhs) const {
+    return time < rhs.time || (time == rhs.time && sequence < rhs.sequence);
+}
+
+bool ServiceNetwork::Departure::operator>(const Departure& rhs) const {
+    return rhs < *this;
+}
+
+// readConfiguration
+// Description: Reads the configuration line by line. Stations must be defined before the routes naming them.
+bool ServiceNetwork::readConfiguration(std::istream& input, std::vector<Station>& stations,
+                                       std::vector<Route>& routes, std::string& error) {
+    stations.clear();
+    routes.clear();
+    std::vector<double> outgoing;
+    std::vector<int> lastRouteLine;     // Line of the last route from each station, 0 if it has none
+    std::string line;
+    int lineNumber = 0;
+
+    auto find = [&stations](const std::string& name) {
+        for (std::size_t s = 0; s < stations.size(); s++) {
+            if (stations[s].name == name) {
+                return static_cast<int>(s);
+            }
+        }
+        return -1;
+    };
+
+    while (std::getline(input, line)) {
+        lineNumber++;
+        std::istringstream fields(line);
+        std::string keyword;
+        if (!(fields >> keyword) || keyword[0] == '#') {
+            continue;
+        }
+        std::string where = "line " + std::to_string(lineNumber) + ": ";
+        std::string extra;
+
+        if (keyword == "station") {
+            Station station;
+            if (!(fields >> station.name >> station.servers >> station.meanServiceTime) || (fields >> extra)) {
+                error = where + "expected 'station NAME SERVERS MEAN_SERVICE_TIME'";
+                return false;
+            }
+            if (find(station.name) >= 0) {
+                error = where + "station '" + station.name + "' is defined twice";
+                return false;
+            }
+            if (station.servers < 1 || !(station.meanServiceTime > 0)) {
+                error = where + "a station needs at least one server and a positive mean service time";
+                return false;
+            }
+            stations.push_back(station);
+            outgoing.push_back(0.0);
+            lastRouteLine.push_back(0);
+        } else if (keyword == "route") {
+            std::string from, to;
+            double probability;
+            if (!(fields >> from >> to >> probability) || (fields >> extra)) {
+                error = where + "expected 'route FROM TO PROBABILITY'";
+                return false;
+            }
+            int fromIndex = find(from), toIndex = find(to);
+            if (fromIndex < 0 || toIndex < 0) {
+                error = where + "unknown station '" + (fromIndex < 0 ? from : to) + "'";
+                return false;
+            }
+            if (!(probability >= 0 && probability <= 1)) {
+                error = where + "the probability must be between 0 and 1";
+                return false;
+            }
+            outgoing[fromIndex] += probability;
+            if (outgoing[fromIndex] > 1 + PROBABILITY_TOLERANCE) {
+                error = where + "the routes from '" + from + "' add up to more than 1";
+                return false;
+            }
+            lastRouteLine[fromIndex] = lineNumber;
+            routes.push_back(Route{fromIndex, toIndex, probability});
+        } else {
+            error = where + "unknown keyword '" + keyword + "'";
+            return false;
+        }
+    }
+
+    if (stations.empty()) {
+        error = "the network has no stations";
+        return false;
+    }
+
+    // A customer must be able to leave from every station, or random routing keeps them in the bank forever:
+    // mark the stations with an exit, then every station with a route of nonzero probability to a marked one
+    std::vector<bool> canLeave(stations.size());
+    for (std::size_t s = 0; s < stations.size(); s++) {
+        canLeave[s] = outgoing[s] < 1 - PROBABILITY_TOLERANCE;
+    }
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (const Route& route : routes) {
+            if (route.probability > 0 && canLeave[route.to] && !canLeave[route.from]) {
+                canLeave[route.from] = true;
+                changed = true;
+            }
+        }
+    }
+    for (std::size_t s = 0; s < stations.size(); s++) {
+        if (!canLeave[s]) {
+            error = "line " + std::to_string(lastRouteLine[s]) + ": customers at '" + stations[s].name +
+                    "' can never leave the bank";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Constructor
+// Description: Lays the routes out as one slice of cumulative probabilities per station.
+ServiceNetwork::ServiceNetwork(const std::vector<Station>& stations, const std::vector<Route>& routes,
+                               unsigned long long seed)
+    : stations(stations), busy(stations.size(), 0), lines(stations.size()), lineLength(stations.size(), 0),
+      routingBegin(stations.size() + 1, 0), visits(stations.size(), 0), stationWaitTime(stations.size(), 0),
+      stationLongestWait(stations.size(), 0), longestLine(stations.size(), 0), busyTime(stations.size(), 0),
+      routeBegin(1, 0), departures(totalServers(stations)), nextSequence(0), generator(seed), firstArrival(0),
+      simulationTime(0), customersCompleted(0), cumulativeWaitTime(0), cumulativeTimeInBank(0), totalVisits(0),
+      eventsProcessed(0) {
+    for (const Station& station : stations) {
+        servers.push_back(station.servers);
+        meanServiceTime.push_back(station.meanServiceTime);
+    }
+
+    for (const Route& route : routes) {
+        routingBegin[route.from + 1]++;
+    }
+    for (std::size_t s = 0; s < stations.size(); s++) {
+        routingBegin[s + 1] += routingBegin[s];
+    }
+    routingCumulative.resize(routes.size());
+    routingTarget.resize(routes.size());
+    std::vector<std::size_t> fill(routingBegin.begin(), routingBegin.end() - 1);
+    for (const Route& route : routes) {
+        std::size_t slot = fill[route.from]++;
+        routingCumulative[slot] = route.probability;
+        routingTarget[slot] = route.to;
+    }
+    for (std::size_t s = 0; s < stations.size(); s++) {
+        for (std::size_t slot = routingBegin[s] + 1; slot < routingBegin[s + 1]; slot++) {
+            routingCumulative[slot] += routingCumulative[slot - 1];
+        }
+    }
+}
+
+// findStation
+int ServiceNetwork::findStation(const std::string& name) const {
+    for (std::size_t s = 0; s < stations.size(); s++) {
+        if (stations[s].name == name) {
+            return static_cast<int>(s);
+        }
+    }
+    return -1;
+}
+
+// addCustomer
+void ServiceNetwork::addCustomer(int time, int length, const std::vector<std::pair<int, int>>& route) {
+    arrivalTime.push_back(time);
+    firstLength.push_back(length);
+    for (const std::pair<int, int>& visit : route) {
+        routeStation.push_back(visit.first);
+        routeLength.push_back(visit.second);
+    }
+    routeBegin.push_back(routeStation.size());
+    routed.push_back(route.empty() ? 0 : 1);
+}
+
+// run
+// Description: Takes the next arrival or the first departure until every customer has left. An arrival wins
+//              a tie against a departure.
+void ServiceNetwork::run() {
+    std::size_t count = arrivalTime.size();
+    routePosition.assign(routeBegin.begin(), routeBegin.end() - 1);
+    serviceLength.assign(count, 0);
+    enteredAt.assign(count, 0);
+    customerWaitTime.assign(count, 0);
+    customerVisits.assign(count, 0);
+    firstArrival = count > 0 ? arrivalTime[0] : 0;
+
+    std::size_t nextCustomer = 0;
+    while (nextCustomer < count || !departures.isEmpty()) {
+        if (nextCustomer < count && (departures.isEmpty() || arrivalTime[nextCustomer] <= departures.peek().time)) {
+            std::size_t customer = nextCustomer++;
+            simulationTime = arrivalTime[customer];
+            enterStation(customer, 0, firstLength[customer]);
+        } else {
+            Departure departure = departures.peek();
+            departures.dequeue();
+            simulationTime = departure.time;
+            finishService(departure.station, departure.customer);
+        }
+        eventsProcessed++;
+    }
+}
+
+// Getters
+
+int ServiceNetwork::getSimulationTime() const {
+    return simulationTime;
+}
+
+unsigned long long ServiceNetwork::getEventsProcessed() const {
+    return eventsProcessed;
+}
+
+int ServiceNetwork::getCustomerCount() const {
+    return customersCompleted;
+}
+
+float ServiceNetwork::getAverageWaitTime() const {
+    return static_cast<float>(cumulativeWaitTime) / customersCompleted;
+}
+
+float ServiceNetwork::getAverageTimeInBank() const {
+    return static_cast<float>(cumulativeTimeInBank) / customersCompleted;
+}
+
+float ServiceNetwork::getAverageVisits() const {
+    return static_cast<float>(totalVisits) / customersCompleted;
+}
+
+std::vector<ServiceNetwork::StationStatistics> ServiceNetwork::getStationStatistics() const {
+    std::vector<StationStatistics> statistics;
+    double day = static_cast<double>(simulationTime) - firstArrival;
+    for (std::size_t s = 0; s < stations.size(); s++) {
+        double capacity = day * servers[s];
+        statistics.push_back(StationStatistics{stations[s].name, servers[s], visits[s], stationWaitTime[s],
+                                               stationLongestWait[s], longestLine[s],
+                                               capacity > 0 ? busyTime[s] / capacity : 0.0});
+    }
+    return statistics;
+}
+
+// Utility method
+// Description: The customer enters station with a transaction of the given length: served at once if a
+//              server is free, otherwise at the back of the station's line.
+void ServiceNetwork::enterStation(std::size_t customer, int station, int length) {
+    serviceLength[customer] = length;
+    enteredAt[customer] = simulationTime;
+    customerVisits[customer]++;
+    visits[station]++;
+
+    if (busy[station] < servers[station]) {
+        startService(station, customer);
+        return;
+    }
+    lines[station].enqueue(customer);
+    lineLength[station]++;
+    longestLine[station] = std::max(longestLine[station], lineLength[station]);
+}
+
+// Utility method
+// Description: Starts serving customer at station now: records the wait and schedules the departure.
+void ServiceNetwork::startService(int station, std::size_t customer) {
+    int wait = simulationTime - enteredAt[customer];
+    stationWaitTime[station] += wait;
+    stationLongestWait[station] = std::max(stationLongestWait[station], wait);
+    customerWaitTime[customer] += wait;
+
+    busy[station]++;
+    busyTime[station] += serviceLength[customer];
+    departures.enqueue(Departure{simulationTime + serviceLength[customer], nextSequence++, customer, station});
+}
+
+// Utility method
+// Description: The freed server takes the head of the station's line; the departing customer then moves to
+//              the next station of their route, or of a random route, or leaves the bank.
+void ServiceNetwork::finishService(int station, std::size_t customer) {
+    busy[station]--;
+    if (lineLength[station] > 0) {
+        std::size_t next = lines[station].peek();
+        lines[station].dequeue();
+        lineLength[station]--;
+        startService(station, next);
+    }
+
+    if (routed[customer]) {
+        std::size_t position = routePosition[customer];
+        if (position < routeBegin[customer + 1]) {
+            routePosition[customer]++;
+            enterStation(customer, routeStation[position], routeLength[position]);
+            return;
+        }
+    } else if (routingBegin[station] < routingBegin[station + 1]) {
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(generator);
+        for (std::size_t slot = routingBegin[station]; slot < routingBegin[station + 1]; slot++) {
+            if (u < routingCumulative[slot]) {
+                int target = routingTarget[slot];
+                enterStation(customer, target, drawServiceTime(target));
+                return;
+            }
+        }
+    }
+
+    customersCompleted++;
+    cumulativeWaitTime += customerWaitTime[customer];
+    cumulativeTimeInBank += simulationTime - arrivalTime[customer];
+    totalVisits += customerVisits[customer];
+}
+
+// Utility method
+// Description: Draws a transaction length of the station's mean: an exponential length rounded up to whole
+//              time units, drawn with the mean that makes the rounded lengths average the station's mean.
+//              A station mean of at most 1 gives lengths of 1.
+int ServiceNetwork::drawServiceTime(int station) {
+    if (meanServiceTime[station] <= 1) {
+        return 1;
+    }
+    std::exponential_distribution<double> distribution(1.0 / roundedUpMean(meanServiceTime[station]));
+    double value = std::ceil(distribution(generator));
+    return static_cast<int>(std::min(std::max(value, 1.0), LONGEST_DRAWN_SERVICE));
+}
@@ -0,0 +1,230 @@
+/*
+ * SimulationKernel.cpp
+ *
+ * Description: This file implements the SimulationKernel class template and its statistics policies. The loop is
+ *              the one of BasicBankSimulation in ArrivalMode::STREAM without its optional parts: an arrival is
+ *              served at once if a teller is free and otherwise joins the bank line, and a departure frees its
+ *              teller for the next customer in line. The policies are only reached through their own types, so
+ *              the compiler sees every call of the loop and inlines it.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include "../include/SimulationKernel.h"
+#include <algorithm>    // For std::max and std::stable_sort
+#include <type_traits>  // For std::is_constructible
+
+// KernelEvent
+
+template <typename Time>
+bool KernelEvent<Time>::operator<(const KernelEvent& rhs) const {
+    return time < rhs.time;
+}
+
+template <typename Time>
+bool KernelEvent<Time>::operator>(const KernelEvent& rhs) const {
+    return time > rhs.time;
+}
+
+template <typename Time>
+bool KernelEvent<Time>::operator<=(const KernelEvent& rhs) const {
+    return time <= rhs.time;
+}
+
+// WaitStatistics
+
+template <typename Time>
+void WaitStatistics<Time>::recordArrival(Time, unsigned int) {
+    customerCount++;
+}
+
+template <typename Time>
+void WaitStatistics<Time>::recordServiceStart(Time, Time wait) {
+    cumulativeWaitTime += wait;
+}
+
+template <typename Time>
+void WaitStatistics<Time>::recordDeparture(Time) {
+}
+
+template <typename Time>
+int WaitStatistics<Time>::getCustomerCount() const {
+    return customerCount;
+}
+
+template <typename Time>
+typename WaitStatistics<Time>::Total WaitStatistics<Time>::getCumulativeWaitTime() const {
+    return cumulativeWaitTime;
+}
+
+template <typename Time>
+float WaitStatistics<Time>::getAverageWaitTime() const {
+    return static_cast<float>(cumulativeWaitTime) / customerCount;
+}
+
+// NoStatistics
+
+template <typename Time>
+void NoStatistics<Time>::recordArrival(Time, unsigned int) {
+}
+
+template <typename Time>
+void NoStatistics<Time>::recordServiceStart(Time, Time) {
+}
+
+template <typename Time>
+void NoStatistics<Time>::recordDeparture(Time) {
+}
+
+// WaitExtremeStatistics
+
+template <typename Time>
+void WaitExtremeStatistics<Time>::recordArrival(Time time, unsigned int lineLength) {
+    WaitStatistics<Time>::recordArrival(time, lineLength);
+    longestLine = std::max(longestLine, lineLength);
+}
+
+template <typename Time>
+void WaitExtremeStatistics<Time>::recordServiceStart(Time time, Time wait) {
+    WaitStatistics<Time>::recordServiceStart(time, wait);
+    longestWait = std::max(longestWait, wait);
+}
+
+template <typename Time>
+Time WaitExtremeStatistics<Time>::getLongestWait() const {
+    return longestWait;
+}
+
+template <typename Time>
+unsigned int WaitExtremeStatistics<Time>::getLongestLine() const {
+    return longestLine;
+}
+
+// Constructor
+// Description: Creates a kernel of arrivals with the given number of tellers. The event set holds at most one
+//              departure per teller, so a dynamically sized set is allocated once for all of them.
+template <template <typename> class EventSet, template <typename> class Line, typename Time,
+          template <typename> class Statistics>
+SimulationKernel<EventSet, Line, Time, Statistics>::SimulationKernel(const std::vector<KernelEvent<Time>>& arrivals,
+                                                                     int tellers)
+    : arrivals(&arrivals), departures(makeEventSet(static_cast<unsigned int>(tellers + 1))), nextArrival(0),
+      lineLength(0), tellers(tellers), tellersBusy(0), simulationTime(0), eventsProcessed(0) {
+}
+
+// sortArrivals
+// Description: Stable sort by time, so that simultaneous arrivals keep their input order.
+template <template <typename> class EventSet, template <typename> class Line, typename Time,
+          template <typename> class Statistics>
+void SimulationKernel<EventSet, Line, Time, Statistics>::sortArrivals(std::vector<KernelEvent<Time>>& arrivals) {
+    std::stable_sort(arrivals.begin(), arrivals.end(),
+                     [](const KernelEvent<Time>& lhs, const KernelEvent<Time>& rhs) { return lhs.time < rhs.time; });
+}
+
+// step
+// Description: Processes the next event; an arrival is processed before a departure at the same time.
+template <template <typename> class EventSet, template <typename> class Line, typename Time,
+          template <typename> class Statistics>
+bool SimulationKernel<EventSet, Line, Time, Statistics>::step() {
+    if (nextArrival < arrivals->size() &&
+        (departures.isEmpty() || (*arrivals)[nextArrival].time <= departures.peek().time)) {
+        const KernelEvent<Time>& arrival = (*arrivals)[nextArrival++];
+        simulationTime = arrival.time;
+        processArrival(arrival);
+    } else if (!departures.isEmpty()) {
+        simulationTime = departures.peek().time;
+        departures.dequeue();
+        processDeparture();
+    } else {
+        return false;
+    }
+    eventsProcessed++;
+    return true;
+}
+
+// run
+// Description: Processes all events until none is left.
+template <template <typename> class EventSet, template <typename> class Line, typename Time,
+          template <typename> class Statistics>
+void SimulationKernel<EventSet, Line, Time, Statistics>::run() {
+    while (step()) {
+    }
+}
+
+// Getters
+
+template <template <typename> class EventSet, template <typename> class Line, typename Time,
+          template <typename> class Statistics>
+const Statistics<Time>& SimulationKernel<EventSet, Line, Time, Statistics>::getStatistics() const {
+    return *this;
+}
+
+template <template <typename> class EventSet, template <typename> class Line, typename Time,
+          template <typename> class Statistics>
+Time SimulationKernel<EventSet, Line, Time, Statistics>::getSimulationTime() const {
+    return simulationTime;
+}
+
+template <template <typename> class EventSet, template <typename> class Line, typename Time,
+          template <typename> class Statistics>
+unsigned long long SimulationKernel<EventSet, Line, Time, Statistics>::getEventsProcessed() const {
+    return eventsProcessed;
+}
+
+// Utility method
+// Description: Creates the event set. Dynamically sized sets are given their initial capacity; the capacity of a
+//              fixed-capacity set is part of its type.
+template <template <typename> class EventSet, template <typename> class Line, typename Time,
+          template <typename> class Statistics>
+EventSet<KernelEvent<Time>> SimulationKernel<EventSet, Line, Time, Statistics>::makeEventSet(unsigned int capacity) {
+    if constexpr (std::is_constructible<EventSet<KernelEvent<Time>>, unsigned int>::value) {
+        return EventSet<KernelEvent<Time>>(capacity);
+    } else {
+        return EventSet<KernelEvent<Time>>();
+    }
+}
+
+// Utility method
+// Description: Processes an arrival: the customer is served at once if a teller is free, and otherwise waits in
+//              the bank line.
+template <template <typename> class EventSet, template <typename> class Line, typename Time,
+          template <typename> class Statistics>
+void SimulationKernel<EventSet, Line, Time, Statistics>::processArrival(const KernelEvent<Time>& arrival) {
+    Statistics<Time>::recordArrival(simulationTime, lineLength);
+    if (lineLength == 0 && tellersBusy < tellers) {
+        startService(arrival);
+    } else {
+        KernelEvent<Time> customer = arrival;
+        if (!bankLine.enqueue(customer)) {
+            throw FullDataCollectionException("bank line is full");
+        }
+        lineLength++;
+    }
+}
+
+// Utility method
+// Description: Processes a departure: the freed teller serves the next customer in the bank line, if any.
+template <template <typename> class EventSet, template <typename> class Line, typename Time,
+          template <typename> class Statistics>
+void SimulationKernel<EventSet, Line, Time, Statistics>::processDeparture() {
+    tellersBusy--;
+    Statistics<Time>::recordDeparture(simulationTime);
+    if (lineLength > 0) {
+        KernelEvent<Time> customer = bankLine.peek();
+        bankLine.dequeue();
+        lineLength--;
+        startService(customer);
+    }
+}
+
+// Utility method
+// Description: Starts serving customer now: records the customer's wait and schedules the departure.
+template <template <typename> class EventSet, template <typename> class Line, typename Time,
+          template <typename> class Statistics>
+void SimulationKernel<EventSet, Line, Time, Statistics>::startService(const KernelEvent<Time>& customer) {
+    Statistics<Time>::recordServiceStart(simulationTime, simulationTime - customer.time);
+    if (!departures.enqueue(KernelEvent<Time>{simulationTime + customer.length, 0})) {
+        throw FullDataCollectionException("event set is full");
+    }
+    tellersBusy++;
+}
@@ -0,0 +1,194 @@
+/*
+ * SplittingEstimator.cpp
+ *
+ * Description: This file implements the SplittingEstimator class: the simulation of one trajectory of an
+ *              M/M/c cycle up to the next level, the fixed-effort stages built on it, and the plain
+ *              simulation used for comparison.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include <chrono>
+#include "../include/SplittingEstimator.h"
+#include "../include/ConfidenceInterval.h"
+#include "../include/FullDataCollectionException.h"
+
+namespace {
+
+// Levels chosen by defaultLevels() at most
+const int DEFAULT_LEVEL_COUNT = 64;
+
+}
+
+// Departure comparison operators
+bool SplittingEstimator::Departure::operator<(const Departure& rhs) const {
+    return time < rhs.time;
+}
+
+bool SplittingEstimator::Departure::operator>(const Departure& rhs) const {
+    return time > rhs.time;
+}
+
+// Constructor
+SplittingEstimator::SplittingEstimator(const Model& model)
+    : model(model), interarrival(1.0 / model.meanInterarrivalTime), service(1.0 / model.meanServiceTime) {}
+
+// isStable
+bool SplittingEstimator::isStable(const Model& model) {
+    return model.tellers > 0 && model.meanInterarrivalTime > 0 && model.meanServiceTime > 0 &&
+           model.meanServiceTime < model.tellers * model.meanInterarrivalTime;
+}
+
+// defaultLevels
+// Description: A newcomer who finds l customers waiting waits about (l + 1) * meanServiceTime / tellers.
+//              Close levels keep the fraction reaching the next one large, which keeps the variance low.
+std::vector<int> SplittingEstimator::defaultLevels() const {
+    int top = std::min(static_cast<int>(model.waitThreshold * model.tellers / model.meanServiceTime),
+                       static_cast<int>(MAX_LINE) / 2);
+    int step = std::max(1, (top + DEFAULT_LEVEL_COUNT - 1) / DEFAULT_LEVEL_COUNT);
+    std::vector<int> levels;
+    for (int level = step; level < top; level += step) {
+        levels.push_back(level);
+    }
+    return levels;
+}
+
+// estimate
+// Description: Runs the stages of each run as described in the file description. A stage whose
+//              trajectories all failed ends the run: every later term of the sum is zero.
+SplittingEstimator::Estimate SplittingEstimator::estimate(const Options& options) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    generator.seed(options.seed);
+    std::vector<int> levels = options.levels.empty() ? defaultLevels() : options.levels;
+
+    Estimate result;
+    result.customers = 0;
+    result.levelProbabilities.assign(levels.size(), 0.0);
+    std::vector<double> values;
+
+    std::vector<State> entrances, reached;
+    for (unsigned int run = 0; run < options.runs; run++) {
+        double reachProbability = 1;            // p_0 * ... * p_(k-1)
+        double tailPerCycle = 0;
+        double customersPerCycle = 0;
+
+        for (std::size_t stage = 0; stage <= levels.size() && (stage == 0 || !entrances.empty()); stage++) {
+            int level = stage < levels.size() ? levels[stage] : static_cast<int>(MAX_LINE) + 1;
+            unsigned long long customers = 0, tailCustomers = 0;
+            reached.clear();
+            for (unsigned int trajectory = 0; trajectory < options.effort; trajectory++) {
+                State state = stage == 0 ? startCycle() : entrances[trajectory % entrances.size()];
+                Segment segment = advance(state, level);
+                customers += segment.customers + (stage == 0 ? 1 : 0);
+                tailCustomers += segment.tailCustomers;
+                if (segment.reachedLevel) {
+                    reached.push_back(state);
+                }
+            }
+            result.customers += customers;
+            tailPerCycle += reachProbability * tailCustomers / options.effort;
+            customersPerCycle += reachProbability * customers / options.effort;
+            if (stage < levels.size()) {
+                double fraction = static_cast<double>(reached.size()) / options.effort;
+                result.levelProbabilities[stage] += fraction / options.runs;
+                reachProbability *= fraction;
+            }
+            entrances.swap(reached);
+        }
+        values.push_back(tailPerCycle / customersPerCycle);
+    }
+
+    MeanWithConfidence summary = meanWithConfidence(values);
+    result.probability = summary.mean;
+    result.halfWidth = summary.halfWidth;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+// estimateCrude
+// Description: Simulates whole cycles until each run has seen at least customers customers.
+SplittingEstimator::Estimate SplittingEstimator::estimateCrude(unsigned long long customers, unsigned int runs,
+                                                             unsigned long long seed) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    generator.seed(seed);
+
+    Estimate result;
+    result.customers = 0;
+    std::vector<double> values;
+    for (unsigned int run = 0; run < runs; run++) {
+        unsigned long long seen = 0, tailCustomers = 0;
+        while (seen < customers) {
+            State state = startCycle();
+            Segment segment = advance(state, static_cast<int>(MAX_LINE) + 1);
+            seen += segment.customers + 1;
+            tailCustomers += segment.tailCustomers;
+        }
+        result.customers += seen;
+        values.push_back(static_cast<double>(tailCustomers) / seen);
+    }
+
+    MeanWithConfidence summary = meanWithConfidence(values);
+    result.probability = summary.mean;
+    result.halfWidth = summary.halfWidth;
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+// Utility method
+// Description: Returns the state of a new cycle: a customer has just arrived at the empty bank and is served.
+//              The callers count that customer.
+SplittingEstimator::State SplittingEstimator::startCycle() {
+    State state;
+    state.time = 0;
+    state.busy = 0;
+    state.nextArrival = interarrival(generator);
+    startService(state);
+    return state;
+}
+
+// Utility method
+// Description: Simulates state until the line holds level customers or the bank is empty, and returns what
+//              happened on the way.
+SplittingEstimator::Segment SplittingEstimator::advance(State& state, int level) {
+    Segment segment{false, 0, 0};
+    while (true) {
+        if (state.departures.isEmpty() || state.nextArrival < state.departures.peek().time) {
+            state.time = state.nextArrival;
+            state.nextArrival = state.time + interarrival(generator);
+            segment.customers++;
+            if (state.busy < model.tellers) {
+                startService(state);
+                continue;
+            }
+            if (!state.line.enqueue(state.time)) {
+                throw FullDataCollectionException("bank line is full");
+            }
+            if (static_cast<int>(state.line.getElementCount()) >= level) {
+                segment.reachedLevel = true;
+                return segment;
+            }
+        } else {
+            state.time = state.departures.peek().time;
+            state.departures.dequeue();
+            state.busy--;
+            if (!state.line.isEmpty()) {
+                if (state.time - state.line.peek() > model.waitThreshold) {
+                    segment.tailCustomers++;
+                }
+                state.line.dequeue();
+                startService(state);
+            } else if (state.busy == 0) {
+                return segment;
+            }
+        }
+    }
+}
+
+// Utility method
+// Description: A teller starts serving a customer now.
+void SplittingEstimator::startService(State& state) {
+    state.departures.enqueue(Departure{state.time + service(generator)});
+    state.busy++;
+}
@@ -0,0 +1,215 @@
+/*
+ * TraceCheckpoint.cpp
+ *
+ * Description: This file implements the TraceCheckpoint class: the parsing of appended customers, the
+ *              validation of a checkpoint against the trace, and the checkpoint file. The file holds the
+ *              fields in order as raw values, vectors preceded by their length, between a leading and a
+ *              trailing marker; a file without the trailing marker is incomplete.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "../include/TraceCheckpoint.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Leading and trailing marker of a checkpoint file, with the version of the format
+const char CHECKPOINT_MAGIC[8] = {'B', 'S', 'C', 'K', 'P', 'T', '0', '3'};
+
+// Multipliers of the two lanes of the prefix hash (the 64-bit FNV prime and a large odd constant)
+const std::uint64_t PREFIX_PRIME_HIGH = 0x100000001B3ULL;
+const std::uint64_t PREFIX_PRIME_LOW = 0x9E3779B97F4A7C15ULL;
+
+template <typename T>
+bool writeValue(std::FILE* file, const T& value) {
+    return std::fwrite(&value, sizeof(T), 1, file) == 1;
+}
+
+template <typename T>
+bool readValue(std::FILE* file, T& value) {
+    return std::fread(&value, sizeof(T), 1, file) == 1;
+}
+
+// Description: Parses the integer at text + offset like operator>> on an int, and moves the offset past it.
+bool parseInt(const char* text, std::uint64_t& offset, int& value) {
+    char* end = nullptr;
+    errno = 0;
+    long parsed = std::strtol(text + offset, &end, 10);
+    if (end == text + offset || errno == ERANGE || parsed < INT_MIN || parsed > INT_MAX) {
+        return false;
+    }
+    offset = static_cast<std::uint64_t>(end - text);
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+bool sameKey(const ResultCache::Key& a, const ResultCache::Key& b) {
+    return a.high == b.high && a.low == b.low;
+}
+
+}
+
+// windowStart
+std::uint64_t TraceCheckpoint::windowStart(std::uint64_t hashedLength) {
+    return hashedLength > CHECK_WINDOW ? hashedLength - CHECK_WINDOW : 0;
+}
+
+// hashWindow
+ResultCache::Key TraceCheckpoint::hashWindow(const std::string& tail, std::uint64_t base, std::uint64_t hashedLength) {
+    std::uint64_t start = windowStart(hashedLength);
+    ResultCache::KeyBuilder builder;
+    builder.add(tail.data() + (start - base), static_cast<std::size_t>(hashedLength - start));
+    return builder.finish();
+}
+
+// hashPrefix
+// Description: Two multiplicative lanes over the bytes, so that the state after a part is the only thing a
+//              later part needs.
+ResultCache::Key TraceCheckpoint::hashPrefix(ResultCache::Key prefixHash, const char* data, std::size_t size) {
+    for (std::size_t i = 0; i < size; i++) {
+        const std::uint64_t byte = static_cast<unsigned char>(data[i]);
+        prefixHash.high = (prefixHash.high ^ byte) * PREFIX_PRIME_HIGH;
+        prefixHash.low = (prefixHash.low + byte + 1) * PREFIX_PRIME_LOW;
+        prefixHash.low ^= prefixHash.low >> 29;
+    }
+    return prefixHash;
+}
+
+// identify
+bool TraceCheckpoint::identify(const std::string& path, TraceFile& file) {
+    struct stat status;
+    if (stat(path.c_str(), &status) != 0) {
+        return false;
+    }
+    file.device = static_cast<std::uint64_t>(status.st_dev);
+    file.inode = static_cast<std::uint64_t>(status.st_ino);
+    file.size = static_cast<std::uint64_t>(status.st_size);
+    file.modified = static_cast<std::int64_t>(status.st_mtim.tv_sec) * 1000000000 + status.st_mtim.tv_nsec;
+    return true;
+}
+
+// parseArrivals
+std::uint64_t TraceCheckpoint::parseArrivals(const std::string& trace, std::uint64_t offset,
+                                             std::vector<Event>& arrivals) {
+    const char* text = trace.c_str();
+    std::uint64_t position = offset;
+    int arrival = 0, length = 0;
+    while (parseInt(text, position, arrival) && parseInt(text, position, length)) {
+        arrivals.push_back(Event(Event::EventType::ARRIVAL, arrival, length));
+        offset = position;
+    }
+    return offset;
+}
+
+// describes
+bool TraceCheckpoint::describes(const std::string& tail, std::uint64_t base, const TraceFile& current,
+                                const ResultCache::Key& configuration, std::string& reason) const {
+    const std::uint64_t traceSize = current.size;
+    if (!sameKey(this->configuration, configuration)) {
+        reason = "the executable, tellers or staffing schedule changed";
+    } else if (current.device != traceFile.device || current.inode != traceFile.inode) {
+        reason = "the trace was replaced by another file";
+    } else if (traceSize < hashedLength) {
+        reason = "the trace is shorter than at the checkpoint";
+    } else if (base > windowStart(hashedLength) || !sameKey(hashWindow(tail, base, hashedLength), windowHash)) {
+        reason = "the trace was modified before its end";
+    } else if (offset > 0 && hashedLength == offset && offset < traceSize &&
+               !std::isspace(static_cast<unsigned char>(tail[offset - base]))) {
+        reason = "the last line of the trace was extended";
+    } else {
+        return true;
+    }
+    return false;
+}
+
+// wasRewritten
+bool TraceCheckpoint::wasRewritten(const TraceFile& current) const {
+    return current.size == traceFile.size && current.modified != traceFile.modified;
+}
+
+// verifiesPrefix
+bool TraceCheckpoint::verifiesPrefix(const std::string& trace, std::string& reason) const {
+    if (trace.size() < hashedLength ||
+        !sameKey(hashPrefix(ResultCache::Key{0, 0}, trace.data(), static_cast<std::size_t>(hashedLength)),
+                 prefixHash)) {
+        reason = "the trace was modified before its end";
+        return false;
+    }
+    return true;
+}
+
+// read
+bool TraceCheckpoint::read(const std::string& path) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    char magic[8];
+    std::uint64_t departures = 0, waiting = 0;
+    bool valid = std::fread(magic, sizeof(magic), 1, file) == 1 &&
+                 std::memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) == 0 && readValue(file, configuration) &&
+                 readValue(file, offset) && readValue(file, hashedLength) && readValue(file, windowHash) &&
+                 readValue(file, prefixHash) && readValue(file, traceFile) && readValue(file, lastArrivalTime) &&
+                 readValue(file, state.simulationTime) && readValue(file, state.tellersOnDuty) &&
+                 readValue(file, state.tellersBusy) &&
+                 readValue(file, state.customerCount) && readValue(file, state.cumulativeWaitTime) &&
+                 readValue(file, state.eventsProcessed) && readValue(file, state.nextStaffingChange) &&
+                 readValue(file, departures) && departures <= static_cast<std::uint64_t>(INT_MAX);
+    if (valid) {
+        state.departureTimes.resize(static_cast<std::size_t>(departures));
+        valid = std::fread(state.departureTimes.data(), sizeof(int), state.departureTimes.size(), file) ==
+                    state.departureTimes.size() &&
+                readValue(file, waiting) && waiting <= static_cast<std::uint64_t>(INT_MAX);
+    }
+    state.bankLine.clear();
+    for (std::uint64_t i = 0; valid && i < waiting; i++) {
+        int time = 0, length = 0;
+        valid = readValue(file, time) && readValue(file, length);
+        state.bankLine.push_back(Event(Event::EventType::ARRIVAL, time, length));
+    }
+    valid = valid && std::fread(magic, sizeof(magic), 1, file) == 1 &&
+            std::memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) == 0 && std::fgetc(file) == EOF;
+    std::fclose(file);
+    return valid;
+}
+
+// write
+// Description: Writes a temporary file named after the process next to path, then renames it over path.
+bool TraceCheckpoint::write(const std::string& path) const {
+    std::string part = path + ".part." + std::to_string(getpid());
+    std::FILE* file = std::fopen(part.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    std::uint64_t departures = state.departureTimes.size(), waiting = state.bankLine.size();
+    bool written = std::fwrite(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC), 1, file) == 1 &&
+                   writeValue(file, configuration) && writeValue(file, offset) && writeValue(file, hashedLength) &&
+                   writeValue(file, windowHash) && writeValue(file, prefixHash) && writeValue(file, traceFile) &&
+                   writeValue(file, lastArrivalTime) && writeValue(file, state.simulationTime) &&
+                   writeValue(file, state.tellersOnDuty) &&
+                   writeValue(file, state.tellersBusy) && writeValue(file, state.customerCount) &&
+                   writeValue(file, state.cumulativeWaitTime) && writeValue(file, state.eventsProcessed) &&
+                   writeValue(file, state.nextStaffingChange) && writeValue(file, departures) &&
+                   std::fwrite(state.departureTimes.data(), sizeof(int), state.departureTimes.size(), file) ==
+                       state.departureTimes.size() &&
+                   writeValue(file, waiting);
+    for (const Event& customer : state.bankLine) {
+        written = written && writeValue(file, customer.getTime()) && writeValue(file, customer.getLength());
+    }
+    written = written && std::fwrite(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC), 1, file) == 1;
+    written = std::fclose(file) == 0 && written;
+    if (!written || std::rename(part.c_str(), path.c_str()) != 0) {
+        unlink(part.c_str());
+        return false;
+    }
+    return true;
+}
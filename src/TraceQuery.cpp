@@ -0,0 +1,173 @@
+/*
+ * TraceQuery.cpp
+ *
+ * Description:
+ * This file implements the TraceQuery tool, which answers questions about one time window of a run from the
+ * indexed trace file written by BankSim --trace, without reading the rest of the file:
+ *
+ *     TraceQuery FILE FROM TO [--events] [--queue] [--waits]
+ *
+ * The window is FROM <= time < TO. The tool prints, for the selected sections (all of them by default):
+ * - Events: every arrival, departure, service start and staffing change in the window.
+ * - Queue Length: the line length at the start of the window and after every change inside it.
+ * - Waits: the wait of every customer whose service started in the window, with their count, mean and maximum.
+ *
+ * The trace is memory mapped by a TraceReader, so a query costs a binary search of the sparse time index and
+ * a scan of the window's records; only those pages are read from disk.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <iostream>
+#include <cstring> // For std::strcmp, used to parse command-line options
+#include <cstdlib> // For std::strtol, used to parse the window
+#include <climits> // For INT_MIN and INT_MAX, the range of a trace time
+#include "../include/TraceReader.h" // Include the indexed trace file reader
+
+using std::cout;
+using std::cerr;
+using std::endl;
+
+// Function: printUsage
+// Purpose: Prints the supported command-line arguments to standard error.
+void printUsage(const char* program) {
+    cerr << "Usage: " << program << " FILE FROM TO [--events] [--queue] [--waits]" << endl
+         << "  Reports the records of the trace FILE with FROM <= time < TO." << endl
+         << "  --events                  Print every event, service start and staffing change" << endl
+         << "  --queue                   Print the line length samples" << endl
+         << "  --waits                   Print the waits of the services started, with their mean and maximum" << endl
+         << "  Without a section option, all sections are printed." << endl;
+}
+
+// Function: parseTime
+// Purpose: Parses a whole string as a trace time.
+bool parseTime(const char* text, int& value) {
+    char* end = nullptr;
+    long parsed = std::strtol(text, &end, 10);
+    if (end == text || *end != '\0' || parsed < INT_MIN || parsed > INT_MAX) {
+        return false;
+    }
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+// Function: typeName
+// Purpose: Returns the name printed for a record type.
+const char* typeName(std::uint16_t type) {
+    switch (type) {
+        case TraceRecord::ARRIVAL:
+            return "arrival";
+        case TraceRecord::DEPARTURE:
+            return "departure";
+        case TraceRecord::SERVICE_START:
+            return "service";
+        case TraceRecord::STAFFING:
+            return "staffing";
+        default:
+            return "unknown";
+    }
+}
+
+// Function: printEvents
+// Purpose: Outputs every record of the window.
+void printEvents(const TraceReader::Range& range) {
+    cout << "Events:" << endl;
+    for (const TraceRecord* entry = range.begin; entry != range.end; entry++) {
+        cout << "    " << entry->time << " " << typeName(entry->type);
+        switch (entry->type) {
+            case TraceRecord::ARRIVAL:
+                cout << " length " << entry->value;
+                break;
+            case TraceRecord::SERVICE_START:
+                cout << " wait " << entry->value;
+                break;
+            case TraceRecord::STAFFING:
+                cout << " tellers " << entry->value;
+                break;
+        }
+        cout << " (line " << entry->lineLength << ", busy " << entry->tellersBusy << ")" << endl;
+    }
+}
+
+// Function: printQueueLengths
+// Purpose: Outputs the line length at the start of the window (from the last earlier record) and every
+//          change of it inside the window, as "time length" samples.
+void printQueueLengths(const TraceReader& reader, const TraceReader::Range& range, int from) {
+    cout << "Queue Length:" << endl;
+    const TraceRecord* previous = reader.before(range);
+    unsigned int length = (previous == nullptr) ? 0 : previous->lineLength;
+    cout << "    " << from << " " << length << endl;
+    for (const TraceRecord* entry = range.begin; entry != range.end; entry++) {
+        if (entry->lineLength != length) {
+            length = entry->lineLength;
+            cout << "    " << entry->time << " " << length << endl;
+        }
+    }
+}
+
+// Function: printWaits
+// Purpose: Outputs the wait of every service started in the window and their count, mean and maximum.
+void printWaits(const TraceReader::Range& range) {
+    cout << "Waits:" << endl;
+    unsigned long long count = 0;
+    long long total = 0;
+    int longest = 0;
+    for (const TraceRecord* entry = range.begin; entry != range.end; entry++) {
+        if (entry->type == TraceRecord::SERVICE_START) {
+            cout << "    " << entry->time << " " << entry->value << endl;
+            count++;
+            total += entry->value;
+            longest = (count == 1 || entry->value > longest) ? entry->value : longest;
+        }
+    }
+    cout << "    Count: " << count << endl;
+    cout << "    Mean: " << (count == 0 ? 0.0 : static_cast<double>(total) / count) << endl;
+    cout << "    Max: " << longest << endl;
+}
+
+// Main function
+int main(int argc, char* argv[]) {
+    int from = 0;
+    int to = 0;
+    if (argc < 4 || !parseTime(argv[2], from) || !parseTime(argv[3], to)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    bool events = false;
+    bool queue = false;
+    bool waits = false;
+    for (int i = 4; i < argc; i++) {
+        if (std::strcmp(argv[i], "--events") == 0) {
+            events = true;
+        } else if (std::strcmp(argv[i], "--queue") == 0) {
+            queue = true;
+        } else if (std::strcmp(argv[i], "--waits") == 0) {
+            waits = true;
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (!events && !queue && !waits) {
+        events = queue = waits = true;
+    }
+
+    TraceReader reader;
+    if (!reader.open(argv[1])) {
+        cerr << reader.getError() << endl;
+        return 1;
+    }
+    TraceReader::Range range = reader.query(from, to);
+
+    if (events) {
+        printEvents(range);
+    }
+    if (queue) {
+        printQueueLengths(reader, range, from);
+    }
+    if (waits) {
+        printWaits(range);
+    }
+    return 0;
+}
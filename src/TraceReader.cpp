@@ -0,0 +1,137 @@
+/*
+ * TraceReader.cpp
+ *
+ * Description: This file implements the TraceReader class with POSIX mmap. The mapping is read-only and
+ *              shared, so several readers of one file share the page cache.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "../include/TraceReader.h"
+
+// Constructor
+TraceReader::TraceReader()
+    : mapping(nullptr), mappingSize(0), header(nullptr), records(nullptr), index(nullptr) {}
+
+// Destructor
+TraceReader::~TraceReader() {
+    close();
+}
+
+// open
+// Description: Maps the whole file and validates the header against the file size before any record is used.
+bool TraceReader::open(const std::string& path) {
+    close();
+
+    int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return fail("cannot open " + path);
+    }
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(TraceHeader)) {
+        ::close(descriptor);
+        return fail(path + " is not a trace file");
+    }
+    mappingSize = static_cast<std::size_t>(status.st_size);
+    mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, descriptor, 0);
+    ::close(descriptor);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        return fail("cannot map " + path);
+    }
+
+    header = static_cast<const TraceHeader*>(mapping);
+    if (std::memcmp(header->magic, TRACE_MAGIC, sizeof(header->magic)) != 0 || header->version != TRACE_VERSION ||
+        header->blockSize == 0) {
+        close();
+        return fail(path + " is not a trace file of version " + std::to_string(TRACE_VERSION));
+    }
+    const std::uint64_t expectedBlocks = (header->recordCount + header->blockSize - 1) / header->blockSize;
+    const std::uint64_t expectedSize = sizeof(TraceHeader) + header->recordCount * sizeof(TraceRecord) +
+                                       header->indexCount * sizeof(std::int32_t);
+    if (header->indexCount != expectedBlocks || header->indexOffset != sizeof(TraceHeader) + header->recordCount * sizeof(TraceRecord) ||
+        expectedSize != mappingSize) {
+        close();
+        return fail(path + " is incomplete or damaged");
+    }
+
+    const char* bytes = static_cast<const char*>(mapping);
+    records = reinterpret_cast<const TraceRecord*>(bytes + sizeof(TraceHeader));
+    index = reinterpret_cast<const std::int32_t*>(bytes + header->indexOffset);
+    return true;
+}
+
+// close
+void TraceReader::close() {
+    if (mapping != nullptr) {
+        munmap(mapping, mappingSize);
+    }
+    mapping = nullptr;
+    mappingSize = 0;
+    header = nullptr;
+    records = nullptr;
+    index = nullptr;
+}
+
+// getError
+const std::string& TraceReader::getError() const {
+    return error;
+}
+
+// getRecordCount
+std::uint64_t TraceReader::getRecordCount() const {
+    return header->recordCount;
+}
+
+// getBlockSize
+std::uint32_t TraceReader::getBlockSize() const {
+    return header->blockSize;
+}
+
+// getAll
+TraceReader::Range TraceReader::getAll() const {
+    return Range{records, records + header->recordCount};
+}
+
+// query
+// Description: Every record of the blocks before the last block starting before from is earlier than from,
+//              so the window starts in that block or at the start of the next one; the window then ends at
+//              the first record at or after to.
+TraceReader::Range TraceReader::query(int from, int to) const {
+    const TraceRecord* end = records + header->recordCount;
+    if (from >= to) {
+        return Range{end, end};
+    }
+
+    const std::int32_t* indexEnd = index + header->indexCount;
+    std::size_t block = static_cast<std::size_t>(std::lower_bound(index, indexEnd, from) - index);
+    const TraceRecord* first = records + (block > 0 ? block - 1 : 0) * static_cast<std::size_t>(header->blockSize);
+    while (first != end && first->time < from) {
+        first++;
+    }
+
+    const TraceRecord* last = first;
+    while (last != end && last->time < to) {
+        last++;
+    }
+    return Range{first, last};
+}
+
+// before
+const TraceRecord* TraceReader::before(const Range& range) const {
+    return (range.begin == records) ? nullptr : range.begin - 1;
+}
+
+// Utility method
+// Description: Records the reason of a failed open() and returns false.
+bool TraceReader::fail(const std::string& message) {
+    error = message;
+    return false;
+}
@@ -0,0 +1,96 @@
+/*
+ * TraceWriter.cpp
+ *
+ * Description: This file implements the TraceWriter class. The header is written twice: a provisional one
+ *              when the file is created, so that the records start at the right offset, and the final one
+ *              (with the record count and the index position) by finish().
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <algorithm>
+#include <cstring>
+#include "../include/TraceWriter.h"
+
+namespace {
+
+// Returns a header for the given counts
+TraceHeader makeHeader(std::uint32_t blockSize, std::uint64_t recordCount, std::uint64_t indexCount) {
+    TraceHeader header;
+    std::memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+    header.version = TRACE_VERSION;
+    header.blockSize = blockSize;
+    header.recordCount = recordCount;
+    header.indexOffset = sizeof(TraceHeader) + recordCount * sizeof(TraceRecord);
+    header.indexCount = indexCount;
+    return header;
+}
+
+}  // namespace
+
+// Constructor
+TraceWriter::TraceWriter(std::FILE* out, std::uint32_t blockSize, std::size_t bufferSize)
+    : out(out), blockSize(std::max<std::uint32_t>(blockSize, 1)), buffer(std::max<std::size_t>(bufferSize, 1)),
+      used(0), recordCount(0), finished(false), failed(false) {
+    TraceHeader header = makeHeader(this->blockSize, 0, 0);
+    failed = std::fwrite(&header, sizeof(header), 1, out) != 1;
+}
+
+// Destructor
+TraceWriter::~TraceWriter() {
+    finish();
+}
+
+// record
+void TraceWriter::record(TraceRecord::Type type, int time, int value, unsigned int lineLength, int tellersBusy) {
+    if (recordCount % blockSize == 0) {
+        blockTimes.push_back(time);
+    }
+    TraceRecord& entry = buffer[used++];
+    entry.time = time;
+    entry.type = type;
+    entry.tellersBusy = static_cast<std::uint16_t>(std::min(tellersBusy, 65535));
+    entry.lineLength = lineLength;
+    entry.value = value;
+    recordCount++;
+    if (used == buffer.size()) {
+        writeBuffer();
+    }
+}
+
+// finish
+// Description: The index follows the last record; the header is then rewritten in place.
+bool TraceWriter::finish() {
+    if (finished) {
+        return !failed;
+    }
+    finished = true;
+    writeBuffer();
+    if (!blockTimes.empty() &&
+        std::fwrite(blockTimes.data(), sizeof(std::int32_t), blockTimes.size(), out) != blockTimes.size()) {
+        failed = true;
+    }
+    TraceHeader header = makeHeader(blockSize, recordCount, blockTimes.size());
+    if (std::fseek(out, 0, SEEK_SET) != 0 || std::fwrite(&header, sizeof(header), 1, out) != 1) {
+        failed = true;
+    }
+    if (std::fflush(out) != 0) {
+        failed = true;
+    }
+    return !failed;
+}
+
+// getRecordCount
+std::uint64_t TraceWriter::getRecordCount() const {
+    return recordCount;
+}
+
+// Utility method
+// Description: Writes the buffered records to the file.
+void TraceWriter::writeBuffer() {
+    if (used > 0 && std::fwrite(buffer.data(), sizeof(TraceRecord), used, out) != used) {
+        failed = true;
+    }
+    used = 0;
+}
@@ -0,0 +1,130 @@
+/*
+ * WhatIfAnalysis.cpp
+ *
+ * Description: This file implements the WhatIfAnalysis class. The baseline run is advanced one event at a
+ *              time; whenever the next event crosses a snapshot boundary (a multiple of snapshotInterval)
+ *              the simulation object is copied. A scenario is answered by copying the latest usable
+ *              snapshot, installing the scenario's staffing schedule and running the copy to completion.
+ *
+ *              A snapshot taken at boundary S has processed only events before S and applied only the
+ *              staffing changes before S, so it is valid for every scenario whose schedule matches the
+ *              baseline schedule before S.
+ *
+ * Author: Kunpeng (Andy) Zhang
+ * Last Modified: Oct. 2026
+ */
+
+#include <climits>
+#include "../include/WhatIfAnalysis.h"
+
+namespace {
+
+// Returns the first multiple of interval strictly greater than time (also for negative times)
+int nextBoundaryAfter(int time, int interval) {
+    int remainder = time % interval;
+    if (remainder < 0) {
+        remainder += interval;
+    }
+    return time - remainder + interval;
+}
+
+}  // namespace
+
+// Constructor
+// Description: Records the inputs; the initial state is the first snapshot.
+WhatIfAnalysis::WhatIfAnalysis(const std::vector<Event>& arrivals, int tellers,
+                               const std::vector<StaffingChange>& baseline, int snapshotInterval)
+    : arrivals(arrivals), baseline(baseline), tellers(tellers), snapshotInterval(snapshotInterval),
+      baselineResult(arrivals, tellers, BankSimulation::ArrivalMode::STREAM) {
+    baselineResult.setStaffingSchedule(&baseline);
+}
+
+// runBaseline
+// Description: Runs the baseline to completion, copying the simulation state at each snapshot boundary.
+// Time Efficiency: O(n log t) for the simulation plus the size of the snapshots
+const BankSimulation& WhatIfAnalysis::runBaseline(bool logEvents, EventLogWriter* asyncLog) {
+    BankSimulation simulation(arrivals, tellers, BankSimulation::ArrivalMode::STREAM);
+    simulation.setStaffingSchedule(&baseline);
+
+    snapshots.clear();
+    snapshotTimes.clear();
+    snapshots.push_back(simulation);
+    snapshotTimes.push_back(INT_MIN);
+
+    simulation.setEventLog(logEvents, asyncLog);
+    bool first = true;
+    int nextBoundary = 0;
+
+    while (simulation.hasPendingEvents()) {
+        int nextTime = simulation.getNextEventTime();
+        if (first) {
+            nextBoundary = nextBoundaryAfter(nextTime, snapshotInterval);
+            first = false;
+        } else if (nextTime >= nextBoundary) {
+            // Label the snapshot with the latest boundary not after the next event
+            int boundary = nextBoundaryAfter(nextTime, snapshotInterval) - snapshotInterval;
+            snapshots.push_back(simulation);
+            snapshots.back().setEventLog(false);
+            snapshotTimes.push_back(boundary);
+            nextBoundary = boundary + snapshotInterval;
+        }
+        simulation.step();
+    }
+
+    simulation.setEventLog(false);
+    baselineResult = simulation;
+    return baselineResult;
+}
+
+// evaluate
+// Description: Resumes scenario from the latest snapshot at or before its divergence point.
+// Time Efficiency: O(log s) to find the snapshot, plus the cost of simulating the remainder of the day
+WhatIfAnalysis::Result WhatIfAnalysis::evaluate(const std::vector<StaffingChange>& scenario) const {
+    int divergence = findDivergence(scenario);
+
+    // Binary search for the last snapshot taken at or before the divergence point
+    unsigned int low = 0;
+    unsigned int high = static_cast<unsigned int>(snapshotTimes.size());
+    while (high - low > 1) {
+        unsigned int middle = low + (high - low) / 2;
+        if (snapshotTimes[middle] <= divergence) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+
+    Result result = { snapshots[low], snapshotTimes[low], 0 };
+    unsigned long long eventsBefore = result.simulation.getEventsProcessed();
+    result.simulation.setStaffingSchedule(&scenario);
+    result.simulation.run();
+    result.eventsResimulated = result.simulation.getEventsProcessed() - eventsBefore;
+    return result;
+}
+
+// getSnapshotCount
+unsigned int WhatIfAnalysis::getSnapshotCount() const {
+    return static_cast<unsigned int>(snapshots.size());
+}
+
+// Utility method
+// Description: Walks both schedules in step and returns the time of the first entry that differs,
+//              or INT_MAX if the schedules are identical.
+int WhatIfAnalysis::findDivergence(const std::vector<StaffingChange>& schedule) const {
+    std::size_t index = 0;
+    while (index < schedule.size() && index < baseline.size()) {
+        const StaffingChange& ours = baseline[index];
+        const StaffingChange& theirs = schedule[index];
+        if (ours.time != theirs.time || ours.tellers != theirs.tellers) {
+            return ours.time < theirs.time ? ours.time : theirs.time;
+        }
+        index++;
+    }
+    if (index < baseline.size()) {
+        return baseline[index].time;
+    }
+    if (index < schedule.size()) {
+        return schedule[index].time;
+    }
+    return INT_MAX;
+}
@@ -0,0 +1,733 @@
+"""
+Differential Validation Harness for the Bank Simulation
+
+Description:
+This script checks every simulation engine and container combination of the BankSim executable against
+the others on randomly generated traces. The hand-written tests only cover three small inputs; this
+harness generates thousands of traces of varying size, load and tie density and compares the outputs
+exactly, so that optimized engines can be trusted as soon as they agree with the reference engines.
+
+Key Features:
+- **Random Traces:** Each case draws a number of customers, a load (service time relative to the mean
+  gap between arrivals), a time resolution (coarse resolutions produce many simultaneous events), a
+  number of tellers and optionally a staffing schedule.
+
+- **Engine Groups:** Engines that must produce byte-identical output (event log and statistics) are
+  grouped. The canonical group processes simultaneous events arrivals first in input order
+  (--stream-arrivals and everything built on it); the legacy group preloads arrivals into the heap and
+  keeps the original tie order. The groups are also compared with each other where their orders must
+  agree (no two arrivals at the same time), and derived results are checked against direct runs:
+  --what-if against a run with the scenario as staffing schedule, --replications against a single run,
+  --interval row totals against the final statistics, and every branch of --branches against a direct
+  run of its customers. The --customer-stats kernels (scalar, AVX2, AVX-512) are compared with each other,
+  TraceQuery windows of a --trace file are checked against the whole trace, and the interruptible
+  simulation without effective interruptions is checked against --stream-arrivals, and so are the
+  appointment simulation when appointments arrive on time and get no priority, and the generic
+  --kernel on each of its event sets. The --fluid approximation is compared with --stream-arrivals
+  within tolerances, on the sample input and on days of many branches under light and heavy load.
+  --scenario must find no difference between a scenario and itself under common random numbers, and the
+  --tail-wait estimate must cover the M/M/c closed form within a few of its confidence half-widths.
+
+- **Shrinking:** When two runs disagree, the trace is reduced automatically (removing chunks of
+  customers, then simplifying times and lengths) while the disagreement persists. The minimal
+  reproducer is printed and saved, together with the command lines of the two runs.
+
+Usage:
+    python3 differential.py [--cases N] [--seed S] [--max-customers N] [--executable PATH]
+
+The script exits with status 0 if every case agreed, and 1 otherwise.
+
+Author: Andy Zhang
+Last Modified: Oct. 2026
+
+"""
+
+import argparse
+import math
+import os
+import random
+import shutil
+import subprocess
+import sys
+import tempfile
+
+SCRIPT_DIRECTORY = os.path.dirname(os.path.abspath(__file__))
+
+# Seconds after which a run is taken to hang
+RUN_TIMEOUT = 60
+
+# Offset of the traces checked late in the int range, past half of INT_MAX
+LATE_TIME = 1100000000
+
+# Branches of the days that check the fluid approximation, and the relative errors of its average wait that
+# are accepted: of the heavily loaded sample input; of many branches under heavy load; under light load,
+# relative to the mean transaction length; and of one day scaled, whose own randomness the fluid limit lacks
+FLUID_BRANCHES = 50
+FLUID_SAMPLE_TOLERANCE = 0.1
+FLUID_HEAVY_TOLERANCE = 0.05
+FLUID_LIGHT_TOLERANCE = 0.05
+FLUID_SCALE_TOLERANCE = 0.25
+
+# Loads of the M/M/c models that check --tail-wait, and the number of reported 95% half-widths the estimate
+# may be from the closed form (its 10 runs make the half-width itself uncertain)
+TAIL_LOADS = [0.5, 0.6, 0.7, 0.8]
+TAIL_HALF_WIDTHS = 4
+
+# Engines whose complete output must be identical within a group. Engines marked "bounded" may refuse a
+# trace that does not fit their fixed capacities; such a run is skipped rather than reported.
+ENGINE_GROUPS = {
+    "legacy": [
+        {"name": "preload", "flags": []},
+        {"name": "preload-async", "flags": ["--async-log", "--log-ring=2"]},
+        {"name": "preload-noshrink", "flags": ["--heap-shrink=0"]},
+        {"name": "preload-shrink3", "flags": ["--heap-shrink=3"]},
+    ],
+    "canonical": [
+        {"name": "stream", "flags": ["--stream-arrivals"]},
+        {"name": "stream-batch", "flags": ["--stream-arrivals", "--batch-events"]},
+        {"name": "stream-async", "flags": ["--stream-arrivals", "--async-log", "--log-ring=2"]},
+        {"name": "fixed", "flags": ["--fixed-capacity"], "bounded": True},
+        {"name": "fixed-batch", "flags": ["--fixed-capacity", "--batch-events"], "bounded": True},
+        {"name": "loser-tree", "flags": ["--loser-tree"]},
+        {"name": "loser-tree-batch", "flags": ["--loser-tree", "--batch-events"]},
+    ],
+}
+
+
+class Mismatch(Exception):
+    """Describes two runs that must agree but do not, and the check that found them."""
+
+    def __init__(self, description, first, second, check):
+        super().__init__(description)
+        self.description = description
+        self.first = first
+        self.second = second
+        self.check = check
+
+
+class Run:
+    """The command line and output of one execution of the simulation."""
+
+    def __init__(self, executable, flags, trace):
+        self.flags = flags
+        self.command = [executable] + flags
+        try:
+            process = subprocess.run(self.command, input=format_trace(trace).encode(),
+                                     stdout=subprocess.PIPE, stderr=subprocess.PIPE, timeout=RUN_TIMEOUT)
+        except subprocess.TimeoutExpired as expired:
+            self.returncode = None
+            self.stdout = (expired.stdout or b"").decode()
+            self.stderr = "timed out after %d s" % RUN_TIMEOUT
+            return
+        self.returncode = process.returncode
+        self.stdout = process.stdout.decode()
+        self.stderr = process.stderr.decode()
+
+    def refused(self):
+        """Returns True if a bounded engine reported that the trace exceeds its capacity."""
+        return self.returncode != 0 and "FullDataCollectionException" in self.stderr
+
+    def log(self):
+        """Returns the event log lines."""
+        return [line for line in self.stdout.splitlines() if line.startswith("Processing")]
+
+    def section(self, title):
+        """Returns the statistic lines following the given title line (e.g. "Final Statistics:")."""
+        lines = self.stdout.splitlines()
+        if title not in lines:
+            return []
+        result = []
+        for line in lines[lines.index(title) + 1:]:
+            if line.endswith("Statistics:"):
+                break
+            if line.strip():
+                result.append(line.strip())
+        return result
+
+    def statistics(self):
+        """Returns the final statistics lines."""
+        return self.section("Final Statistics:")
+
+    def describe(self):
+        return " ".join(self.command)
+
+
+def format_trace(trace):
+    """Formats a trace (a list of (arrival time, transaction length) pairs, or of (branch, arrival time,
+    transaction length) triples for --branches) as simulation input."""
+    return "".join(" ".join("%d" % value for value in customer) + "\n" for customer in trace)
+
+
+def generate_case(rng, max_customers):
+    """Draws a random scenario: trace, initial tellers and staffing schedule."""
+    size = int(max_customers ** rng.random())
+    tellers = rng.choice([1, 1, 2, 3, 5])
+    resolution = rng.choice([1, 1, 5, 60])
+    load = rng.choice([0.3, 0.8, 1.0, 1.5, 4.0])
+    mean_gap = rng.choice([1, 3, 10])
+    mean_length = max(1, int(load * mean_gap * tellers))
+
+    trace = []
+    time = 0
+    for _ in range(size):
+        time += int(rng.expovariate(1.0 / mean_gap))
+        arrival = (time // resolution) * resolution
+        length = rng.choice([0, 1]) if rng.random() < 0.05 else 1 + int(rng.expovariate(1.0 / mean_length))
+        trace.append((arrival, length))
+
+    staffing = []
+    if rng.random() < 0.4 and trace:
+        end = trace[-1][0] + 1
+        for _ in range(rng.randint(1, 3)):
+            staffing.append((rng.randint(0, end), rng.randint(0, 4)))
+        staffing.sort()
+        # Keep at least one teller on duty at the end so the day can finish
+        staffing.append((end, max(1, tellers)))
+    return trace, tellers, staffing
+
+
+def scenario_flags(tellers, staffing):
+    flags = ["--tellers=%d" % tellers]
+    if staffing:
+        flags.append("--staffing=" + ",".join("%d:%d" % change for change in staffing))
+    return flags
+
+
+def compare_engines(first, second):
+    """Returns a check that compares the complete output of the engines first and second."""
+
+    def check(executable, trace, tellers, staffing, workdir):
+        common = scenario_flags(tellers, staffing)
+        runs = []
+        for engine in (first, second):
+            run = Run(executable, engine["flags"] + common, trace)
+            if engine.get("bounded") and run.refused():
+                return None
+            runs.append(run)
+        for engine, run in zip((first, second), runs):
+            if run.returncode != 0:
+                return Mismatch("%s exited with status %d: %s" % (engine["name"], run.returncode, run.stderr.strip()),
+                                run, run, check)
+        if runs[0].stdout != runs[1].stdout:
+            return Mismatch("%s and %s differ" % (first["name"], second["name"]), runs[0], runs[1], check)
+        return None
+
+    return check
+
+
+def check_groups(executable, trace, tellers, staffing, workdir):
+    """Compares every engine with the first engine of its group."""
+    for engines in ENGINE_GROUPS.values():
+        for engine in engines[1:]:
+            mismatch = compare_engines(engines[0], engine)(executable, trace, tellers, staffing, workdir)
+            if mismatch:
+                return mismatch
+    return None
+
+
+def check_across_groups(executable, trace, tellers, staffing, workdir):
+    """Compares the legacy and canonical reference engines where their results must agree."""
+    common = scenario_flags(tellers, staffing)
+    legacy = Run(executable, ENGINE_GROUPS["legacy"][0]["flags"] + common, trace)
+    canonical = Run(executable, ENGINE_GROUPS["canonical"][0]["flags"] + common, trace)
+
+    # Both groups see every customer and process the same number of events
+    if legacy.statistics()[:1] != canonical.statistics()[:1] or len(legacy.log()) != len(canonical.log()):
+        return Mismatch("legacy and canonical engines processed different events", legacy, canonical,
+                        check_across_groups)
+
+    # Without simultaneous arrivals, customers are served in the same order by both groups, so the
+    # statistics and the events (up to the order of simultaneous events) agree
+    arrival_times = [customer[0] for customer in trace]
+    if len(set(arrival_times)) == len(arrival_times):
+        if legacy.statistics() != canonical.statistics() or sorted(legacy.log()) != sorted(canonical.log()):
+            return Mismatch("legacy and canonical engines differ on a trace without simultaneous arrivals",
+                            legacy, canonical, check_across_groups)
+    return None
+
+
+def check_what_if(executable, trace, tellers, staffing, workdir):
+    """Checks that a what-if scenario resumed from a snapshot equals a full run of that scenario."""
+    if not trace:
+        return None
+    scenario = staffing or [(trace[len(trace) // 2][0], tellers + 1)]
+    scenario_text = ",".join("%d:%d" % change for change in scenario)
+    what_if = Run(executable, ["--quiet", "--what-if=" + scenario_text, "--snapshot-interval=7",
+                               "--tellers=%d" % tellers], trace)
+    direct = Run(executable, ["--quiet", "--stream-arrivals", "--staffing=" + scenario_text,
+                              "--tellers=%d" % tellers], trace)
+    if what_if.section("What-If Statistics:")[:2] != direct.statistics():
+        return Mismatch("--what-if differs from a direct run of the scenario", what_if, direct, check_what_if)
+    return None
+
+
+def check_replications(executable, trace, tellers, staffing, workdir):
+    """Checks that replications on several threads, shared or pinned with node-local copies of the input and
+    staffing schedule, reproduce a single run."""
+    common = scenario_flags(tellers, staffing)
+    single = Run(executable, ["--quiet"] + common, trace)
+    for flags in ([], ["--numa", "--huge-pages"]):
+        replicated = Run(executable, ["--replications=3", "--threads=2"] + flags + common, trace)
+        if replicated.statistics() != single.statistics():
+            return Mismatch("--replications differs from a single run", single, replicated, check_replications)
+    return None
+
+
+def check_intervals(executable, trace, tellers, staffing, workdir):
+    """Checks that the interval rows account for every customer."""
+    common = scenario_flags(tellers, staffing)
+    interval_file = os.path.join(workdir, "intervals.csv")
+    run = Run(executable, ["--quiet", "--stream-arrivals", "--interval=13", "--interval-file=" + interval_file] + common,
+              trace)
+    with open(interval_file) as rows:
+        arrivals = sum(int(row.split(",")[2]) for row in rows.readlines()[1:])
+    if arrivals != len(trace):
+        return Mismatch("interval rows count %d arrivals instead of %d" % (arrivals, len(trace)), run, run,
+                        check_intervals)
+    return None
+
+
+def check_branches(executable, trace, tellers, staffing, workdir):
+    """Checks that every branch simulated by --branches matches a direct run of its own customers."""
+    if staffing or not trace:
+        return None
+    branch_count = min(1 + len(trace) % 4, len(trace))
+    branch_of = [(index * 7) % branch_count for index in range(len(trace))]
+    pooled = Run(executable, ["--branches", "--sweep=5", "--tellers=%d" % tellers],
+                 [(branch,) + customer for branch, customer in zip(branch_of, trace)])
+    rows = [line.split() for line in pooled.section("Branch Statistics:")[1:] if not line.startswith("Total")]
+    for branch in range(branch_count):
+        customers = [customer for index, customer in enumerate(trace) if branch_of[index] == branch]
+        direct = Run(executable, ["--quiet", "--stream-arrivals", "--tellers=%d" % tellers], customers)
+        expected = [line.split(": ")[1] for line in direct.statistics()]
+        if branch >= len(rows) or rows[branch][1:3] != expected:
+            return Mismatch("--branches differs from a direct run of branch %d" % branch, pooled, direct,
+                            check_branches)
+    return None
+
+
+def check_customer_statistics(executable, trace, tellers, staffing, workdir):
+    """Checks that every statistics kernel gives the same customer statistics, and that their mean wait is
+    the average wait of the final statistics."""
+    common = ["--quiet", "--customer-stats", "--wait-threshold=3", "--histogram-bin=7"] + scenario_flags(tellers, staffing)
+    runs = [Run(executable, common + ["--stats-kernel=" + kernel], trace) for kernel in ("scalar", "avx2", "avx512")]
+    # The last line names the kernel used
+    sections = [run.section("Customer Statistics:")[:-1] for run in runs]
+    for run, section in zip(runs[1:], sections[1:]):
+        if section != sections[0]:
+            return Mismatch("statistics kernels disagree", runs[0], run, check_customer_statistics)
+    # The final statistics print the average wait as a float, so the two agree to its precision only
+    average = float(runs[0].statistics()[1].split(": ")[1])
+    if trace and abs(float(sections[0][1].split(": ")[1]) - average) > 1e-5 * max(1.0, average):
+        return Mismatch("customer statistics disagree with the final statistics", runs[0], runs[0],
+                        check_customer_statistics)
+    return None
+
+
+def check_trace(executable, trace, tellers, staffing, workdir):
+    """Checks that the trace file holds one arrival per customer, and that two adjacent TraceQuery windows
+    return exactly the events of the window covering both."""
+    query = os.path.join(os.path.dirname(os.path.abspath(executable)), "TraceQuery")
+    trace_file = os.path.join(workdir, "trace.bin")
+    run = Run(executable, ["--quiet", "--stream-arrivals", "--trace=" + trace_file, "--trace-block=3"]
+              + scenario_flags(tellers, staffing), trace)
+
+    def events(start, end):
+        output = subprocess.run([query, trace_file, str(start), str(end), "--events"], stdout=subprocess.PIPE)
+        return output.stdout.decode().splitlines()[1:]
+
+    # Every record happens before the last arrival or staffing change plus all transaction lengths
+    end = max([arrival for arrival, _ in trace] + [time for time, _ in staffing] + [0]) + sum(
+        length for _, length in trace) + 1
+    everything = events(-1, end)
+    arrivals = sum(1 for line in everything if line.split()[1] == "arrival")
+    if arrivals != len(trace):
+        return Mismatch("trace holds %d arrivals instead of %d" % (arrivals, len(trace)), run, run, check_trace)
+    middle = end // 3
+    if events(-1, middle) + events(middle, end) != everything:
+        return Mismatch("trace windows split at %d disagree with the whole trace" % middle, run, run, check_trace)
+    return None
+
+
+def check_interruptions(executable, trace, tellers, staffing, workdir):
+    """Checks that the interruptible simulation reproduces --stream-arrivals when no interruption takes
+    effect before the last customer leaves, under every policy."""
+    if staffing or not trace:
+        return None
+    direct = Run(executable, ["--quiet", "--stream-arrivals"] + scenario_flags(tellers, staffing), trace)
+    average = direct.statistics()[1].split(": ")[1]
+    after_day = max([arrival for arrival, _ in trace] + [0]) + sum(length for _, length in trace) + 1
+    for policy in ("resume", "restart", "finish"):
+        run = Run(executable, ["--interrupt=%d:5:%d" % (after_day, tellers), "--interrupt-policy=" + policy]
+                  + scenario_flags(tellers, staffing), trace)
+        section = run.section("Interruption Statistics:")
+        expected = ["Average wait without interruptions: " + average, "Average wait with interruptions: " + average]
+        if run.statistics() != direct.statistics() or section[5:7] != expected:
+            return Mismatch("interruptible simulation (%s) disagrees with --stream-arrivals" % policy, direct, run,
+                            check_interruptions)
+    return None
+
+
+def check_appointments(executable, trace, tellers, staffing, workdir):
+    """Checks that splitting the customers into walk-ins and on-time appointments without priority (FIFO)
+    gives the statistics of --stream-arrivals on all customers, appointments first among simultaneous
+    arrivals."""
+    if staffing or not trace:
+        return None
+    ordered = sorted(enumerate(trace), key=lambda item: item[1][0])
+    appointments = [customer for index, customer in ordered if index % 2 == 1]
+    walk_ins = [customer for index, customer in ordered if index % 2 == 0]
+    merged = sorted(appointments + walk_ins, key=lambda customer: customer[0])
+    bookings = os.path.join(workdir, "appointments.txt")
+    with open(bookings, "w") as sheet:
+        sheet.write(format_trace(appointments))
+    direct = Run(executable, ["--quiet", "--stream-arrivals"] + scenario_flags(tellers, staffing), merged)
+    run = Run(executable, ["--appointments=" + bookings, "--appointment-priority=fifo"]
+              + scenario_flags(tellers, staffing), walk_ins)
+    if run.statistics() != direct.statistics():
+        return Mismatch("appointment simulation disagrees with --stream-arrivals", direct, run, check_appointments)
+    return None
+
+
+def check_network(executable, trace, tellers, staffing, workdir):
+    """Checks that a network whose first station has the tellers, and whose routes to a second station are
+    never taken, gives the statistics of --stream-arrivals."""
+    if staffing or not trace:
+        return None
+    network = os.path.join(workdir, "network.txt")
+    with open(network, "w") as stations:
+        stations.write("station teller %d 5\nstation loans 1 10\nroute teller loans 0\n" % tellers)
+    direct = Run(executable, ["--quiet", "--stream-arrivals"] + scenario_flags(tellers, staffing), trace)
+    run = Run(executable, ["--network=" + network], trace)
+    if run.statistics() != direct.statistics():
+        return Mismatch("network simulation disagrees with --stream-arrivals", direct, run, check_network)
+    return None
+
+
+def check_retrials(executable, trace, tellers, staffing, workdir):
+    """Checks that a line long enough for every customer blocks nobody and gives the statistics of
+    --stream-arrivals."""
+    if staffing or not trace:
+        return None
+    direct = Run(executable, ["--quiet", "--stream-arrivals"] + scenario_flags(tellers, staffing), trace)
+    run = Run(executable, ["--line-capacity=%d" % len(trace)] + scenario_flags(tellers, staffing), trace)
+    if run.statistics() != direct.statistics():
+        return Mismatch("retrial simulation disagrees with --stream-arrivals", direct, run, check_retrials)
+    # Late in the int range the retrials of a short line must still end, and serve everyone
+    late = [(arrival + LATE_TIME, length) for arrival, length in trace]
+    run = Run(executable, ["--line-capacity=1"] + scenario_flags(tellers, staffing), late)
+    counted = "Total number of people processed: %d" % len(trace)
+    if run.returncode != 0 or counted not in run.statistics():
+        return Mismatch("retrial simulation with large times does not serve everyone", run, run, check_retrials)
+    return None
+
+
+def check_analytic(executable, trace, tellers, staffing, workdir):
+    """Checks that --analytic either answers with a formula for all customers or falls back to a simulation
+    that gives the statistics of the plain run."""
+    run = Run(executable, ["--quiet", "--analytic"] + scenario_flags(tellers, staffing), trace)
+    if run.section("Analytic Statistics:"):
+        counted = "Total number of people processed: %d" % len(trace)
+        if run.returncode != 0 or counted not in run.statistics():
+            return Mismatch("analytic answer does not count every customer", run, run, check_analytic)
+        return None
+    direct = Run(executable, ["--quiet"] + scenario_flags(tellers, staffing), trace)
+    if run.statistics() != direct.statistics():
+        return Mismatch("analytic fallback disagrees with the simulation", direct, run, check_analytic)
+    return None
+
+
+def check_scenario(executable, trace, tellers, staffing, workdir):
+    """Checks that --scenario with common random numbers, plain and antithetic, finds no difference between a
+    scenario of the case and itself, and gives the same wait for both."""
+    scenario = "%d" % tellers
+    if staffing:
+        scenario += "/" + ",".join("%d:%d" % change for change in staffing)
+    common = ["--scenario=" + scenario, "--scenario=" + scenario, "--day-customers=%d" % max(2, len(trace)),
+              "--mean-service=%g" % (0.5 + len(trace) % 7), "--mean-interarrival=%g" % (1 + tellers % 3),
+              "--scenario-replications=6"]
+    for flags in ([], ["--antithetic"]):
+        run = Run(executable, common + flags, [])
+        rows = [line.split() for line in run.section("Scenario Comparison:") if line.split()[:1] in (["1"], ["2"])]
+        if run.returncode != 0 or len(rows) != 2:
+            return Mismatch("--scenario comparison did not run", run, run, check_scenario)
+        if rows[0][1:3] != rows[1][1:3] or float(rows[1][3]) != 0 or float(rows[1][4]) != 0:
+            return Mismatch("a scenario compared with itself differs from itself", run, run, check_scenario)
+    return None
+
+
+def erlang_c(tellers, offered_load):
+    """Returns the Erlang C probability that a customer of an M/M/c queue with the given offered load
+    (arrival rate over service rate) has to wait."""
+    term = 1.0
+    total = 1.0
+    for k in range(1, tellers):
+        term *= offered_load / k
+        total += term
+    waiting = term * offered_load / tellers / (1 - offered_load / tellers)
+    return waiting / (total + waiting)
+
+
+def check_tail(executable, trace, tellers, staffing, workdir):
+    """Checks the --tail-wait estimate of an M/M/c model of the case against the closed form
+    P(W > t) = C(c, a) exp(-(c mu - lambda) t), at a threshold whose exact probability is 1e-2 to 1e-4."""
+    mean_interarrival = 1 + tellers % 3
+    mean_service = TAIL_LOADS[len(trace) % len(TAIL_LOADS)] * tellers * mean_interarrival
+    decay = tellers / mean_service - 1 / mean_interarrival
+    waiting = erlang_c(tellers, mean_service / mean_interarrival)
+    threshold = math.log(waiting / 10.0 ** -(2 + len(trace) % 3)) / decay
+    exact = waiting * math.exp(-decay * threshold)
+    run = Run(executable, ["--tail-wait=%r" % threshold, "--tellers=%d" % tellers,
+                           "--mean-interarrival=%d" % mean_interarrival, "--mean-service=%r" % mean_service,
+                           "--split-seed=%d" % (len(trace) + 1)], [])
+    estimate = [line.split() for line in run.section("Tail Estimate:") if line.startswith("Splitting:")]
+    if run.returncode != 0 or not estimate:
+        return Mismatch("--tail-wait did not run", run, run, check_tail)
+    probability, half_width = float(estimate[0][1]), float(estimate[0][3])
+    if abs(probability - exact) > TAIL_HALF_WIDTHS * half_width:
+        return Mismatch("--tail-wait estimates %g +/- %g, the closed form gives %g" % (probability, half_width, exact),
+                        run, run, check_tail)
+    return None
+
+
+def check_cache(executable, trace, tellers, staffing, workdir):
+    """Checks that a run stored in the result cache and its replay both give the output of an uncached run."""
+    directory = os.path.join(workdir, "cache")
+    shutil.rmtree(directory, ignore_errors=True)
+    direct = Run(executable, scenario_flags(tellers, staffing), trace)
+    # The replay gives the options in the other order, which must key the same entry
+    for attempt, flags in (("stored", scenario_flags(tellers, staffing)),
+                           ("replayed", scenario_flags(tellers, staffing)[::-1])):
+        run = Run(executable, ["--cache-dir=" + directory] + flags, trace)
+        if run.stdout != direct.stdout:
+            return Mismatch("%s cache output disagrees with the uncached run" % attempt, direct, run, check_cache)
+    if len(os.listdir(directory)) != 1:
+        return Mismatch("reordered options were stored as a second cache entry", direct, run, check_cache)
+    return None
+
+
+def check_append(executable, trace, tellers, staffing, workdir):
+    """Checks that a trace simulated in two parts with --append-trace, and once more unchanged, gives the
+    statistics of --stream-arrivals on the whole trace. Then checks that, behind more than the hashed window of
+    leading blank space, a change that keeps the size is noticed, and so is one in a trace that also grew
+    with --verify-prefix."""
+    ordered = sorted(trace, key=lambda customer: customer[0])
+    path = os.path.join(workdir, "growing.txt")
+    for suffix in ("", ".checkpoint"):
+        if os.path.exists(path + suffix):
+            os.remove(path + suffix)
+    direct = Run(executable, ["--quiet", "--stream-arrivals"] + scenario_flags(tellers, staffing), ordered)
+    flags = ["--append-trace=" + path] + scenario_flags(tellers, staffing)
+    for customers in (len(ordered) // 2, len(ordered), len(ordered)):
+        with open(path, "w") as growing:
+            growing.write(format_trace(ordered[:customers]))
+        run = Run(executable, flags, [])
+        if customers > len(ordered) // 2 and "Resumed from the checkpoint" not in run.stdout:
+            return Mismatch("appended trace was not resumed", direct, run, check_append)
+    if run.statistics() != direct.statistics():
+        return Mismatch("appended trace disagrees with --stream-arrivals", direct, run, check_append)
+
+    os.remove(path + ".checkpoint")
+    blank = " " * (APPEND_WINDOW + 1)
+    for text, verify, expected in ((blank + format_trace(ordered[:len(ordered) // 2]), False, "Simulated"),
+                                   ("\n" + blank[1:] + format_trace(ordered[:len(ordered) // 2]), False,
+                                    "the trace was modified before its end"),
+                                   (blank + format_trace(ordered), True, "the trace was modified before its end"),
+                                   (blank + format_trace(ordered), True, "Resumed from the checkpoint")):
+        with open(path, "w") as growing:
+            growing.write(text)
+        run = Run(executable, flags + (["--verify-prefix"] if verify else []), [])
+        if expected not in run.stdout:
+            return Mismatch("appended trace with a changed prefix: expected \"%s\"" % expected, run, run,
+                            check_append)
+    if run.statistics() != direct.statistics():
+        return Mismatch("verified appended trace disagrees with --stream-arrivals", direct, run, check_append)
+    return None
+
+
+def rush_day(rng, rush_gap, calm_gap, mean_length, rush_end=600, end=1800):
+    """Draws a day of Poisson arrivals with mean gap rush_gap until rush_end and calm_gap after, and
+    transaction lengths of about mean_length."""
+    day, time = [], 0.0
+    while True:
+        time += rng.expovariate(1.0 / (rush_gap if time < rush_end else calm_gap))
+        if time >= end:
+            return day
+        day.append((int(time), 1 + int(rng.expovariate(1.0 / mean_length))))
+
+
+def average_wait(run):
+    """Returns the average wait of the final statistics of run, or None if there is none."""
+    for line in run.statistics():
+        if line.startswith("Average amount of time spent waiting:"):
+            return float(line.split(":")[1])
+    return None
+
+
+def check_fluid(executable, trace, tellers, staffing, workdir):
+    """Checks that --fluid counts every customer of every scaled branch and gives fluid statistics, and that
+    its average wait is within the tolerance of the approximation of --stream-arrivals: on the heavily loaded
+    sample input, on FLUID_BRANCHES independent days merged into one bank under light and heavy load, and with
+    --fluid-scale on one day against that day repeated for every branch (which waits exactly like one day)."""
+    # The trace as given, and with every transaction of zero length (service without any queue)
+    for customers in (trace, [(arrival, 0) for arrival, _ in trace]):
+        run = Run(executable, ["--fluid", "--fluid-scale=3"] + scenario_flags(tellers, staffing), customers)
+        counted = "Total number of people processed: %d" % (3 * len(customers))
+        if run.returncode != 0 or counted not in run.statistics() or not run.section("Fluid Statistics:"):
+            return Mismatch("fluid approximation does not count every customer", run, run, check_fluid)
+
+    def compare(description, fluid_flags, fluid_trace, direct_flags, direct_trace, tolerance, scale):
+        fluid = Run(executable, ["--fluid"] + fluid_flags, fluid_trace)
+        direct = Run(executable, ["--quiet", "--stream-arrivals"] + direct_flags, direct_trace)
+        fluid_wait, direct_wait = average_wait(fluid), average_wait(direct)
+        if fluid_wait is None or direct_wait is None or abs(fluid_wait - direct_wait) > tolerance * scale(direct_wait):
+            return Mismatch("fluid wait is off %s" % description, direct, fluid, check_fluid)
+        return None
+
+    with open(os.path.join(SCRIPT_DIRECTORY, "..", "input", "sample_input_3.txt")) as sample:
+        rush = [tuple(int(value) for value in line.split()) for line in sample if line.strip()]
+    mismatch = compare("on the sample input", [], rush, [], rush, FLUID_SAMPLE_TOLERANCE, lambda wait: wait)
+    if mismatch:
+        return mismatch
+
+    # The days depend on the case, so that every case checks other ones
+    rng = random.Random(len(trace) * 7 + tellers)
+    mean_length = 4
+    tellers_flags = ["--tellers=%d" % (tellers * FLUID_BRANCHES)]
+    for load, rush_load, calm_load, tolerance, scale in (
+            ("heavy", 2.0, 0.5, FLUID_HEAVY_TOLERANCE, lambda wait: wait),
+            ("light", 0.5, 0.3, FLUID_LIGHT_TOLERANCE, lambda wait: mean_length)):
+        region = sorted(customer for _ in range(FLUID_BRANCHES)
+                        for customer in rush_day(rng, mean_length / (rush_load * tellers),
+                                                 mean_length / (calm_load * tellers), mean_length))
+        mismatch = compare("under %s load" % load, tellers_flags, region, tellers_flags, region, tolerance, scale)
+        if mismatch:
+            return mismatch
+
+    day = rush_day(rng, mean_length / (2.0 * tellers), mean_length / (0.5 * tellers), mean_length)
+    repeated = sorted(customer for customer in day for _ in range(FLUID_BRANCHES))
+    return compare("with --fluid-scale", ["--tellers=%d" % tellers, "--fluid-scale=%d" % FLUID_BRANCHES], day,
+                   tellers_flags, repeated, FLUID_SCALE_TOLERANCE, lambda wait: wait)
+
+
+def check_kernel(executable, trace, tellers, staffing, workdir):
+    """Checks that the generic kernel on every event set gives the output of a quiet --stream-arrivals run."""
+    if staffing:
+        return None
+    direct = Run(executable, ["--quiet", "--stream-arrivals"] + scenario_flags(tellers, staffing), trace)
+    for event_set in ("heap", "loser-tree", "fixed"):
+        run = Run(executable, ["--kernel=" + event_set] + scenario_flags(tellers, staffing), trace)
+        if event_set == "fixed" and run.refused():
+            continue
+        if run.stdout != direct.stdout:
+            return Mismatch("--kernel=%s disagrees with --stream-arrivals" % event_set, direct, run, check_kernel)
+    return None
+
+
+# Bytes before the checkpoint of --append-trace that are hashed without --verify-prefix
+APPEND_WINDOW = 4096
+
+
+# Every check run on each scenario, cheapest first
+CHECKS = [check_groups, check_across_groups, check_what_if, check_replications, check_intervals, check_branches,
+          check_customer_statistics, check_trace, check_interruptions, check_appointments, check_network,
+          check_retrials, check_analytic, check_scenario, check_tail, check_cache, check_append, check_fluid,
+          check_kernel]
+
+
+def run_checks(executable, trace, tellers, staffing, workdir):
+    """Returns the first Mismatch found on the scenario, or None if every check passed."""
+    for check in CHECKS:
+        mismatch = check(executable, trace, tellers, staffing, workdir)
+        if mismatch:
+            return mismatch
+    return None
+
+
+def shrink(check, executable, trace, tellers, staffing, workdir):
+    """Reduces the scenario while check keeps failing on it; returns the smallest scenario found.
+    Only the failing check is repeated, so that each attempt runs just a few simulations."""
+
+    def fails(candidate_trace, candidate_tellers, candidate_staffing):
+        return check(executable, candidate_trace, candidate_tellers, candidate_staffing, workdir) is not None
+
+    # Remove chunks of customers, halving the chunk size when no chunk can be removed
+    chunk = max(1, len(trace) // 2)
+    while chunk >= 1:
+        removed = False
+        start = 0
+        while start < len(trace):
+            candidate = trace[:start] + trace[start + chunk:]
+            if fails(candidate, tellers, staffing):
+                trace = candidate
+                removed = True
+            else:
+                start += chunk
+        if not removed:
+            chunk //= 2
+
+    # Drop staffing changes and tellers
+    for index in reversed(range(len(staffing))):
+        candidate = staffing[:index] + staffing[index + 1:]
+        if fails(trace, tellers, candidate):
+            staffing = candidate
+    while tellers > 1 and fails(trace, tellers - 1, staffing):
+        tellers -= 1
+
+    # Make times and lengths as small as possible
+    improved = True
+    while improved:
+        improved = False
+        for index in range(len(trace)):
+            arrival, length = trace[index]
+            for candidate_customer in ((arrival, min(length, 1)), (arrival, length // 2), (arrival // 2, length), (0, length)):
+                if candidate_customer == trace[index]:
+                    continue
+                candidate = trace[:index] + [candidate_customer] + trace[index + 1:]
+                if fails(candidate, tellers, staffing):
+                    trace = candidate
+                    improved = True
+                    break
+    return trace, tellers, staffing
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Differential validation of the BankSim engines.")
+    parser.add_argument("--cases", type=int, default=200, help="number of random scenarios")
+    parser.add_argument("--seed", type=int, default=1, help="seed of the first scenario")
+    parser.add_argument("--max-customers", type=int, default=2000, help="largest trace size")
+    parser.add_argument("--executable", default=os.path.join(SCRIPT_DIRECTORY, "..", "BankSim"),
+                        help="path of the BankSim executable")
+    parser.add_argument("--no-shrink", action="store_true", help="report failures without shrinking them")
+    options = parser.parse_args()
+
+    failures = 0
+    with tempfile.TemporaryDirectory() as workdir:
+        for case in range(options.cases):
+            seed = options.seed + case
+            rng = random.Random(seed)
+            trace, tellers, staffing = generate_case(rng, options.max_customers)
+            mismatch = run_checks(options.executable, trace, tellers, staffing, workdir)
+            if mismatch is None:
+                continue
+
+            failures += 1
+            print("Case %d (seed %d, %d customers) failed: %s" % (case, seed, len(trace), mismatch.description))
+            if not options.no_shrink:
+                check = mismatch.check
+                trace, tellers, staffing = shrink(check, options.executable, trace, tellers, staffing, workdir)
+                mismatch = check(options.executable, trace, tellers, staffing, workdir)
+            reproducer = os.path.join(SCRIPT_DIRECTORY, "differential_failure_%d.txt" % seed)
+            with open(reproducer, "w") as output:
+                output.write(format_trace(trace))
+            print("  Minimal reproducer (%d customers) saved to %s" % (len(trace), reproducer))
+            print("  " + mismatch.description)
+            print("  First:  " + mismatch.first.describe())
+            print("  Second: " + mismatch.second.describe())
+
+    print("%d of %d cases passed" % (options.cases - failures, options.cases))
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
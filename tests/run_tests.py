@@ -0,0 +1,183 @@
+"""
+Regression Test Runner for the Bank Simulation
+
+Description:
+This script runs the BankSim executable on every input file in the input/ directory and compares the
+output with the expected output of the same name in the output/ directory (sample_input_1.txt is
+checked against sample_output_1.txt). A new test case is added by dropping a pair of files into those
+directories; no script has to be written or changed.
+
+Key Features:
+- **Discovery:** Every input/*.txt file with a matching output/*.txt file is a test case. An input file
+  without an expected output is reported as an error.
+
+- **Parallel Execution:** The cases run in parallel, one BankSim process per case.
+
+- **Performance Budgets:** For each case the wall time and the peak resident set size (RSS) of the
+  BankSim process are measured and checked against the budget of the case in budgets.json (the
+  "default" entry applies to cases not listed). A case that exceeds its budget fails exactly like a
+  case with the wrong output, so performance regressions break the suite. A case that runs far beyond
+  its time budget is killed. On Linux the peak RSS of a child also counts the memory of the runner at
+  the moment the child was started (the pages it shared before exec), so budgets are measured against
+  the baseline printed by the runner rather than against zero.
+
+- **Output Validation:** As in the original test scripts, the outputs are compared after stripping
+  leading and trailing whitespace. On a mismatch the first differing lines are shown.
+
+Usage:
+    python3 run_tests.py [--jobs N] [--executable PATH] [--budget-scale X] [--case NAME ...]
+
+--budget-scale multiplies every time budget (e.g. 3 on a slow or heavily loaded machine).
+The script exits with status 0 if every case passed, and 1 otherwise.
+
+Author: Andy Zhang
+Last Modified: Oct. 2026
+
+"""
+
+import argparse
+import concurrent.futures
+import difflib
+import glob
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+SCRIPT_DIRECTORY = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIRECTORY = os.path.join(SCRIPT_DIRECTORY, "..")
+BUDGET_FILE = os.path.join(SCRIPT_DIRECTORY, "budgets.json")
+
+# A case still running after this many times its time budget is killed
+KILL_FACTOR = 20
+
+
+class Result:
+    """The outcome of one test case."""
+
+    def __init__(self, name):
+        self.name = name
+        self.wall_seconds = 0.0
+        self.peak_rss_kb = 0
+        self.problems = []
+
+    def passed(self):
+        return not self.problems
+
+
+def discover_cases(case_names):
+    """Returns (name, input path, expected output path or None) for every input file, sorted by name."""
+    cases = []
+    for input_path in sorted(glob.glob(os.path.join(ROOT_DIRECTORY, "input", "*.txt"))):
+        name = os.path.splitext(os.path.basename(input_path))[0]
+        if case_names and name not in case_names:
+            continue
+        output_name = os.path.basename(input_path).replace("input", "output")
+        output_path = os.path.join(ROOT_DIRECTORY, "output", output_name)
+        cases.append((name, input_path, output_path if os.path.exists(output_path) else None))
+    return cases
+
+
+def load_budgets():
+    """Returns a function mapping a case name to its budget (wall_seconds, peak_rss_mb)."""
+    with open(BUDGET_FILE) as budget_file:
+        budgets = json.load(budget_file)
+    default = budgets["default"]
+
+    def budget_of(name):
+        budget = dict(default)
+        budget.update(budgets.get("cases", {}).get(name, {}))
+        return budget
+
+    return budget_of
+
+
+def run_case(executable, name, input_path, output_path, budget, budget_scale):
+    """Runs one case and returns its Result. The process is reaped with os.wait4 so that its own peak
+    RSS is measured, not that of the whole test runner."""
+    result = Result(name)
+    if output_path is None:
+        result.problems.append("no expected output file")
+        return result
+
+    time_budget = budget["wall_seconds"] * budget_scale
+    with open(input_path) as infile, tempfile.TemporaryFile() as stdout, tempfile.TemporaryFile() as stderr:
+        start = time.perf_counter()
+        process = subprocess.Popen([executable], stdin=infile, stdout=stdout, stderr=stderr)
+        killer = threading.Timer(time_budget * KILL_FACTOR, process.kill)
+        killer.start()
+        _, status, usage = os.wait4(process.pid, 0)
+        result.wall_seconds = time.perf_counter() - start
+        killer.cancel()
+        process.returncode = os.waitstatus_to_exitcode(status)
+        result.peak_rss_kb = usage.ru_maxrss  # kilobytes on Linux
+
+        stdout.seek(0)
+        stderr.seek(0)
+        actual = stdout.read().decode()
+        errors = stderr.read().decode()
+
+    if process.returncode != 0:
+        result.problems.append("exit status %d%s" % (process.returncode, (": " + errors.strip()) if errors else ""))
+
+    with open(output_path) as expected_file:
+        expected = expected_file.read()
+    if expected.strip() != actual.strip():
+        diff = list(difflib.unified_diff(expected.strip().splitlines(), actual.strip().splitlines(),
+                                         "expected", "actual", lineterm="", n=1))
+        result.problems.append("wrong output\n" + "\n".join("      " + line for line in diff[:20]))
+
+    if result.wall_seconds > time_budget:
+        result.problems.append("wall time %.3f s over budget %.3f s" % (result.wall_seconds, time_budget))
+    if result.peak_rss_kb > budget["peak_rss_mb"] * 1024:
+        result.problems.append("peak RSS %.1f MB over budget %.1f MB"
+                               % (result.peak_rss_kb / 1024.0, budget["peak_rss_mb"]))
+    return result
+
+
+def measure_baseline():
+    """Returns the peak RSS in kilobytes reported for a child that exits at once (see Performance Budgets)."""
+    process = subprocess.Popen(["true"])
+    _, _, usage = os.wait4(process.pid, 0)
+    process.returncode = 0
+    return usage.ru_maxrss
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run the BankSim regression tests.")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count() or 1, help="number of cases run at once")
+    parser.add_argument("--executable", default=os.path.join(ROOT_DIRECTORY, "BankSim"),
+                        help="path of the BankSim executable")
+    parser.add_argument("--budget-scale", type=float, default=1.0, help="factor applied to every time budget")
+    parser.add_argument("--case", action="append", default=[], help="run only the named case (repeatable)")
+    options = parser.parse_args()
+
+    cases = discover_cases(set(options.case))
+    if not cases:
+        print("No test cases found")
+        return 1
+    budget_of = load_budgets()
+
+    with concurrent.futures.ThreadPoolExecutor(max_workers=max(1, options.jobs)) as pool:
+        futures = [pool.submit(run_case, options.executable, name, input_path, output_path,
+                               budget_of(name), options.budget_scale)
+                   for name, input_path, output_path in cases]
+        results = [future.result() for future in futures]
+
+    print("Peak RSS baseline of a child process: %.1f MB" % (measure_baseline() / 1024.0))
+    for result in results:
+        print("%-4s %-24s %8.3f s %8.1f MB" % ("PASS" if result.passed() else "FAIL", result.name,
+                                              result.wall_seconds, result.peak_rss_kb / 1024.0))
+        for problem in result.problems:
+            print("     " + problem)
+
+    failures = sum(1 for result in results if not result.passed())
+    print("%d of %d cases passed" % (len(results) - failures, len(results)))
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())